@@ -60,7 +60,7 @@
 #define configUSE_TRACE_FACILITY            1
 #define configUSE_16_BIT_TICKS              0
 #define configIDLE_SHOULD_YIELD             0
-#define configUSE_CO_ROUTINES               0
+#define configUSE_CO_ROUTINES               1
 #define configUSE_MUTEXES                   1
 #define configUSE_RECURSIVE_MUTEXES         1
 #define configCHECK_FOR_STACK_OVERFLOW      2
@@ -68,7 +68,45 @@
 //#define configMAX_PRIORITIES                ( ( unsigned portBASE_TYPE ) 16 )
 #define configMAX_PRIORITIES ( 16 )
 #define configMAX_CO_ROUTINE_PRIORITIES     ( 2 )
+#define configMAX_CO_ROUTINES               ( 4 )
 #define configQUEUE_REGISTRY_SIZE           10
+#define configUSE_QUEUE_MULTIPLE            1
+#define configUSE_CHANNELS                  1
+#define configUSE_IPC                       1
+#define configUSE_LIGHT_SEMAPHORES          1
+#define configUSE_LIGHT_MUTEXES             1
+#define configUSE_TRANSITIVE_PRIORITY_INHERITANCE 1
+#define configUSE_CEILING_MUTEXES           1
+#define configUSE_PREEMPTION_THRESHOLD      1
+#define configUSE_EDF_SCHEDULING            1
+#define configEDF_TASK_PRIORITY             ( 4 )
+#define configUSE_CYCLIC_EXECUTIVE          1
+#define configUSE_TASK_BUDGETS              1
+#define configUSE_TIMING_MONITOR            1
+#define configUSE_ADMISSION_CONTROL         1
+#define configUSE_DYNAMIC_TICK              1
+#define configUSE_MICROSECOND_TIMEBASE      1
+#define configUSE_64_BIT_TICK_COUNT         1
+#define configUSE_BATCHED_PENDED_TICKS      1
+#define configUSE_TIMER_WHEEL               1
+#define configUSE_TIMER_COMMAND_COALESCING  1
+#define configUSE_FAST_TIMERS               1
+#define configUSE_TIMER_SLACK               1
+#define configUSE_EVENT_DRIVEN_CO_ROUTINES  1
+#define configUSE_ACTIVE_OBJECTS            1
+#define configUSE_BASIC_TASKS               1
+
+/* Software timer definitions. */
+#define configUSE_TIMERS                    1
+#define configTIMER_TASK_PRIORITY           ( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH            5
+#define configTIMER_TASK_STACK_DEPTH        ( configMINIMAL_STACK_SIZE )
+
+/* A second timer service task runs housekeeping timers below the demo tasks,
+so their callbacks neither hold up the first timer service task nor the
+cyclic and deadline scheduled tasks. */
+#define configTIMER_SERVICE_COUNT           2
+#define configTIMER_SERVICE_PRIORITY( uxService )   ( ( ( uxService ) == 0U ) ? configTIMER_TASK_PRIORITY : 3U )
 
 /* Set the following definitions to 1 to include the API function, or zero
 to exclude the API function. */
@@ -0,0 +1,902 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "active.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include active objects.  Set configUSE_ACTIVE_OBJECTS to 1 in
+FreeRTOSConfig.h to include active objects. */
+#if ( configUSE_ACTIVE_OBJECTS == 1 )
+
+/* The most states on the path from a state to xActiveTop. */
+#define activePATH_LENGTH		( ( UBaseType_t ) configACTIVE_MAX_NEST_DEPTH )
+
+/* Set uxTopPriority to the highest priority that has a bit set in
+uxReadyPriorities, which must not be 0. */
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+	#define activeGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )
+#else
+	#define activeGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )						\
+	{																							\
+		uxTopPriority = ( UBaseType_t ) configACTIVE_MAX_PRIORITIES - ( UBaseType_t ) 1U;		\
+		while( ( ( uxReadyPriorities ) & ( ( UBaseType_t ) 1U << uxTopPriority ) ) == 0U )	\
+		{																						\
+			--uxTopPriority;																	\
+		}																						\
+	}
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+/*
+ * Definition of an active object thread.
+ */
+typedef struct ActiveThreadDefinition
+{
+	TaskHandle_t xTask;												/*< The task that dispatches the events. */
+	volatile UBaseType_t uxReadyObjects;	/*< Bit n is set while the active object of priority n, which belongs to this thread, has events waiting. */
+} ActiveThread_t;
+
+/*
+ * A pool of fixed size events.  The first word of each free event points to
+ * the next free event.
+ */
+typedef struct ActiveEventPool
+{
+	void *pvFreeList;				/*< The first free event, or NULL if the pool is empty. */
+	UBaseType_t uxEventSize;		/*< The size of each event in the pool. */
+	UBaseType_t uxFree;				/*< The number of free events. */
+	UBaseType_t uxMinimumFree;		/*< The lowest value uxFree has had. */
+} ActiveEventPool_t;
+
+/* The events sent to state handlers by the state machine itself, indexed by
+signal. */
+static const ActiveEvent_t xReservedEvents[] =
+{
+	{ activeSIG_EMPTY, 0U, 0U },
+	{ activeSIG_ENTRY, 0U, 0U },
+	{ activeSIG_EXIT, 0U, 0U },
+	{ activeSIG_INIT, 0U, 0U }
+};
+
+PRIVILEGED_DATA static ActiveEventPool_t xEventPools[ configACTIVE_MAX_EVENT_POOLS ];
+PRIVILEGED_DATA static volatile UBaseType_t uxEventPools = ( UBaseType_t ) 0U;
+
+/* The started active objects, indexed by priority.  Priorities are unique
+across all the threads, so a priority identifies an active object. */
+PRIVILEGED_DATA static ActiveObject_t *pxActiveObjects[ configACTIVE_MAX_PRIORITIES ];
+
+/* The subscribers to each signal that can be published.  Bit n is set while
+the active object of priority n is subscribed to the signal. */
+PRIVILEGED_DATA static volatile UBaseType_t uxSubscribers[ configACTIVE_MAX_PUBLISHED_SIGNALS ];
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that implements an active object thread.
+ */
+static portTASK_FUNCTION_PROTO( prvActiveThreadTask, pvParameters );
+
+/*
+ * Queue an event for an active object.  Must be called with interrupts
+ * masked.  *pxTaskToNotify is set to the task of the thread if the thread has
+ * to be notified once interrupts are unmasked, otherwise to NULL.
+ */
+static BaseType_t prvPost( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent, TaskHandle_t * const pxTaskToNotify ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take an event from the first pool whose events are large enough.  Must be
+ * called with interrupts masked.
+ */
+static ActiveEvent_t *prvEventNew( const UBaseType_t uxEventSize, const ActiveSignal_t xSignal ) PRIVILEGED_FUNCTION;
+
+/*
+ * Run an event to completion in the state machine of an active object.
+ */
+static void prvDispatch( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take a transition from pxSource, which is pxAO->pxState or one of its
+ * parents, to pxTarget.  The states up to the least common ancestor of the
+ * two are exited, the states down to pxTarget are entered, then the initial
+ * transitions of pxTarget and its substates are taken.
+ */
+static void prvTakeTransition( ActiveObject_t * const pxAO, const ActiveStateHandler_t pxSource, const ActiveStateHandler_t pxTarget ) PRIVILEGED_FUNCTION;
+
+/*
+ * Take the initial transitions from pxAO->pxState down to a leaf state.
+ */
+static void prvTakeInitialTransitions( ActiveObject_t * const pxAO ) PRIVILEGED_FUNCTION;
+
+/*
+ * Store pxState and its parents, innermost first, in pxPath, stopping before
+ * pxAncestor.  Returns the number of states stored.
+ */
+static UBaseType_t prvGetPath( ActiveObject_t * const pxAO, ActiveStateHandler_t pxState, const ActiveStateHandler_t pxAncestor, ActiveStateHandler_t * const pxPath ) PRIVILEGED_FUNCTION;
+
+/*
+ * Enter the states stored by prvGetPath(), outermost first.
+ */
+static void prvEnterPath( ActiveObject_t * const pxAO, const ActiveStateHandler_t * const pxPath, UBaseType_t uxDepth ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the parent of pxState.
+ */
+static ActiveStateHandler_t prvGetParent( ActiveObject_t * const pxAO, const ActiveStateHandler_t pxState ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveTop( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+	/* The top state ignores every event, and has no parent. */
+	( void ) pxAO;
+	( void ) pxEvent;
+
+	return activeRET_IGNORED;
+}
+/*-----------------------------------------------------------*/
+
+ActiveThreadHandle_t xActiveThreadCreate( const char * const pcName, const uint16_t usStackDepth, const UBaseType_t uxPriority )
+{
+ActiveThread_t *pxNewThread;
+
+	pxNewThread = ( ActiveThread_t * ) pvPortMalloc( sizeof( ActiveThread_t ) );
+
+	if( pxNewThread != NULL )
+	{
+		pxNewThread->uxReadyObjects = ( UBaseType_t ) 0U;
+
+		if( xTaskCreate( prvActiveThreadTask, pcName, usStackDepth, ( void * ) pxNewThread, uxPriority, &( pxNewThread->xTask ) ) != pdPASS )
+		{
+			vPortFree( pxNewThread );
+			pxNewThread = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( pxNewThread );
+	return ( ActiveThreadHandle_t ) pxNewThread;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectStart( ActiveObject_t * const pxAO, ActiveThreadHandle_t xThread, const UBaseType_t uxPriority, const ActiveEvent_t ** const ppxQueueStorage, const UBaseType_t uxQueueLength, ActiveStateHandler_t pxInitial )
+{
+ActiveThread_t * const pxThread = ( ActiveThread_t * ) xThread;
+ActiveStateHandler_t pxPath[ activePATH_LENGTH ];
+UBaseType_t uxDepth;
+BaseType_t xReturn;
+
+	configASSERT( pxAO );
+	configASSERT( pxThread );
+	configASSERT( uxPriority < ( UBaseType_t ) configACTIVE_MAX_PRIORITIES );
+	configASSERT( ppxQueueStorage );
+	configASSERT( uxQueueLength > ( UBaseType_t ) 0U );
+	configASSERT( pxInitial );
+
+	/* The initial transition is taken before the active object is assigned to
+	the thread, so nothing can be posted to it, or dispatched to it by the
+	thread, until it has reached its initial state. */
+	pxAO->pvThread = NULL;
+	pxAO->uxPriority = uxPriority;
+	pxAO->pxState = xActiveTop;
+	xReturn = pxInitial( pxAO, NULL );
+	configASSERT( xReturn == activeRET_TRAN );
+
+	uxDepth = prvGetPath( pxAO, pxAO->pxTemp, xActiveTop, pxPath );
+	prvEnterPath( pxAO, pxPath, uxDepth );
+	pxAO->pxState = pxPath[ 0 ];
+	prvTakeInitialTransitions( pxAO );
+
+	taskENTER_CRITICAL();
+	{
+		if( pxActiveObjects[ uxPriority ] == NULL )
+		{
+			pxAO->ppxQueue = ppxQueueStorage;
+			pxAO->uxQueueLength = uxQueueLength;
+			pxAO->uxHead = ( UBaseType_t ) 0U;
+			pxAO->uxTail = ( UBaseType_t ) 0U;
+			pxAO->uxWaiting = ( UBaseType_t ) 0U;
+			pxAO->pvThread = ( void * ) pxThread;
+			pxActiveObjects[ uxPriority ] = pxAO;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectPost( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+BaseType_t xReturn;
+TaskHandle_t xTaskToNotify;
+
+	configASSERT( pxAO );
+	configASSERT( pxEvent );
+
+	taskENTER_CRITICAL();
+	{
+		xReturn = prvPost( pxAO, pxEvent, &xTaskToNotify );
+	}
+	taskEXIT_CRITICAL();
+
+	if( xTaskToNotify != NULL )
+	{
+		( void ) xTaskNotifyGive( xTaskToNotify );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveObjectPostFromISR( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn;
+TaskHandle_t xTaskToNotify;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxAO );
+	configASSERT( pxEvent );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xReturn = prvPost( pxAO, pxEvent, &xTaskToNotify );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	if( xTaskToNotify != NULL )
+	{
+		vTaskNotifyGiveFromISR( xTaskToNotify, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPost( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent, TaskHandle_t * const pxTaskToNotify )
+{
+ActiveThread_t * const pxThread = ( ActiveThread_t * ) pxAO->pvThread;
+BaseType_t xReturn;
+
+	/* Events cannot be posted to an active object that has not been
+	started, which includes one that is still taking its initial
+	transition. */
+	configASSERT( pxThread );
+
+	*pxTaskToNotify = NULL;
+
+	if( pxAO->uxWaiting < pxAO->uxQueueLength )
+	{
+		if( pxEvent->ucPool != 0U )
+		{
+			/* The event is owned by the pool, so its reference count can be
+			changed even though the event is otherwise read only. */
+			configASSERT( pxEvent->ucReferences < ( uint8_t ) 0xffU );
+			( ( ActiveEvent_t * ) pxEvent )->ucReferences++; /*lint !e9005 Only the reference count is written. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxAO->ppxQueue[ pxAO->uxHead ] = pxEvent;
+		pxAO->uxHead++;
+
+		if( pxAO->uxHead == pxAO->uxQueueLength )
+		{
+			pxAO->uxHead = ( UBaseType_t ) 0U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxAO->uxWaiting++;
+
+		/* The thread only blocks when none of its active objects have events
+		waiting, so only needs to be notified if that was the case. */
+		if( pxThread->uxReadyObjects == ( UBaseType_t ) 0U )
+		{
+			*pxTaskToNotify = pxThread->xTask;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxThread->uxReadyObjects |= ( ( UBaseType_t ) 1U << pxAO->uxPriority );
+		xReturn = pdPASS;
+	}
+	else
+	{
+		xReturn = errQUEUE_FULL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vActiveObjectSubscribe( ActiveObject_t * const pxAO, const ActiveSignal_t xSignal )
+{
+	configASSERT( pxAO );
+	configASSERT( xSignal < ( ActiveSignal_t ) configACTIVE_MAX_PUBLISHED_SIGNALS );
+
+	/* Only an active object that has been started has its priority. */
+	configASSERT( pxActiveObjects[ pxAO->uxPriority ] == pxAO );
+
+	taskENTER_CRITICAL();
+	{
+		uxSubscribers[ xSignal ] |= ( ( UBaseType_t ) 1U << pxAO->uxPriority );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vActiveObjectUnsubscribe( ActiveObject_t * const pxAO, const ActiveSignal_t xSignal )
+{
+	configASSERT( pxAO );
+	configASSERT( xSignal < ( ActiveSignal_t ) configACTIVE_MAX_PUBLISHED_SIGNALS );
+
+	taskENTER_CRITICAL();
+	{
+		uxSubscribers[ xSignal ] &= ~( ( UBaseType_t ) 1U << pxAO->uxPriority );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxActivePublish( const ActiveEvent_t * const pxEvent )
+{
+UBaseType_t uxRemaining, uxPriority, uxDropped = ( UBaseType_t ) 0U;
+
+	configASSERT( pxEvent );
+	configASSERT( pxEvent->xSignal < ( ActiveSignal_t ) configACTIVE_MAX_PUBLISHED_SIGNALS );
+
+	/* Hold a reference while the event is published, so the garbage
+	collection below returns the event to its pool if there were no
+	subscribers. */
+	if( pxEvent->ucPool != 0U )
+	{
+		taskENTER_CRITICAL();
+		{
+			configASSERT( pxEvent->ucReferences < ( uint8_t ) 0xffU );
+			( ( ActiveEvent_t * ) pxEvent )->ucReferences++; /*lint !e9005 Only the reference count is written. */
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* No subscriber can run until the event has been posted to all of
+	them. */
+	vTaskSuspendAll();
+	{
+		/* The subscribers are taken from the bitmap highest priority first,
+		so each is found without a search and the cost is one post per
+		subscriber. */
+		uxRemaining = uxSubscribers[ pxEvent->xSignal ];
+
+		while( uxRemaining != ( UBaseType_t ) 0U )
+		{
+			activeGET_HIGHEST_PRIORITY( uxPriority, uxRemaining );
+			uxRemaining &= ~( ( UBaseType_t ) 1U << uxPriority );
+
+			/* A reference is only taken when the event is queued, so a
+			subscriber whose queue is full holds no reference to the event
+			and there is nothing to release.  The drop is counted so the
+			publisher can tell. */
+			if( xActiveObjectPost( pxActiveObjects[ uxPriority ], pxEvent ) != pdPASS )
+			{
+				uxDropped++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	vActiveEventGarbageCollect( pxEvent );
+
+	return uxDropped;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xActiveEventPoolCreate( void * const pvStorage, const UBaseType_t uxStorageSize, const UBaseType_t uxEventSize )
+{
+ActiveEventPool_t *pxPool;
+UBaseType_t uxBlockSize, uxBlocks, uxIndex;
+uint8_t *pucBlock;
+BaseType_t xReturn;
+
+	configASSERT( pvStorage );
+	configASSERT( ( ( ( size_t ) pvStorage ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == ( size_t ) 0 );
+	configASSERT( uxEventSize >= ( UBaseType_t ) sizeof( ActiveEvent_t ) );
+
+	/* Free events hold a pointer to the next free event, and every event must
+	stay aligned. */
+	uxBlockSize = uxEventSize;
+
+	if( uxBlockSize < ( UBaseType_t ) sizeof( void * ) )
+	{
+		uxBlockSize = ( UBaseType_t ) sizeof( void * );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxBlockSize = ( uxBlockSize + ( UBaseType_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( UBaseType_t ) portBYTE_ALIGNMENT_MASK );
+	uxBlocks = uxStorageSize / uxBlockSize;
+
+	taskENTER_CRITICAL();
+	{
+		if( uxEventPools < ( UBaseType_t ) configACTIVE_MAX_EVENT_POOLS )
+		{
+			pxPool = &( xEventPools[ uxEventPools ] );
+
+			/* pxActiveEventNew() uses the first pool that is large enough. */
+			configASSERT( ( uxEventPools == ( UBaseType_t ) 0U ) || ( xEventPools[ uxEventPools - 1U ].uxEventSize < uxBlockSize ) );
+
+			pxPool->pvFreeList = NULL;
+			pucBlock = ( ( uint8_t * ) pvStorage ) + ( uxBlocks * uxBlockSize );
+
+			for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxBlocks; uxIndex++ )
+			{
+				pucBlock -= uxBlockSize;
+				*( ( void ** ) pucBlock ) = pxPool->pvFreeList; /*lint !e826 The block is aligned and large enough to hold a pointer. */
+				pxPool->pvFreeList = ( void * ) pucBlock;
+			}
+
+			pxPool->uxEventSize = uxBlockSize;
+			pxPool->uxFree = uxBlocks;
+			pxPool->uxMinimumFree = uxBlocks;
+			uxEventPools++;
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+ActiveEvent_t *pxActiveEventNew( const UBaseType_t uxEventSize, const ActiveSignal_t xSignal )
+{
+ActiveEvent_t *pxEvent;
+
+	taskENTER_CRITICAL();
+	{
+		pxEvent = prvEventNew( uxEventSize, xSignal );
+	}
+	taskEXIT_CRITICAL();
+
+	return pxEvent;
+}
+/*-----------------------------------------------------------*/
+
+ActiveEvent_t *pxActiveEventNewFromISR( const UBaseType_t uxEventSize, const ActiveSignal_t xSignal )
+{
+ActiveEvent_t *pxEvent;
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pxEvent = prvEventNew( uxEventSize, xSignal );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return pxEvent;
+}
+/*-----------------------------------------------------------*/
+
+static ActiveEvent_t *prvEventNew( const UBaseType_t uxEventSize, const ActiveSignal_t xSignal )
+{
+ActiveEventPool_t *pxPool;
+ActiveEvent_t *pxEvent = NULL;
+UBaseType_t uxPool;
+
+	for( uxPool = ( UBaseType_t ) 0U; uxPool < uxEventPools; uxPool++ )
+	{
+		if( uxEventSize <= xEventPools[ uxPool ].uxEventSize )
+		{
+			break;
+		}
+	}
+
+	/* Events larger than the largest pool cannot be allocated. */
+	configASSERT( uxPool < uxEventPools );
+
+	if( uxPool < uxEventPools )
+	{
+		pxPool = &( xEventPools[ uxPool ] );
+
+		if( pxPool->pvFreeList != NULL )
+		{
+			pxEvent = ( ActiveEvent_t * ) pxPool->pvFreeList;
+			pxPool->pvFreeList = *( ( void ** ) pxPool->pvFreeList );
+			pxPool->uxFree--;
+
+			if( pxPool->uxFree < pxPool->uxMinimumFree )
+			{
+				pxPool->uxMinimumFree = pxPool->uxFree;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxEvent->xSignal = xSignal;
+			pxEvent->ucPool = ( uint8_t ) ( uxPool + 1U );
+			pxEvent->ucReferences = 0U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxEvent;
+}
+/*-----------------------------------------------------------*/
+
+void vActiveEventGarbageCollect( const ActiveEvent_t * const pxEvent )
+{
+ActiveEventPool_t *pxPool;
+
+	configASSERT( pxEvent );
+
+	if( pxEvent->ucPool != 0U )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( pxEvent->ucReferences > 1U )
+			{
+				( ( ActiveEvent_t * ) pxEvent )->ucReferences--; /*lint !e9005 Only the reference count is written. */
+			}
+			else
+			{
+				/* That was the last reference, so the event goes back to its
+				pool. */
+				pxPool = &( xEventPools[ pxEvent->ucPool - 1U ] );
+				*( ( void ** ) pxEvent ) = pxPool->pvFreeList; /*lint !e9005 !e826 The event is no longer in use. */
+				pxPool->pvFreeList = ( void * ) pxEvent; /*lint !e9005 The event is no longer in use. */
+				pxPool->uxFree++;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		/* Constant events are never freed. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxActiveEventPoolGetMinimumFree( const UBaseType_t uxPool )
+{
+	configASSERT( uxPool < uxEventPools );
+
+	return xEventPools[ uxPool ].uxMinimumFree;
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvActiveThreadTask, pvParameters )
+{
+ActiveThread_t * const pxThread = ( ActiveThread_t * ) pvParameters;
+ActiveObject_t *pxAO = NULL;
+const ActiveEvent_t *pxEvent;
+UBaseType_t uxPriority;
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( pxThread->uxReadyObjects != ( UBaseType_t ) 0U )
+			{
+				/* Take the next event of the highest priority active object
+				that has events waiting. */
+				activeGET_HIGHEST_PRIORITY( uxPriority, pxThread->uxReadyObjects );
+				pxAO = pxActiveObjects[ uxPriority ];
+				pxEvent = pxAO->ppxQueue[ pxAO->uxTail ];
+				pxAO->uxTail++;
+
+				if( pxAO->uxTail == pxAO->uxQueueLength )
+				{
+					pxAO->uxTail = ( UBaseType_t ) 0U;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxAO->uxWaiting--;
+
+				if( pxAO->uxWaiting == ( UBaseType_t ) 0U )
+				{
+					pxThread->uxReadyObjects &= ~( ( UBaseType_t ) 1U << uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxEvent = NULL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( pxEvent != NULL )
+		{
+			/* Run the event to completion, then drop the reference held by
+			the queue. */
+			prvDispatch( pxAO, pxEvent );
+			vActiveEventGarbageCollect( pxEvent );
+		}
+		else
+		{
+			/* Wait for an event to be posted to one of the active objects of
+			the thread.  A notification given since the check above makes this
+			return straight away. */
+			( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvDispatch( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+ActiveStateHandler_t pxHandler;
+BaseType_t xResult;
+
+	/* Offer the event to the innermost state, then to each parent in turn,
+	until one of them handles it or it reaches the top state. */
+	pxHandler = pxAO->pxState;
+
+	for( ;; )
+	{
+		xResult = pxHandler( pxAO, pxEvent );
+
+		if( xResult == activeRET_SUPER )
+		{
+			pxHandler = pxAO->pxTemp;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if( xResult == activeRET_TRAN )
+	{
+		prvTakeTransition( pxAO, pxHandler, pxAO->pxTemp );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTakeTransition( ActiveObject_t * const pxAO, const ActiveStateHandler_t pxSource, const ActiveStateHandler_t pxTarget )
+{
+ActiveStateHandler_t pxPath[ activePATH_LENGTH ];
+ActiveStateHandler_t pxState;
+UBaseType_t uxDepth, uxIndex;
+
+	/* Exit the states below the state that took the transition. */
+	for( pxState = pxAO->pxState; pxState != pxSource; pxState = prvGetParent( pxAO, pxState ) )
+	{
+		( void ) pxState( pxAO, &( xReservedEvents[ activeSIG_EXIT ] ) );
+	}
+
+	/* A transition from a state to itself exits and re-enters the state. */
+	if( pxSource == pxTarget )
+	{
+		( void ) pxSource( pxAO, &( xReservedEvents[ activeSIG_EXIT ] ) );
+		pxState = prvGetParent( pxAO, pxSource );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Exit states until reaching one that is on the path to the target, which
+	is the least common ancestor of the source and target states. */
+	uxDepth = prvGetPath( pxAO, pxTarget, xActiveTop, pxPath );
+
+	for( ;; )
+	{
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxDepth; uxIndex++ )
+		{
+			if( pxPath[ uxIndex ] == pxState )
+			{
+				break;
+			}
+		}
+
+		if( ( uxIndex < uxDepth ) || ( pxState == xActiveTop ) )
+		{
+			break;
+		}
+
+		( void ) pxState( pxAO, &( xReservedEvents[ activeSIG_EXIT ] ) );
+		pxState = prvGetParent( pxAO, pxState );
+	}
+
+	/* Enter the states below the least common ancestor, down to the target. */
+	prvEnterPath( pxAO, pxPath, uxIndex );
+	pxAO->pxState = pxTarget;
+	prvTakeInitialTransitions( pxAO );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTakeInitialTransitions( ActiveObject_t * const pxAO )
+{
+ActiveStateHandler_t pxPath[ activePATH_LENGTH ];
+UBaseType_t uxDepth;
+
+	/* A composite state takes its initial transition when it is sent
+	activeSIG_INIT.  A leaf state returns its parent instead. */
+	while( pxAO->pxState( pxAO, &( xReservedEvents[ activeSIG_INIT ] ) ) == activeRET_TRAN )
+	{
+		uxDepth = prvGetPath( pxAO, pxAO->pxTemp, pxAO->pxState, pxPath );
+		prvEnterPath( pxAO, pxPath, uxDepth );
+		pxAO->pxState = pxPath[ 0 ];
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetPath( ActiveObject_t * const pxAO, ActiveStateHandler_t pxState, const ActiveStateHandler_t pxAncestor, ActiveStateHandler_t * const pxPath )
+{
+UBaseType_t uxDepth = ( UBaseType_t ) 0U;
+
+	while( pxState != pxAncestor )
+	{
+		/* pxAncestor must be a parent of pxState, and the states must not be
+		nested more deeply than configACTIVE_MAX_NEST_DEPTH. */
+		configASSERT( pxState != xActiveTop );
+		configASSERT( uxDepth < activePATH_LENGTH );
+
+		pxPath[ uxDepth ] = pxState;
+		uxDepth++;
+		pxState = prvGetParent( pxAO, pxState );
+	}
+
+	return uxDepth;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEnterPath( ActiveObject_t * const pxAO, const ActiveStateHandler_t * const pxPath, UBaseType_t uxDepth )
+{
+	while( uxDepth > ( UBaseType_t ) 0U )
+	{
+		uxDepth--;
+		( void ) pxPath[ uxDepth ]( pxAO, &( xReservedEvents[ activeSIG_ENTRY ] ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static ActiveStateHandler_t prvGetParent( ActiveObject_t * const pxAO, const ActiveStateHandler_t pxState )
+{
+BaseType_t xResult;
+
+	/* Every state other than the top state returns its parent for the empty
+	signal. */
+	xResult = pxState( pxAO, &( xReservedEvents[ activeSIG_EMPTY ] ) );
+	configASSERT( xResult == activeRET_SUPER );
+	( void ) xResult;
+
+	return pxAO->pxTemp;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_ACTIVE_OBJECTS */
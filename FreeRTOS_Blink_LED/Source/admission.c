@@ -0,0 +1,457 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+#include "admission.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include admission control.  Set configUSE_ADMISSION_CONTROL to 1 in
+FreeRTOSConfig.h to include admission control. */
+#if ( configUSE_ADMISSION_CONTROL == 1 )
+
+/* The analysis is carried out in CPU cycles.  Periods and deadlines are held
+in 64 bits so a period of any number of ticks can be converted. */
+#define admissionCYCLES_PER_TICK	( ( uint64_t ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) )
+
+/* Densities are summed as fixed point fractions with this many bits after the
+binary point. */
+#define admissionFRACTION_BITS		( 20U )
+#define admissionFRACTION_ONE		( ( uint64_t ) 1U << admissionFRACTION_BITS )
+
+/* The parameters of an admitted task. */
+typedef struct xADMITTED_TASK
+{
+	TaskHandle_t xHandle;			/*< The handle of the task, or NULL while the task is being created. */
+	UBaseType_t uxPriority;			/*< The priority the task was created at. */
+	uint64_t ullPeriodCycles;		/*< The period of the task. */
+	uint64_t ullDeadlineCycles;		/*< The relative deadline of the task. */
+	uint32_t ulWcetCycles;			/*< The declared WCET, raised to the largest execution time measured. */
+	BaseType_t xInUse;				/*< pdTRUE if the entry holds an admitted task. */
+} AdmittedTask_t;
+
+/* The set of admitted tasks.  Only accessed with the scheduler suspended. */
+PRIVILEGED_DATA static AdmittedTask_t xAdmittedTasks[ configADMISSION_MAX_TASKS ];
+
+/*
+ * Analyse the set of admitted tasks, after first updating their WCETs from
+ * the execution times measured by the kernel.  Returns pdPASS if every task
+ * meets its deadline.
+ */
+static BaseType_t prvAnalyseTaskSet( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Response time analysis of the fixed priority task pxTask.  Returns pdPASS
+ * if its worst case response time is no longer than its deadline.
+ */
+static BaseType_t prvMeetsDeadline( const AdmittedTask_t * const pxTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Density test of the deadline scheduled tasks.  Returns pdPASS if they,
+ * and the tasks of a higher priority, fit within the processor.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	static BaseType_t prvDeadlineTasksFit( void ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xAdmissionTaskCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, const TickType_t xPeriod, const uint32_t ulWcetCycles, const TickType_t xRelativeDeadline, TaskHandle_t * const pxCreatedTask ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+BaseType_t xReturn = errADMISSION_REJECTED;
+AdmittedTask_t *pxEntry = NULL;
+TaskHandle_t xCreatedTask = NULL;
+UBaseType_t uxIndex;
+const TickType_t xDeadline = ( xRelativeDeadline == ( TickType_t ) 0U ) ? xPeriod : xRelativeDeadline;
+
+	configASSERT( xPeriod > ( TickType_t ) 0U );
+	configASSERT( xDeadline <= xPeriod );
+
+	/* Analyse the task at the priority it will actually be created at. */
+	if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+	{
+		uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	vTaskSuspendAll();
+	{
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configADMISSION_MAX_TASKS; uxIndex++ )
+		{
+			if( xAdmittedTasks[ uxIndex ].xInUse == pdFALSE )
+			{
+				pxEntry = &( xAdmittedTasks[ uxIndex ] );
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( pxEntry != NULL )
+		{
+			/* Add the task to the set, then check the set is still
+			schedulable. */
+			pxEntry->xHandle = NULL;
+			pxEntry->uxPriority = uxPriority;
+			pxEntry->ullPeriodCycles = ( uint64_t ) xPeriod * admissionCYCLES_PER_TICK;
+			pxEntry->ullDeadlineCycles = ( uint64_t ) xDeadline * admissionCYCLES_PER_TICK;
+			pxEntry->ulWcetCycles = ulWcetCycles;
+			pxEntry->xInUse = pdTRUE;
+
+			if( prvAnalyseTaskSet() != pdFAIL )
+			{
+				xReturn = xTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xCreatedTask );
+
+				if( xReturn == pdPASS )
+				{
+					pxEntry->xHandle = xCreatedTask;
+
+					#if ( configUSE_EDF_SCHEDULING == 1 )
+					{
+						if( uxPriority == ( UBaseType_t ) configEDF_TASK_PRIORITY )
+						{
+							/* The scheduler is suspended, so the task has not
+							run and can be deleted again if it cannot be given
+							its deadline. */
+							if( xTaskDeadlineSet( xCreatedTask, xDeadline ) == pdFAIL )
+							{
+								vTaskDelete( xCreatedTask );
+								xCreatedTask = NULL;
+								pxEntry->xHandle = NULL;
+								pxEntry->xInUse = pdFALSE;
+								xReturn = errADMISSION_REJECTED;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_EDF_SCHEDULING */
+				}
+				else
+				{
+					pxEntry->xInUse = pdFALSE;
+				}
+			}
+			else
+			{
+				pxEntry->xInUse = pdFALSE;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( pxCreatedTask != NULL )
+	{
+		*pxCreatedTask = xCreatedTask;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vAdmissionTaskRemove( TaskHandle_t xTask )
+{
+UBaseType_t uxIndex;
+
+	configASSERT( xTask );
+
+	vTaskSuspendAll();
+	{
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configADMISSION_MAX_TASKS; uxIndex++ )
+		{
+			if( ( xAdmittedTasks[ uxIndex ].xInUse != pdFALSE ) && ( xAdmittedTasks[ uxIndex ].xHandle == xTask ) )
+			{
+				xAdmittedTasks[ uxIndex ].xInUse = pdFALSE;
+				xAdmittedTasks[ uxIndex ].xHandle = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAdmissionCheck( void )
+{
+BaseType_t xReturn;
+
+	vTaskSuspendAll();
+	{
+		xReturn = ( prvAnalyseTaskSet() != pdFAIL ) ? pdPASS : errADMISSION_REJECTED;
+	}
+	( void ) xTaskResumeAll();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvAnalyseTaskSet( void )
+{
+BaseType_t xReturn = pdPASS;
+UBaseType_t uxIndex;
+#if ( configUSE_TIMING_MONITOR == 1 )
+	TaskTimingStatus_t xTimingStatus;
+#endif
+
+	#if ( configUSE_TIMING_MONITOR == 1 )
+	{
+		/* Feed the execution times measured by the kernel back into the
+		analysis.  A WCET is only ever raised, so clearing the timing
+		statistics of a task does not lose what has been learnt. */
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configADMISSION_MAX_TASKS; uxIndex++ )
+		{
+			if( ( xAdmittedTasks[ uxIndex ].xInUse != pdFALSE ) && ( xAdmittedTasks[ uxIndex ].xHandle != NULL ) )
+			{
+				vTaskGetTimingStatus( xAdmittedTasks[ uxIndex ].xHandle, &xTimingStatus );
+
+				if( xTimingStatus.ulMaxExecutionCycles > xAdmittedTasks[ uxIndex ].ulWcetCycles )
+				{
+					xAdmittedTasks[ uxIndex ].ulWcetCycles = xTimingStatus.ulMaxExecutionCycles;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#endif /* configUSE_TIMING_MONITOR */
+
+	for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configADMISSION_MAX_TASKS; uxIndex++ )
+	{
+		if( xAdmittedTasks[ uxIndex ].xInUse != pdFALSE )
+		{
+			#if ( configUSE_EDF_SCHEDULING == 1 )
+			{
+				/* The deadline scheduled tasks are checked as a group
+				below. */
+				if( xAdmittedTasks[ uxIndex ].uxPriority == ( UBaseType_t ) configEDF_TASK_PRIORITY )
+				{
+					continue;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
+			if( prvMeetsDeadline( &( xAdmittedTasks[ uxIndex ] ) ) == pdFAIL )
+			{
+				xReturn = pdFAIL;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	{
+		if( xReturn != pdFAIL )
+		{
+			xReturn = prvDeadlineTasksFit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_EDF_SCHEDULING */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvMeetsDeadline( const AdmittedTask_t * const pxTask )
+{
+uint64_t ullResponse = 0U, ullNextResponse = ( uint64_t ) pxTask->ulWcetCycles;
+UBaseType_t uxIndex;
+const AdmittedTask_t *pxOther;
+
+	/* Iterate R = C + sum( ceil( R / Tj ) * Cj ) over the tasks j that can
+	preempt the task until R stops changing, or exceeds the deadline.  The
+	deadline scheduled tasks interfere with lower priority tasks in the same
+	way as fixed priority tasks. */
+	while( ( ullNextResponse != ullResponse ) && ( ullNextResponse <= pxTask->ullDeadlineCycles ) )
+	{
+		ullResponse = ullNextResponse;
+		ullNextResponse = ( uint64_t ) pxTask->ulWcetCycles;
+
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configADMISSION_MAX_TASKS; uxIndex++ )
+		{
+			pxOther = &( xAdmittedTasks[ uxIndex ] );
+
+			if( ( pxOther != pxTask ) && ( pxOther->xInUse != pdFALSE ) && ( pxOther->uxPriority >= pxTask->uxPriority ) )
+			{
+				ullNextResponse += ( ( ullResponse + pxOther->ullPeriodCycles - 1U ) / pxOther->ullPeriodCycles ) * ( uint64_t ) pxOther->ulWcetCycles;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+	return ( ullNextResponse <= pxTask->ullDeadlineCycles ) ? pdPASS : pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static BaseType_t prvDeadlineTasksFit( void )
+	{
+	uint64_t ullDensity = 0U;
+	UBaseType_t uxIndex;
+	BaseType_t xHaveDeadlineTasks = pdFALSE;
+	const AdmittedTask_t *pxTask;
+
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < ( UBaseType_t ) configADMISSION_MAX_TASKS; uxIndex++ )
+		{
+			pxTask = &( xAdmittedTasks[ uxIndex ] );
+
+			if( pxTask->xInUse != pdFALSE )
+			{
+				/* Deadlines are never longer than periods, so the density of
+				a deadline scheduled task is C / D.  Tasks of a higher
+				priority take C / T of the processor away from them.  Each
+				term is rounded up so the sum is never underestimated. */
+				if( pxTask->uxPriority == ( UBaseType_t ) configEDF_TASK_PRIORITY )
+				{
+					ullDensity += ( ( ( uint64_t ) pxTask->ulWcetCycles << admissionFRACTION_BITS ) + pxTask->ullDeadlineCycles - 1U ) / pxTask->ullDeadlineCycles;
+					xHaveDeadlineTasks = pdTRUE;
+				}
+				else if( pxTask->uxPriority > ( UBaseType_t ) configEDF_TASK_PRIORITY )
+				{
+					ullDensity += ( ( ( uint64_t ) pxTask->ulWcetCycles << admissionFRACTION_BITS ) + pxTask->ullPeriodCycles - 1U ) / pxTask->ullPeriodCycles;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* The higher priority tasks alone have already been checked by
+		response time analysis. */
+		return ( ( xHaveDeadlineTasks == pdFALSE ) || ( ullDensity <= admissionFRACTION_ONE ) ) ? pdPASS : pdFAIL;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+/* This entire source file will be skipped if the application is not configured
+to include admission control.  If you want to include admission control then
+ensure configUSE_ADMISSION_CONTROL is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_ADMISSION_CONTROL == 1 */
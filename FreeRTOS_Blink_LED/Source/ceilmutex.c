@@ -0,0 +1,286 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ceilmutex.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include priority ceiling mutexes.  Set configUSE_CEILING_MUTEXES to 1 in
+FreeRTOSConfig.h to include priority ceiling mutexes. */
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+/*
+ * Definition of a priority ceiling mutex.
+ */
+typedef struct CeilingMutexDefinition
+{
+	volatile uint32_t ulHolder;			/*< The handle of the task holding the mutex, or 0 if the mutex is available.  Only updated from within a critical section. */
+	UBaseType_t uxCeilingPriority;		/*< The priority a task runs at while holding the mutex. */
+	ListItem_t xCeilingListItem;		/*< Used to reference the mutex from the list of ceiling mutexes held by the holder. */
+	List_t xTasksWaitingToTake;			/*< List of tasks that are blocked waiting to take the mutex.  Only ever used by tasks that share the ceiling priority.  Stored in priority order. */
+} CeilingMutex_t;
+
+#if( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define ceilmutexYIELD_IF_USING_PREEMPTION()
+#else
+	#define ceilmutexYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/*-----------------------------------------------------------*/
+
+CeilingMutexHandle_t xCeilingMutexCreate( UBaseType_t uxCeilingPriority, const TaskHandle_t * const pxUserTasks, UBaseType_t uxNumberOfUserTasks )
+{
+CeilingMutex_t *pxNewMutex = NULL;
+BaseType_t xCeilingValid = pdTRUE;
+UBaseType_t uxTask;
+
+	configASSERT( !( ( pxUserTasks == NULL ) && ( uxNumberOfUserTasks != ( UBaseType_t ) 0U ) ) );
+
+	if( uxCeilingPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+	{
+		xCeilingValid = pdFALSE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The ceiling must be at least the priority of every task that uses the
+	mutex, otherwise a user could preempt the holder and find the mutex
+	held.  The base priority is checked, as a user may be running at a
+	priority it has inherited or been raised to by another ceiling. */
+	for( uxTask = ( UBaseType_t ) 0U; uxTask < uxNumberOfUserTasks; uxTask++ )
+	{
+		if( uxTaskBasePriorityGet( pxUserTasks[ uxTask ] ) > uxCeilingPriority )
+		{
+			xCeilingValid = pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xCeilingValid != pdFALSE )
+	{
+		pxNewMutex = ( CeilingMutex_t * ) pvPortMalloc( sizeof( CeilingMutex_t ) );
+
+		if( pxNewMutex != NULL )
+		{
+			pxNewMutex->ulHolder = 0UL;
+			pxNewMutex->uxCeilingPriority = uxCeilingPriority;
+			vListInitialiseItem( &( pxNewMutex->xCeilingListItem ) );
+			listSET_LIST_ITEM_OWNER( &( pxNewMutex->xCeilingListItem ), pxNewMutex );
+			vListInitialise( &( pxNewMutex->xTasksWaitingToTake ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( pxNewMutex );
+	return ( CeilingMutexHandle_t ) pxNewMutex;
+}
+/*-----------------------------------------------------------*/
+
+void vCeilingMutexTake( CeilingMutexHandle_t xMutex )
+{
+CeilingMutex_t * const pxMutex = ( CeilingMutex_t * ) xMutex;
+const uint32_t ulCurrentTask = ( uint32_t ) xTaskGetCurrentTaskHandle(); /*lint !e923 Task handles are 32-bit pointers on this port. */
+
+	configASSERT( pxMutex );
+	configASSERT( pxMutex->ulHolder != ulCurrentTask );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED );
+	}
+	#endif
+
+	/* The mutex is claimed and the priority raised within the same critical
+	section, so no other user of the mutex can run from here on, unless it
+	shares the ceiling priority.  As with the queue implementation, this
+	function relaxes the coding standard somewhat to allow return statements
+	within the function itself. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( pxMutex->ulHolder == 0UL )
+			{
+				pxMutex->ulHolder = ulCurrentTask;
+				vTaskPriorityRaiseToCeiling( &( pxMutex->xCeilingListItem ), pxMutex->uxCeilingPriority );
+				taskEXIT_CRITICAL();
+				return;
+			}
+			else
+			{
+				/* The mutex is held by a task that shares the ceiling priority
+				and was time sliced out, or that has blocked while holding the
+				mutex.  Block until it gives the mutex back rather than
+				yielding, as yielding would starve any task of a lower
+				priority.  The yield is held pending until the critical section
+				is exited, and when the task next runs it goes around the loop
+				to try claiming the mutex again. */
+				vTaskPlaceOnEventList( &( pxMutex->xTasksWaitingToTake ), portMAX_DELAY );
+				portYIELD_WITHIN_API();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCeilingMutexGive( CeilingMutexHandle_t xMutex )
+{
+CeilingMutex_t * const pxMutex = ( CeilingMutex_t * ) xMutex;
+BaseType_t xYieldRequired = pdFALSE;
+
+	configASSERT( pxMutex );
+	configASSERT( pxMutex->ulHolder == ( uint32_t ) xTaskGetCurrentTaskHandle() ); /*lint !e923 Task handles are 32-bit pointers on this port. */
+
+	taskENTER_CRITICAL();
+	{
+		pxMutex->ulHolder = 0UL;
+
+		/* Unblock the highest priority waiting task, which will claim the
+		mutex when it runs unless another task claims it first. */
+		if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xTaskPriorityRestoreFromCeiling( &( pxMutex->xCeilingListItem ) ) != pdFALSE )
+		{
+			xYieldRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	/* A task that became ready while the ceiling was held may now have a
+	higher priority than this task. */
+	if( xYieldRequired != pdFALSE )
+	{
+		ceilmutexYIELD_IF_USING_PREEMPTION();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vCeilingMutexDelete( CeilingMutexHandle_t xMutex )
+{
+CeilingMutex_t * const pxMutex = ( CeilingMutex_t * ) xMutex;
+
+	configASSERT( pxMutex );
+	configASSERT( pxMutex->ulHolder == 0UL );
+	configASSERT( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE );
+
+	vPortFree( pxMutex );
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include priority ceiling mutexes.  If you want to include priority ceiling
+mutexes then ensure configUSE_CEILING_MUTEXES is set to 1 in
+FreeRTOSConfig.h. */
+#endif /* configUSE_CEILING_MUTEXES == 1 */
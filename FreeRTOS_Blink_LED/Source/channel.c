@@ -0,0 +1,315 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "channel.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include channel functionality.  Set configUSE_CHANNELS to 1 in
+FreeRTOSConfig.h to include channels. */
+#if ( configUSE_CHANNELS == 1 )
+
+/*
+ * Definition of a channel.  A channel has no storage area - items are copied
+ * directly between the sending and receiving tasks.
+ */
+typedef struct ChannelDefinition
+{
+	List_t xTasksWaitingToSend;		/*< List of tasks that are blocked waiting for a receiver.  Stored in priority order. */
+	List_t xTasksWaitingToReceive;	/*< List of tasks that are blocked waiting for a sender.  Stored in priority order. */
+	UBaseType_t uxItemSize;			/*< The size of each item passed through the channel. */
+} Channel_t;
+
+/*
+ * A task that blocks on a channel places one of these on its own stack, and
+ * points the event data held in its TCB at it.  The task that completes the
+ * transfer uses the structure to locate the blocked task's buffer, then marks
+ * the transfer as complete so the blocked task knows it did not time out.
+ */
+typedef struct ChannelWaiter
+{
+	void *pvData;					/*< The item being sent, or the buffer the received item is to be copied into. */
+	volatile BaseType_t xComplete;	/*< Set to pdTRUE by the task that completed the transfer. */
+} ChannelWaiter_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Implements both xChannelSend() and xChannelReceive().  xIsSend is pdTRUE if
+ * pvData is an item to send, and pdFALSE if it is a buffer to receive into.
+ */
+static BaseType_t prvChannelTransfer( Channel_t * const pxChannel, void * const pvData, TickType_t xTicksToWait, const BaseType_t xIsSend ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+ChannelHandle_t xChannelCreate( const UBaseType_t uxItemSize )
+{
+Channel_t *pxNewChannel;
+
+	pxNewChannel = ( Channel_t * ) pvPortMalloc( sizeof( Channel_t ) );
+
+	if( pxNewChannel != NULL )
+	{
+		pxNewChannel->uxItemSize = uxItemSize;
+		vListInitialise( &( pxNewChannel->xTasksWaitingToSend ) );
+		vListInitialise( &( pxNewChannel->xTasksWaitingToReceive ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( pxNewChannel );
+	return ( ChannelHandle_t ) pxNewChannel;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xChannelSend( ChannelHandle_t xChannel, const void * const pvItemToSend, TickType_t xTicksToWait )
+{
+Channel_t * const pxChannel = ( Channel_t * ) xChannel;
+
+	configASSERT( pxChannel );
+	configASSERT( !( ( pvItemToSend == NULL ) && ( pxChannel->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+	/* The item is only ever read, but the waiter structure is shared with the
+	receive path so the const qualifier is cast away here. */
+	return prvChannelTransfer( pxChannel, ( void * ) pvItemToSend, xTicksToWait, pdTRUE ); /*lint !e9005 The item is not written to on the send path. */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xChannelReceive( ChannelHandle_t xChannel, void * const pvBuffer, TickType_t xTicksToWait )
+{
+Channel_t * const pxChannel = ( Channel_t * ) xChannel;
+
+	configASSERT( pxChannel );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxChannel->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+	return prvChannelTransfer( pxChannel, pvBuffer, xTicksToWait, pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvChannelTransfer( Channel_t * const pxChannel, void * const pvData, TickType_t xTicksToWait, const BaseType_t xIsSend )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+ChannelWaiter_t xWaiter;
+ChannelWaiter_t *pxPeer;
+List_t *pxPeerList, *pxWaitList;
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	if( xIsSend != pdFALSE )
+	{
+		pxPeerList = &( pxChannel->xTasksWaitingToReceive );
+		pxWaitList = &( pxChannel->xTasksWaitingToSend );
+	}
+	else
+	{
+		pxPeerList = &( pxChannel->xTasksWaitingToSend );
+		pxWaitList = &( pxChannel->xTasksWaitingToReceive );
+	}
+
+	/* Channels cannot be accessed from interrupts, so suspending the scheduler
+	is enough to prevent the channel's event lists changing.  While the
+	scheduler is suspended the tick interrupt does not remove timed out tasks
+	from event lists either, so a task found on an event list cannot time out
+	before the transfer to or from its buffer has completed.  As with the queue
+	implementation, this function relaxes the coding standard somewhat to allow
+	return statements within the function itself. */
+	for( ;; )
+	{
+		vTaskSuspendAll();
+		{
+			if( listLIST_IS_EMPTY( pxPeerList ) == pdFALSE )
+			{
+				/* The highest priority task waiting to perform the opposite
+				operation is at the head of the list.  Copy directly between
+				its buffer and the buffer of the calling task. */
+				pxPeer = ( ChannelWaiter_t * ) pvTaskGetEventData( ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( pxPeerList ) );
+				configASSERT( pxPeer );
+
+				if( xIsSend != pdFALSE )
+				{
+					( void ) memcpy( pxPeer->pvData, pvData, ( size_t ) pxChannel->uxItemSize ); /*lint !e418 Previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0. */
+				}
+				else
+				{
+					( void ) memcpy( pvData, pxPeer->pvData, ( size_t ) pxChannel->uxItemSize ); /*lint !e418 Previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0. */
+				}
+
+				pxPeer->xComplete = pdTRUE;
+
+				/* The pending ready list, onto which the peer is moved while the
+				scheduler is suspended, can only be accessed from a critical
+				section.  If the peer has a higher priority than the calling
+				task the yield is performed when the scheduler is resumed. */
+				taskENTER_CRITICAL();
+				{
+					( void ) xTaskRemoveFromEventList( pxPeerList );
+				}
+				taskEXIT_CRITICAL();
+
+				( void ) xTaskResumeAll();
+				return pdPASS;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* There is no peer and no block time is specified (or the
+				block time has expired) so leave now. */
+				( void ) xTaskResumeAll();
+				return pdFAIL;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			xWaiter.pvData = pvData;
+			xWaiter.xComplete = pdFALSE;
+			vTaskSetEventData( &xWaiter );
+			vTaskPlaceOnEventList( pxWaitList, xTicksToWait );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The task is no longer referenced from the event list, either
+			because a peer completed the transfer or because the block time
+			expired, so its event data can no longer be accessed. */
+			vTaskSetEventData( NULL );
+
+			if( xWaiter.xComplete != pdFALSE )
+			{
+				return pdPASS;
+			}
+			else
+			{
+				/* Timed out - go around the loop again to check for a peer
+				one last time before returning. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* The timeout has expired. */
+			( void ) xTaskResumeAll();
+			return pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vChannelDelete( ChannelHandle_t xChannel )
+{
+Channel_t * const pxChannel = ( Channel_t * ) xChannel;
+
+	configASSERT( pxChannel );
+
+	/* A channel holds no data, but tasks blocked on it would be left
+	referencing freed memory. */
+	configASSERT( listLIST_IS_EMPTY( &( pxChannel->xTasksWaitingToSend ) ) != pdFALSE );
+	configASSERT( listLIST_IS_EMPTY( &( pxChannel->xTasksWaitingToReceive ) ) != pdFALSE );
+
+	vPortFree( pxChannel );
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include channel functionality.  If you want to include channel
+functionality then ensure configUSE_CHANNELS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_CHANNELS == 1 */
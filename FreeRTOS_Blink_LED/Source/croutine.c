@@ -70,6 +70,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "croutine.h"
+#include "croutine_ext.h"
 
 /* Remove the whole file is co-routines are not being used. */
 #if( configUSE_CO_ROUTINES != 0 )
@@ -85,10 +86,12 @@
 
 /* Lists for ready and blocked co-routines. --------------------*/
 static List_t pxReadyCoRoutineLists[ configMAX_CO_ROUTINE_PRIORITIES ];	/*< Prioritised ready co-routines. */
-static List_t xDelayedCoRoutineList1;									/*< Delayed co-routines. */
-static List_t xDelayedCoRoutineList2;									/*< Delayed co-routines (two lists are used - one for delays that have overflowed the current tick count. */
-static List_t * pxDelayedCoRoutineList;									/*< Points to the delayed co-routine list currently being used. */
-static List_t * pxOverflowDelayedCoRoutineList;							/*< Points to the delayed co-routine list currently being used to hold co-routines that have overflowed the current tick count. */
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+	static List_t xDelayedCoRoutineList1;								/*< Delayed co-routines. */
+	static List_t xDelayedCoRoutineList2;								/*< Delayed co-routines (two lists are used - one for delays that have overflowed the current tick count. */
+	static List_t * pxDelayedCoRoutineList;								/*< Points to the delayed co-routine list currently being used. */
+	static List_t * pxOverflowDelayedCoRoutineList;						/*< Points to the delayed co-routine list currently being used to hold co-routines that have overflowed the current tick count. */
+#endif
 static List_t xPendingReadyCoRoutineList;								/*< Holds co-routines that have been readied by an external event.  They cannot be added directly to the ready lists as the ready lists cannot be accessed by interrupts. */
 
 /* Other file private variables. --------------------------------*/
@@ -96,6 +99,45 @@ CRCB_t * pxCurrentCoRoutine = NULL;
 static UBaseType_t uxTopCoRoutineReadyPriority = 0;
 static TickType_t xCoRoutineTickCount = 0, xLastTickCount = 0, xPassedTicks = 0;
 
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	/* The CRCB_t defined in croutine.h cannot be extended, so the additional
+	state of each co-routine follows it in the same allocation.  The CRCB_t
+	must be the first member so a co-routine handle can be cast to either. */
+	typedef struct corCoRoutineExtendedControlBlock
+	{
+		CRCB_t xCRCB;
+		UBaseType_t uxDelayedIndex;			/*< One more than the position of the co-routine in the delayed heap, or 0 when it is not delayed. */
+		volatile uint32_t ulNotifiedValue;	/*< The notification count given by xCoRoutineNotifyGive(). */
+		volatile uint8_t ucNotifyState;		/*< corWAITING_NOTIFICATION while blocked in xCoRoutineNotifyTake(). */
+	} CRCBExt_t;
+
+	/* The delayed co-routines, held as a binary heap ordered by the number of
+	ticks from xCoRoutineTickCount to their wake time, so the first to wake is
+	always at position 0.  The order is unchanged when xCoRoutineTickCount
+	moves on, as long as every co-routine whose wake time it passes is removed
+	first, so no overflow list is needed.  Only accessed by the co-routine
+	scheduler. */
+	static CRCBExt_t *pxDelayedCoRoutines[ configMAX_CO_ROUTINES ];
+	static UBaseType_t uxDelayedCoRoutines = 0;
+
+	static UBaseType_t uxCoRoutineReadyPriorities = 0;	/*< Bit n is set while pxReadyCoRoutineLists[ n ] is not empty. */
+	static UBaseType_t uxCoRoutinesCreated = 0;			/*< Bounds the delayed heap. */
+	static TaskHandle_t xCoRoutineSchedulerTask = NULL;	/*< Set by xCoRoutineCreateSchedulerTask(). */
+
+	/* Values of ucNotifyState. */
+	#define corNOT_WAITING_NOTIFICATION		( ( uint8_t ) 0 )
+	#define corWAITING_NOTIFICATION			( ( uint8_t ) 1 )
+
+	/* The position of the parent and first child of a position in the delayed
+	heap, and the number of ticks the co-routine at a position has left to
+	wait counted from xCoRoutineTickCount. */
+	#define corHEAP_PARENT( uxPosition )		( ( ( uxPosition ) - ( UBaseType_t ) 1U ) >> 1 )
+	#define corHEAP_CHILD( uxPosition )			( ( ( uxPosition ) << 1 ) + ( UBaseType_t ) 1U )
+	#define corTICKS_TO_WAKE( uxPosition )		( listGET_LIST_ITEM_VALUE( &( pxDelayedCoRoutines[ ( uxPosition ) ]->xCRCB.xGenericListItem ) ) - xCoRoutineTickCount )
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+
 /* The initial state of the co-routine when it is created. */
 #define corINITIAL_STATE	( 0 )
 
@@ -106,14 +148,41 @@ static TickType_t xCoRoutineTickCount = 0, xLastTickCount = 0, xPassedTicks = 0;
  * This macro accesses the co-routine ready lists and therefore must not be
  * used from within an ISR.
  */
-#define prvAddCoRoutineToReadyQueue( pxCRCB )																		\
-{																													\
-	if( pxCRCB->uxPriority > uxTopCoRoutineReadyPriority )															\
-	{																												\
-		uxTopCoRoutineReadyPriority = pxCRCB->uxPriority;															\
-	}																												\
-	vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ pxCRCB->uxPriority ] ), &( pxCRCB->xGenericListItem ) );	\
-}
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+
+	#define prvAddCoRoutineToReadyQueue( pxCRCB )																		\
+	{																													\
+		if( pxCRCB->uxPriority > uxTopCoRoutineReadyPriority )															\
+		{																												\
+			uxTopCoRoutineReadyPriority = pxCRCB->uxPriority;															\
+		}																												\
+		vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ pxCRCB->uxPriority ] ), &( pxCRCB->xGenericListItem ) );	\
+	}
+
+#else
+
+	#define prvAddCoRoutineToReadyQueue( pxCRCB )																		\
+	{																													\
+		uxCoRoutineReadyPriorities |= ( ( UBaseType_t ) 1U << pxCRCB->uxPriority );										\
+		vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ pxCRCB->uxPriority ] ), &( pxCRCB->xGenericListItem ) );	\
+	}
+
+	/* Set uxTopPriority to the highest priority that has a bit set in
+	uxReadyPriorities, which must not be 0. */
+	#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+		#define corGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )
+	#else
+		#define corGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )								\
+		{																								\
+			uxTopPriority = ( UBaseType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( UBaseType_t ) 1U;		\
+			while( ( ( uxReadyPriorities ) & ( ( UBaseType_t ) 1U << uxTopPriority ) ) == 0U )		\
+			{																							\
+				--uxTopPriority;																		\
+			}																							\
+		}
+	#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 
 /*
  * Utility to ready all the lists used by the scheduler.  This is called
@@ -139,6 +208,42 @@ static void prvCheckPendingReadyList( void );
  */
 static void prvCheckDelayedList( void );
 
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	/*
+	 * Add a co-routine to, or remove a co-routine from, the delayed heap.  The
+	 * heap always has room, as it is sized for every co-routine.
+	 */
+	static void prvDelayedHeapInsert( CRCBExt_t * const pxCRCB );
+	static void prvDelayedHeapRemove( CRCBExt_t * const pxCRCB );
+
+	/*
+	 * Move the co-routine at uxPosition in the delayed heap up or down until it
+	 * is in wake time order with its parent and children.
+	 */
+	static void prvDelayedHeapSift( UBaseType_t uxPosition );
+
+	/*
+	 * Notify the task created by xCoRoutineCreateSchedulerTask(), if there is
+	 * one, that a co-routine has been placed in the pending ready list.  Called
+	 * with interrupts masked, from an interrupt or from a task.
+	 */
+	static void prvWakeCoRoutineScheduler( BaseType_t * const pxHigherPriorityTaskWoken );
+
+	/*
+	 * The number of ticks the co-routine scheduler can block for before a
+	 * co-routine needs to run - 0 if one is ready now.
+	 */
+	static TickType_t prvCoRoutineIdleTime( void );
+
+	/*
+	 * The task that runs the co-routines.  It only runs while a co-routine is
+	 * ready, and otherwise blocks until an event or a timeout readies one.
+	 */
+	static portTASK_FUNCTION_PROTO( prvCoRoutineSchedulerTask, pvParameters );
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+
 /*-----------------------------------------------------------*/
 
 BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex )
@@ -147,7 +252,24 @@ BaseType_t xReturn;
 CRCB_t *pxCoRoutine;
 
 	/* Allocate the memory that will store the co-routine control block. */
-	pxCoRoutine = ( CRCB_t * ) pvPortMalloc( sizeof( CRCB_t ) );
+	#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+	{
+		pxCoRoutine = ( CRCB_t * ) pvPortMalloc( sizeof( CRCB_t ) );
+	}
+	#else
+	{
+		/* The delayed heap has room for configMAX_CO_ROUTINES. */
+		if( uxCoRoutinesCreated < ( UBaseType_t ) configMAX_CO_ROUTINES )
+		{
+			pxCoRoutine = ( CRCB_t * ) pvPortMalloc( sizeof( CRCBExt_t ) );
+		}
+		else
+		{
+			pxCoRoutine = NULL;
+		}
+	}
+	#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+
 	if( pxCoRoutine )
 	{
 		/* If pxCurrentCoRoutine is NULL then this is the first co-routine to
@@ -181,7 +303,22 @@ CRCB_t *pxCoRoutine;
 		listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xEventListItem ), pxCoRoutine );
 
 		/* Event lists are always in priority order. */
-		listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) );
+		#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) );
+		}
+		#else
+		{
+			/* The flag places the co-routine after any task waiting on the
+			same event list, and marks it as a co-routine. */
+			listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) | corEVENT_LIST_ITEM_FLAG ) );
+
+			( ( CRCBExt_t * ) pxCoRoutine )->uxDelayedIndex = ( UBaseType_t ) 0U;
+			( ( CRCBExt_t * ) pxCoRoutine )->ulNotifiedValue = 0UL;
+			( ( CRCBExt_t * ) pxCoRoutine )->ucNotifyState = corNOT_WAITING_NOTIFICATION;
+			uxCoRoutinesCreated++;
+		}
+		#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 
 		/* Now the co-routine has been initialised it can be added to the ready
 		list at the correct priority. */
@@ -209,23 +346,41 @@ TickType_t xTimeToWake;
 	/* We must remove ourselves from the ready list before adding
 	ourselves to the blocked list as the same list item is used for
 	both lists. */
-	( void ) uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+	#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+	{
+		( void ) uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
 
-	/* The list item will be inserted in wake time order. */
-	listSET_LIST_ITEM_VALUE( &( pxCurrentCoRoutine->xGenericListItem ), xTimeToWake );
+		/* The list item will be inserted in wake time order. */
+		listSET_LIST_ITEM_VALUE( &( pxCurrentCoRoutine->xGenericListItem ), xTimeToWake );
 
-	if( xTimeToWake < xCoRoutineTickCount )
-	{
-		/* Wake time has overflowed.  Place this item in the
-		overflow list. */
-		vListInsert( ( List_t * ) pxOverflowDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+		if( xTimeToWake < xCoRoutineTickCount )
+		{
+			/* Wake time has overflowed.  Place this item in the
+			overflow list. */
+			vListInsert( ( List_t * ) pxOverflowDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+		}
+		else
+		{
+			/* The wake time has not overflowed, so we can use the
+			current block list. */
+			vListInsert( ( List_t * ) pxDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+		}
 	}
-	else
+	#else
 	{
-		/* The wake time has not overflowed, so we can use the
-		current block list. */
-		vListInsert( ( List_t * ) pxDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+		if( uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) ) == ( UBaseType_t ) 0U )
+		{
+			uxCoRoutineReadyPriorities &= ~( ( UBaseType_t ) 1U << pxCurrentCoRoutine->uxPriority );
+		}
+
+		/* The list item is not in any list while the co-routine is delayed,
+		so its value holds the wake time used to order the heap.  A wake time
+		that has overflowed needs no special handling, as the heap is ordered
+		by the ticks left to wait. */
+		listSET_LIST_ITEM_VALUE( &( pxCurrentCoRoutine->xGenericListItem ), xTimeToWake );
+		prvDelayedHeapInsert( ( CRCBExt_t * ) pxCurrentCoRoutine );
 	}
+	#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 
 	if( pxEventList )
 	{
@@ -253,12 +408,23 @@ static void prvCheckPendingReadyList( void )
 		}
 		portENABLE_INTERRUPTS();
 
-		( void ) uxListRemove( &( pxUnblockedCRCB->xGenericListItem ) );
+		#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+		{
+			( void ) uxListRemove( &( pxUnblockedCRCB->xGenericListItem ) );
+		}
+		#else
+		{
+			prvDelayedHeapRemove( ( CRCBExt_t * ) pxUnblockedCRCB );
+		}
+		#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+
 		prvAddCoRoutineToReadyQueue( pxUnblockedCRCB );
 	}
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+
 static void prvCheckDelayedList( void )
 {
 CRCB_t *pxCRCB;
@@ -315,6 +481,60 @@ CRCB_t *pxCRCB;
 
 	xLastTickCount = xCoRoutineTickCount;
 }
+
+#else /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+
+static void prvCheckDelayedList( void )
+{
+CRCBExt_t *pxCRCB;
+
+	/* All the ticks that have passed are accounted for in one step.  Only the
+	co-routines whose wake time has passed are looked at, each in a time
+	bounded by the depth of the heap, so the cost does not depend on how long
+	it is since this was last called. */
+	xPassedTicks = xTaskGetTickCount() - xLastTickCount;
+
+	if( xPassedTicks != ( TickType_t ) 0U )
+	{
+		/* The heap is ordered from the old xCoRoutineTickCount, so every
+		co-routine whose wake time is passed is removed before it is moved
+		on. */
+		while( uxDelayedCoRoutines != ( UBaseType_t ) 0U )
+		{
+			if( corTICKS_TO_WAKE( 0 ) > xPassedTicks )
+			{
+				/* Timeout not yet expired. */
+				break;
+			}
+
+			pxCRCB = pxDelayedCoRoutines[ 0 ];
+			prvDelayedHeapRemove( pxCRCB );
+
+			portDISABLE_INTERRUPTS();
+			{
+				/* The event could have occurred just before this critical
+				section, in which case the event list item is in the pending
+				ready list and is removed from it here.  Clearing the notify
+				state stops a later notification readying the co-routine a
+				second time. */
+				if( pxCRCB->xCRCB.xEventListItem.pvContainer )
+				{
+					( void ) uxListRemove( &( pxCRCB->xCRCB.xEventListItem ) );
+				}
+
+				pxCRCB->ucNotifyState = corNOT_WAITING_NOTIFICATION;
+			}
+			portENABLE_INTERRUPTS();
+
+			prvAddCoRoutineToReadyQueue( ( &( pxCRCB->xCRCB ) ) );
+		}
+
+		xCoRoutineTickCount += xPassedTicks;
+		xLastTickCount = xCoRoutineTickCount;
+	}
+}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 /*-----------------------------------------------------------*/
 
 void vCoRoutineSchedule( void )
@@ -326,15 +546,29 @@ void vCoRoutineSchedule( void )
 	prvCheckDelayedList();
 
 	/* Find the highest priority queue that contains ready co-routines. */
-	while( listLIST_IS_EMPTY( &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) ) )
+	#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
 	{
-		if( uxTopCoRoutineReadyPriority == 0 )
+		while( listLIST_IS_EMPTY( &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) ) )
 		{
-			/* No more co-routines to check. */
+			if( uxTopCoRoutineReadyPriority == 0 )
+			{
+				/* No more co-routines to check. */
+				return;
+			}
+			--uxTopCoRoutineReadyPriority;
+		}
+	}
+	#else
+	{
+		if( uxCoRoutineReadyPriorities == ( UBaseType_t ) 0U )
+		{
+			/* No co-routines are ready. */
 			return;
 		}
-		--uxTopCoRoutineReadyPriority;
+
+		corGET_HIGHEST_PRIORITY( uxTopCoRoutineReadyPriority, uxCoRoutineReadyPriorities );
 	}
+	#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 
 	/* listGET_OWNER_OF_NEXT_ENTRY walks through the list, so the co-routines
 	 of the	same priority get an equal share of the processor time. */
@@ -356,14 +590,19 @@ UBaseType_t uxPriority;
 		vListInitialise( ( List_t * ) &( pxReadyCoRoutineLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( ( List_t * ) &xDelayedCoRoutineList1 );
-	vListInitialise( ( List_t * ) &xDelayedCoRoutineList2 );
 	vListInitialise( ( List_t * ) &xPendingReadyCoRoutineList );
 
-	/* Start with pxDelayedCoRoutineList using list1 and the
-	pxOverflowDelayedCoRoutineList using list2. */
-	pxDelayedCoRoutineList = &xDelayedCoRoutineList1;
-	pxOverflowDelayedCoRoutineList = &xDelayedCoRoutineList2;
+	#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+	{
+		vListInitialise( ( List_t * ) &xDelayedCoRoutineList1 );
+		vListInitialise( ( List_t * ) &xDelayedCoRoutineList2 );
+
+		/* Start with pxDelayedCoRoutineList using list1 and the
+		pxOverflowDelayedCoRoutineList using list2. */
+		pxDelayedCoRoutineList = &xDelayedCoRoutineList1;
+		pxOverflowDelayedCoRoutineList = &xDelayedCoRoutineList2;
+	}
+	#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 }
 /*-----------------------------------------------------------*/
 
@@ -375,9 +614,51 @@ BaseType_t xReturn;
 	/* This function is called from within an interrupt.  It can only access
 	event lists and the pending ready list.  This function assumes that a
 	check has already been made to ensure pxEventList is not empty. */
-	pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
-	( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
-	vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
+	#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 0 )
+	{
+		pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+		( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
+		vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
+	}
+	#else
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		/* Called from interrupts, from co-routines and from tasks through
+		xTaskRemoveFromEventList(), so the lists are accessed with interrupts
+		masked whatever the caller has done. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			/* Tasks waiting on the event list are ordered before co-routines,
+			so if the first is a task it is the one to wake. */
+			if( ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxEventList ) & corEVENT_LIST_ITEM_FLAG ) == ( TickType_t ) 0U )
+			{
+				xHigherPriorityTaskWoken = xTaskRemoveFromEventList( pxEventList );
+				pxUnblockedCRCB = NULL;
+			}
+			else
+			{
+				pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+				( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
+				vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
+				prvWakeCoRoutineScheduler( &xHigherPriorityTaskWoken );
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		/* The co-routine API gives the caller no way to pass on a task
+		switch, so one is pended here.  It is taken once interrupts are no
+		longer masked. */
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+
+		if( pxUnblockedCRCB == NULL )
+		{
+			/* No co-routine was woken. */
+			return pdFALSE;
+		}
+	}
+	#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 
 	if( pxUnblockedCRCB->uxPriority >= pxCurrentCoRoutine->uxPriority )
 	{
@@ -390,6 +671,320 @@ BaseType_t xReturn;
 
 	return xReturn;
 }
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	BaseType_t xCoRoutineCreateSchedulerTask( UBaseType_t uxPriority, uint16_t usStackDepth )
+	{
+	BaseType_t xReturn;
+
+		configASSERT( xCoRoutineSchedulerTask == NULL );
+
+		xReturn = xTaskCreate( prvCoRoutineSchedulerTask, "CoRtn", usStackDepth, NULL, uxPriority, &xCoRoutineSchedulerTask );
+		configASSERT( xReturn );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	static portTASK_FUNCTION( prvCoRoutineSchedulerTask, pvParameters )
+	{
+	TickType_t xTicksToWait;
+
+		/* Just to avoid compiler warnings. */
+		( void ) pvParameters;
+
+		for( ;; )
+		{
+			vCoRoutineSchedule();
+
+			/* Anything that readies a co-routine after the idle time is
+			worked out also notifies this task, so the take then returns
+			straight away rather than missing it. */
+			xTicksToWait = prvCoRoutineIdleTime();
+
+			if( xTicksToWait != ( TickType_t ) 0U )
+			{
+				( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	static TickType_t prvCoRoutineIdleTime( void )
+	{
+	TickType_t xReturn, xPassed;
+
+		if( ( uxCoRoutineReadyPriorities != ( UBaseType_t ) 0U ) || ( listLIST_IS_EMPTY( &xPendingReadyCoRoutineList ) == pdFALSE ) )
+		{
+			xReturn = ( TickType_t ) 0U;
+		}
+		else if( uxDelayedCoRoutines == ( UBaseType_t ) 0U )
+		{
+			xReturn = portMAX_DELAY;
+		}
+		else
+		{
+			/* The first co-routine in the heap is the first to wake. */
+			xPassed = xTaskGetTickCount() - xCoRoutineTickCount;
+
+			if( corTICKS_TO_WAKE( 0 ) <= xPassed )
+			{
+				xReturn = ( TickType_t ) 0U;
+			}
+			else
+			{
+				xReturn = corTICKS_TO_WAKE( 0 ) - xPassed;
+
+				/* portMAX_DELAY would block without a timeout. */
+				if( xReturn == portMAX_DELAY )
+				{
+					xReturn--;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	static void prvWakeCoRoutineScheduler( BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+		/* Co-routines scheduled from the idle hook have no task to wake. */
+		if( xCoRoutineSchedulerTask != NULL )
+		{
+			vTaskNotifyGiveFromISR( xCoRoutineSchedulerTask, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	BaseType_t xCoRoutineNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait, uint32_t *pulNotificationValue )
+	{
+	CRCBExt_t * const pxCRCB = ( CRCBExt_t * ) pxCurrentCoRoutine;
+	BaseType_t xReturn;
+
+		/* A notification can be given from an interrupt. */
+		portDISABLE_INTERRUPTS();
+		{
+			if( ( pxCRCB->ulNotifiedValue == 0UL ) && ( xTicksToWait > ( TickType_t ) 0U ) )
+			{
+				/* Block without an event list.  xCoRoutineNotifyGive() moves
+				the co-routine to the pending ready list instead. */
+				pxCRCB->ucNotifyState = corWAITING_NOTIFICATION;
+				vCoRoutineAddToDelayedList( xTicksToWait, NULL );
+				xReturn = errQUEUE_BLOCKED;
+			}
+			else
+			{
+				pxCRCB->ucNotifyState = corNOT_WAITING_NOTIFICATION;
+				*pulNotificationValue = pxCRCB->ulNotifiedValue;
+
+				if( pxCRCB->ulNotifiedValue != 0UL )
+				{
+					if( xClearCountOnExit != pdFALSE )
+					{
+						pxCRCB->ulNotifiedValue = 0UL;
+					}
+					else
+					{
+						( pxCRCB->ulNotifiedValue )--;
+					}
+
+					xReturn = pdPASS;
+				}
+				else
+				{
+					xReturn = pdFAIL;
+				}
+			}
+		}
+		portENABLE_INTERRUPTS();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	void vCoRoutineNotifyGiveFromISR( CoRoutineHandle_t xCoRoutine, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	CRCBExt_t * const pxCRCB = ( CRCBExt_t * ) xCoRoutine;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( pxCRCB );
+		configASSERT( pxHigherPriorityTaskWoken );
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			( pxCRCB->ulNotifiedValue )++;
+
+			/* The pending ready list is used as it is for an event, as the
+			co-routine is not in an event list while it waits. */
+			if( pxCRCB->ucNotifyState == corWAITING_NOTIFICATION )
+			{
+				pxCRCB->ucNotifyState = corNOT_WAITING_NOTIFICATION;
+				vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxCRCB->xCRCB.xEventListItem ) );
+				prvWakeCoRoutineScheduler( pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	void vCoRoutineNotifyGive( CoRoutineHandle_t xCoRoutine )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		vCoRoutineNotifyGiveFromISR( xCoRoutine, &xHigherPriorityTaskWoken );
+
+		if( xHigherPriorityTaskWoken != pdFALSE )
+		{
+			taskYIELD();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	static void prvDelayedHeapInsert( CRCBExt_t * const pxCRCB )
+	{
+		configASSERT( uxDelayedCoRoutines < ( UBaseType_t ) configMAX_CO_ROUTINES );
+
+		pxDelayedCoRoutines[ uxDelayedCoRoutines ] = pxCRCB;
+		uxDelayedCoRoutines++;
+		prvDelayedHeapSift( uxDelayedCoRoutines - ( UBaseType_t ) 1U );
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	static void prvDelayedHeapRemove( CRCBExt_t * const pxCRCB )
+	{
+	UBaseType_t uxPosition;
+
+		if( pxCRCB->uxDelayedIndex != ( UBaseType_t ) 0U )
+		{
+			uxPosition = pxCRCB->uxDelayedIndex - ( UBaseType_t ) 1U;
+			pxCRCB->uxDelayedIndex = ( UBaseType_t ) 0U;
+			uxDelayedCoRoutines--;
+
+			/* The last co-routine in the heap fills the gap, then is moved to
+			its position. */
+			if( uxPosition < uxDelayedCoRoutines )
+			{
+				pxDelayedCoRoutines[ uxPosition ] = pxDelayedCoRoutines[ uxDelayedCoRoutines ];
+				prvDelayedHeapSift( uxPosition );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	static void prvDelayedHeapSift( UBaseType_t uxPosition )
+	{
+	CRCBExt_t * const pxCRCB = pxDelayedCoRoutines[ uxPosition ];
+	const TickType_t xTicksToWake = corTICKS_TO_WAKE( uxPosition );
+	UBaseType_t uxChild;
+
+		/* Move the co-routine up while it wakes before its parent. */
+		while( ( uxPosition > ( UBaseType_t ) 0U ) && ( xTicksToWake < corTICKS_TO_WAKE( corHEAP_PARENT( uxPosition ) ) ) )
+		{
+			pxDelayedCoRoutines[ uxPosition ] = pxDelayedCoRoutines[ corHEAP_PARENT( uxPosition ) ];
+			pxDelayedCoRoutines[ uxPosition ]->uxDelayedIndex = uxPosition + ( UBaseType_t ) 1U;
+			uxPosition = corHEAP_PARENT( uxPosition );
+		}
+
+		/* Then down while either child wakes before it. */
+		uxChild = corHEAP_CHILD( uxPosition );
+
+		while( uxChild < uxDelayedCoRoutines )
+		{
+			if( ( ( uxChild + ( UBaseType_t ) 1U ) < uxDelayedCoRoutines ) && ( corTICKS_TO_WAKE( uxChild + ( UBaseType_t ) 1U ) < corTICKS_TO_WAKE( uxChild ) ) )
+			{
+				uxChild++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( corTICKS_TO_WAKE( uxChild ) < xTicksToWake )
+			{
+				pxDelayedCoRoutines[ uxPosition ] = pxDelayedCoRoutines[ uxChild ];
+				pxDelayedCoRoutines[ uxPosition ]->uxDelayedIndex = uxPosition + ( UBaseType_t ) 1U;
+				uxPosition = uxChild;
+				uxChild = corHEAP_CHILD( uxPosition );
+			}
+			else
+			{
+				/* The co-routine is in order with both of its children. */
+				uxChild = uxDelayedCoRoutines;
+			}
+		}
+
+		pxDelayedCoRoutines[ uxPosition ] = pxCRCB;
+		pxCRCB->uxDelayedIndex = uxPosition + ( UBaseType_t ) 1U;
+	}
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
 
 #endif /* configUSE_CO_ROUTINES == 0 */
 
@@ -0,0 +1,457 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+#include "port_ext.h"
+#include "cyclic.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the cyclic executive.  Set configUSE_CYCLIC_EXECUTIVE to 1 in
+FreeRTOSConfig.h to include the cyclic executive. */
+#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+
+#if ( configUSE_DYNAMIC_TICK == 1 )
+
+	/* The number of processor cycles in a tick period, used to convert the
+	remaining budget of a slot to ticks. */
+	#define cyclicCYCLES_PER_TICK	( ( uint32_t ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) )
+
+#endif /* configUSE_DYNAMIC_TICK */
+
+/* The schedule table, which is NULL until xCyclicExecutiveStart() is
+called. */
+PRIVILEGED_DATA static const CyclicSlot_t * volatile pxCyclicSchedule = NULL;
+PRIVILEGED_DATA static UBaseType_t uxCyclicNumberOfSlots = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static TickType_t xCyclicMajorFrameTicks = ( TickType_t ) 0U;
+
+/* The position within the major frame, and the index of the next slot to
+start.  Only accessed from the tick interrupt, or by the kernel with
+interrupts masked when the dynamic tick is used. */
+PRIVILEGED_DATA static TickType_t xCyclicFrameTick = ( TickType_t ) 0U;
+PRIVILEGED_DATA static UBaseType_t uxCyclicNextSlot = ( UBaseType_t ) 0U;
+
+/* The slot that started most recently, the cycle count at which it started,
+and whether its task has yet to finish it. */
+PRIVILEGED_DATA static UBaseType_t uxCyclicCurrentSlot = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static uint32_t ulCyclicSlotStartCycles = 0UL;
+PRIVILEGED_DATA static BaseType_t xCyclicSlotActive = pdFALSE;
+
+/* The task that the scheduler runs in preference to all others, which is the
+task of the current slot until it finishes the slot or its budget expires.
+NULL when there is no such task. */
+PRIVILEGED_DATA static TaskHandle_t volatile xCyclicDispatchTask = NULL;
+
+PRIVILEGED_DATA static CyclicStats_t xCyclicStats;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xCyclicExecutiveStart( const CyclicSlot_t * const pxSchedule, UBaseType_t uxNumberOfSlots, TickType_t xMajorFrameTicks )
+{
+BaseType_t xReturn = pdPASS;
+UBaseType_t uxSlot;
+
+	configASSERT( pxSchedule );
+	configASSERT( uxNumberOfSlots > ( UBaseType_t ) 0U );
+
+	/* Check the slots are in order, start within the frame and reference a
+	task. */
+	for( uxSlot = ( UBaseType_t ) 0U; uxSlot < uxNumberOfSlots; uxSlot++ )
+	{
+		if( ( pxSchedule[ uxSlot ].xOffset >= xMajorFrameTicks ) ||
+			( pxSchedule[ uxSlot ].pxTask == NULL ) ||
+			( *( pxSchedule[ uxSlot ].pxTask ) == NULL ) ||
+			( ( uxSlot > ( UBaseType_t ) 0U ) && ( pxSchedule[ uxSlot ].xOffset <= pxSchedule[ uxSlot - ( UBaseType_t ) 1U ].xOffset ) ) )
+		{
+			xReturn = pdFAIL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	configASSERT( xReturn );
+
+	if( xReturn != pdFAIL )
+	{
+		portENABLE_CYCLE_COUNTER();
+
+		taskENTER_CRITICAL();
+		{
+			if( pxCyclicSchedule == NULL )
+			{
+				uxCyclicNumberOfSlots = uxNumberOfSlots;
+				xCyclicMajorFrameTicks = xMajorFrameTicks;
+				xCyclicFrameTick = ( TickType_t ) 0U;
+				uxCyclicNextSlot = ( UBaseType_t ) 0U;
+				xCyclicSlotActive = pdFALSE;
+				xCyclicDispatchTask = NULL;
+				( void ) memset( ( void * ) &xCyclicStats, 0x00, sizeof( xCyclicStats ) );
+
+				/* Setting the table last makes the executive active from the
+				next tick. */
+				pxCyclicSchedule = pxSchedule;
+
+				#if ( configUSE_DYNAMIC_TICK == 1 )
+				{
+					/* The first slot may be due before the tick interrupt
+					that is currently programmed. */
+					vPortDynamicTickUpdate();
+				}
+				#endif /* configUSE_DYNAMIC_TICK */
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xCyclicExecutiveTick( void )
+{
+BaseType_t xSwitchRequired = pdFALSE;
+const CyclicSlot_t *pxSlot;
+
+	if( pxCyclicSchedule != NULL )
+	{
+		/* A slot that has used up its budget is counted as an overrun at the
+		first tick after the budget expires, while its task is still running.
+		Its task then loses its hold on the processor and continues at its own
+		priority. */
+		if( xCyclicDispatchTask != NULL )
+		{
+			pxSlot = &( pxCyclicSchedule[ uxCyclicCurrentSlot ] );
+
+			if( ( pxSlot->ulBudgetCycles != 0UL ) && ( ( portGET_CYCLE_COUNT() - ulCyclicSlotStartCycles ) > pxSlot->ulBudgetCycles ) )
+			{
+				( xCyclicStats.ulBudgetOverruns )++;
+				xCyclicStats.uxLastOverrunSlot = uxCyclicCurrentSlot;
+				xCyclicDispatchTask = NULL;
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxSlot = &( pxCyclicSchedule[ uxCyclicNextSlot ] );
+
+		if( xCyclicFrameTick == pxSlot->xOffset )
+		{
+			/* The slot that started before this one should have finished by
+			now. */
+			if( xCyclicSlotActive != pdFALSE )
+			{
+				( xCyclicStats.ulSlotOverruns )++;
+				xCyclicStats.uxLastOverrunSlot = uxCyclicCurrentSlot;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			uxCyclicCurrentSlot = uxCyclicNextSlot;
+			ulCyclicSlotStartCycles = portGET_CYCLE_COUNT();
+			xCyclicSlotActive = pdTRUE;
+
+			/* The slot task is released, and is run by the scheduler whatever
+			its priority, so a context switch is always needed. */
+			xCyclicDispatchTask = *( pxSlot->pxTask );
+			vTaskNotifyGiveFromISR( xCyclicDispatchTask, NULL );
+			xSwitchRequired = pdTRUE;
+
+			uxCyclicNextSlot++;
+			if( uxCyclicNextSlot >= uxCyclicNumberOfSlots )
+			{
+				uxCyclicNextSlot = ( UBaseType_t ) 0U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xCyclicFrameTick++;
+		if( xCyclicFrameTick >= xCyclicMajorFrameTicks )
+		{
+			xCyclicFrameTick = ( TickType_t ) 0U;
+			( xCyclicStats.ulFramesCompleted )++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DYNAMIC_TICK == 1 )
+
+	TickType_t xCyclicExecutiveTicksToNextEvent( void )
+	{
+	TickType_t xReturn, xBudgetTicks;
+	uint32_t ulSlotCycles, ulBudgetCycles;
+
+		if( pxCyclicSchedule != NULL )
+		{
+			/* xCyclicExecutiveTick() starts the slot on the tick at which the
+			frame position equals the slot offset, before advancing it. */
+			xReturn = ( ( pxCyclicSchedule[ uxCyclicNextSlot ].xOffset + xCyclicMajorFrameTicks ) - xCyclicFrameTick ) % xCyclicMajorFrameTicks;
+			xReturn++;
+
+			/* The budget of a slot is checked on the first tick after it
+			expires.  Measuring from the current time can make that tick up to
+			one early, in which case the budget is checked again later. */
+			if( xCyclicDispatchTask != NULL )
+			{
+				ulBudgetCycles = pxCyclicSchedule[ uxCyclicCurrentSlot ].ulBudgetCycles;
+				ulSlotCycles = portGET_CYCLE_COUNT() - ulCyclicSlotStartCycles;
+
+				if( ulBudgetCycles == 0UL )
+				{
+					xBudgetTicks = portMAX_DELAY;
+				}
+				else if( ulSlotCycles >= ulBudgetCycles )
+				{
+					xBudgetTicks = ( TickType_t ) 1U;
+				}
+				else
+				{
+					xBudgetTicks = ( TickType_t ) ( ( ulBudgetCycles - ulSlotCycles ) / cyclicCYCLES_PER_TICK ) + ( TickType_t ) 1U;
+				}
+
+				if( xBudgetTicks < xReturn )
+				{
+					xReturn = xBudgetTicks;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xReturn = portMAX_DELAY;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DYNAMIC_TICK == 1 )
+
+	void vCyclicExecutiveStepTicks( TickType_t xTicks )
+	{
+		if( pxCyclicSchedule != NULL )
+		{
+			configASSERT( xTicks < xCyclicExecutiveTicksToNextEvent() );
+
+			while( xTicks >= ( xCyclicMajorFrameTicks - xCyclicFrameTick ) )
+			{
+				xTicks -= ( xCyclicMajorFrameTicks - xCyclicFrameTick );
+				xCyclicFrameTick = ( TickType_t ) 0U;
+				( xCyclicStats.ulFramesCompleted )++;
+			}
+
+			xCyclicFrameTick += xTicks;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*-----------------------------------------------------------*/
+
+void vCyclicWaitForSlot( void )
+{
+uint32_t ulSlotCycles;
+const CyclicSlot_t *pxSlot;
+
+	taskENTER_CRITICAL();
+	{
+		/* A task that calls this function before its first slot, or after it
+		has been released late, may not be the task of the current slot. */
+		if( ( xCyclicSlotActive != pdFALSE ) && ( pxCyclicSchedule != NULL ) )
+		{
+			pxSlot = &( pxCyclicSchedule[ uxCyclicCurrentSlot ] );
+
+			if( *( pxSlot->pxTask ) == xTaskGetCurrentTaskHandle() )
+			{
+				ulSlotCycles = portGET_CYCLE_COUNT() - ulCyclicSlotStartCycles;
+				xCyclicSlotActive = pdFALSE;
+
+				if( ulSlotCycles > xCyclicStats.ulWorstSlotCycles )
+				{
+					xCyclicStats.ulWorstSlotCycles = ulSlotCycles;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* A budget that expired between ticks has not been counted by
+				the tick interrupt yet.  The task no longer needs to be run in
+				preference to the others either way. */
+				if( ( xCyclicDispatchTask != NULL ) && ( pxSlot->ulBudgetCycles != 0UL ) && ( ulSlotCycles > pxSlot->ulBudgetCycles ) )
+				{
+					( xCyclicStats.ulBudgetOverruns )++;
+					xCyclicStats.uxLastOverrunSlot = uxCyclicCurrentSlot;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xCyclicDispatchTask = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	/* Wait to be released by the tick interrupt at the start of the next slot
+	that runs this task.  If that slot has already started the notification is
+	pending and the task does not block. */
+	( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xCyclicExecutiveGetDispatchTask( void )
+{
+	return xCyclicDispatchTask;
+}
+/*-----------------------------------------------------------*/
+
+void vCyclicExecutiveGetStats( CyclicStats_t * const pxStats )
+{
+	configASSERT( pxStats );
+
+	taskENTER_CRITICAL();
+	{
+		*pxStats = xCyclicStats;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include the cyclic executive.  If you want to include the cyclic executive
+then ensure configUSE_CYCLIC_EXECUTIVE is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_CYCLIC_EXECUTIVE == 1 */
@@ -0,0 +1,372 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+#include "port_ext.h"
+#include "fasttimer.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include fast timers.  Set configUSE_FAST_TIMERS to 1 in FreeRTOSConfig.h to
+include fast timers. */
+#if ( configUSE_FAST_TIMERS == 1 )
+
+/* The position of the parent and first child of a position in the heap of
+active fast timers. */
+#define fasttimerHEAP_PARENT( uxPosition )	( ( ( uxPosition ) - ( UBaseType_t ) 1U ) >> 1 )
+#define fasttimerHEAP_CHILD( uxPosition )	( ( ( uxPosition ) << 1 ) + ( UBaseType_t ) 1U )
+
+/* The active fast timers, held as a binary heap ordered by expiry time so the
+first to expire is always at position 0.  Starting, stopping and expiring a
+timer are all bounded by the depth of the heap.  Only accessed with interrupts
+masked. */
+PRIVILEGED_DATA static FastTimer_t *pxActiveFastTimers[ configFAST_TIMER_MAX_ACTIVE ];
+PRIVILEGED_DATA static UBaseType_t uxActiveFastTimers = ( UBaseType_t ) 0U;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Add a timer to, or remove a timer from, the heap of active timers.  Called
+ * with interrupts masked.  The heap must have room for a timer that is added.
+ */
+static void prvFastTimerHeapInsert( FastTimer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+static void prvFastTimerHeapRemove( FastTimer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move the timer at uxPosition in the heap up or down until it is in expiry
+ * time order with its parent and children.  Called with interrupts masked.
+ */
+static void prvFastTimerHeapSift( UBaseType_t uxPosition ) PRIVILEGED_FUNCTION;
+
+/*
+ * Set the compare to the expiry time of the first active timer.  Called with
+ * interrupts masked.
+ */
+static void prvSetFastTimerAlarm( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vFastTimerInitialise( FastTimer_t * const pxTimer, FastTimerCallback_t pxCallback, void * const pvParameter )
+{
+	configASSERT( pxTimer );
+	configASSERT( pxCallback );
+
+	pxTimer->uxHeapIndex = ( UBaseType_t ) 0U;
+	pxTimer->ullExpiryTime = 0ULL;
+	pxTimer->ulPeriod = 0UL;
+	pxTimer->pxCallback = pxCallback;
+	pxTimer->pvParameter = pvParameter;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastTimerStart( FastTimer_t * const pxTimer, const uint64_t ullExpiryTime, const uint32_t ulPeriod )
+{
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xReturn = pdPASS;
+
+	configASSERT( pxTimer );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( pxTimer->uxHeapIndex != ( UBaseType_t ) 0U )
+		{
+			/* Restarting a timer only moves it within the heap. */
+			pxTimer->ullExpiryTime = ullExpiryTime;
+			pxTimer->ulPeriod = ulPeriod;
+			prvFastTimerHeapSift( pxTimer->uxHeapIndex - ( UBaseType_t ) 1U );
+		}
+		else if( uxActiveFastTimers < ( UBaseType_t ) configFAST_TIMER_MAX_ACTIVE )
+		{
+			pxTimer->ullExpiryTime = ullExpiryTime;
+			pxTimer->ulPeriod = ulPeriod;
+			prvFastTimerHeapInsert( pxTimer );
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* Only a timer that is now first changes the compare. */
+		if( pxActiveFastTimers[ 0 ] == pxTimer )
+		{
+			prvSetFastTimerAlarm();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vFastTimerStop( FastTimer_t * const pxTimer )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxTimer );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* The compare is left set if the stopped timer was the first, as the
+		interrupt finds nothing to do and moves the compare on. */
+		prvFastTimerHeapRemove( pxTimer );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastTimerIsActive( FastTimer_t * const pxTimer )
+{
+BaseType_t xReturn;
+
+	configASSERT( pxTimer );
+
+	/* A single read of the heap index, so no critical section is needed. */
+	if( pxTimer->uxHeapIndex != ( UBaseType_t ) 0U )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastTimerAlarm( void )
+{
+FastTimer_t *pxTimer;
+uint64_t ullNow;
+BaseType_t xSwitchRequired = pdFALSE;
+UBaseType_t uxSavedInterruptStatus;
+
+	/* The mask is held across the callbacks, as described in fasttimer.h. */
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		ullNow = ullPortGetMicroseconds();
+
+		/* The first timer in the heap is the first to expire, so the search
+		ends at the first timer that has not expired.  Each timer is taken
+		from the top of the heap afresh, as a callback can start or stop any
+		timer. */
+		while( uxActiveFastTimers != ( UBaseType_t ) 0U )
+		{
+			pxTimer = pxActiveFastTimers[ 0 ];
+
+			if( pxTimer->ullExpiryTime > ullNow )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* An auto reload timer is reloaded relative to the time it should
+			have expired, before its callback runs so the callback can still
+			stop it.  It stays in the heap, so cannot be lost for want of room.
+			If it has fallen more than a period behind it expires again within
+			this loop. */
+			if( pxTimer->ulPeriod != 0UL )
+			{
+				pxTimer->ullExpiryTime += ( uint64_t ) pxTimer->ulPeriod;
+				prvFastTimerHeapSift( ( UBaseType_t ) 0U );
+			}
+			else
+			{
+				prvFastTimerHeapRemove( pxTimer );
+			}
+
+			pxTimer->pxCallback( pxTimer, &xSwitchRequired );
+		}
+
+		prvSetFastTimerAlarm();
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFastTimerHeapInsert( FastTimer_t * const pxTimer )
+{
+	configASSERT( uxActiveFastTimers < ( UBaseType_t ) configFAST_TIMER_MAX_ACTIVE );
+
+	pxActiveFastTimers[ uxActiveFastTimers ] = pxTimer;
+	uxActiveFastTimers++;
+	prvFastTimerHeapSift( uxActiveFastTimers - ( UBaseType_t ) 1U );
+}
+/*-----------------------------------------------------------*/
+
+static void prvFastTimerHeapRemove( FastTimer_t * const pxTimer )
+{
+UBaseType_t uxPosition;
+
+	if( pxTimer->uxHeapIndex != ( UBaseType_t ) 0U )
+	{
+		uxPosition = pxTimer->uxHeapIndex - ( UBaseType_t ) 1U;
+		pxTimer->uxHeapIndex = ( UBaseType_t ) 0U;
+		uxActiveFastTimers--;
+
+		/* The last timer in the heap fills the gap, then is moved to its
+		position. */
+		if( uxPosition < uxActiveFastTimers )
+		{
+			pxActiveFastTimers[ uxPosition ] = pxActiveFastTimers[ uxActiveFastTimers ];
+			prvFastTimerHeapSift( uxPosition );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFastTimerHeapSift( UBaseType_t uxPosition )
+{
+FastTimer_t * const pxTimer = pxActiveFastTimers[ uxPosition ];
+UBaseType_t uxChild;
+
+	/* Move the timer up while it expires before its parent. */
+	while( ( uxPosition > ( UBaseType_t ) 0U ) && ( pxTimer->ullExpiryTime < pxActiveFastTimers[ fasttimerHEAP_PARENT( uxPosition ) ]->ullExpiryTime ) )
+	{
+		pxActiveFastTimers[ uxPosition ] = pxActiveFastTimers[ fasttimerHEAP_PARENT( uxPosition ) ];
+		pxActiveFastTimers[ uxPosition ]->uxHeapIndex = uxPosition + ( UBaseType_t ) 1U;
+		uxPosition = fasttimerHEAP_PARENT( uxPosition );
+	}
+
+	/* Then down while either child expires before it. */
+	uxChild = fasttimerHEAP_CHILD( uxPosition );
+
+	while( uxChild < uxActiveFastTimers )
+	{
+		if( ( ( uxChild + ( UBaseType_t ) 1U ) < uxActiveFastTimers ) && ( pxActiveFastTimers[ uxChild + ( UBaseType_t ) 1U ]->ullExpiryTime < pxActiveFastTimers[ uxChild ]->ullExpiryTime ) )
+		{
+			uxChild++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pxActiveFastTimers[ uxChild ]->ullExpiryTime < pxTimer->ullExpiryTime )
+		{
+			pxActiveFastTimers[ uxPosition ] = pxActiveFastTimers[ uxChild ];
+			pxActiveFastTimers[ uxPosition ]->uxHeapIndex = uxPosition + ( UBaseType_t ) 1U;
+			uxPosition = uxChild;
+			uxChild = fasttimerHEAP_CHILD( uxPosition );
+		}
+		else
+		{
+			/* The timer is in order with both of its children. */
+			uxChild = uxActiveFastTimers;
+		}
+	}
+
+	pxActiveFastTimers[ uxPosition ] = pxTimer;
+	pxTimer->uxHeapIndex = uxPosition + ( UBaseType_t ) 1U;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetFastTimerAlarm( void )
+{
+	if( uxActiveFastTimers != ( UBaseType_t ) 0U )
+	{
+		vPortSetFastTimerAlarm( pxActiveFastTimers[ 0 ]->ullExpiryTime );
+	}
+	else
+	{
+		vPortSetFastTimerAlarm( portMICROSECOND_NO_ALARM );
+	}
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include fast timers.  If you want to include fast timers then ensure
+configUSE_FAST_TIMERS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_FAST_TIMERS == 1 */
@@ -0,0 +1,492 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ipc.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include IPC functionality.  Set configUSE_IPC to 1 in FreeRTOSConfig.h to
+include IPC endpoints. */
+#if ( configUSE_IPC == 1 )
+
+/* The states a call passes through.  A call is pending while it is held on
+the endpoint, accepted once a server has taken it, and replied once the
+server has called vIpcReply(). */
+#define ipcCALL_PENDING		( ( BaseType_t ) 0 )
+#define ipcCALL_ACCEPTED	( ( BaseType_t ) 1 )
+#define ipcCALL_REPLIED		( ( BaseType_t ) 2 )
+
+/*
+ * Definition of an IPC endpoint.
+ */
+typedef struct IpcEndpointDefinition
+{
+	List_t xServersWaiting;			/*< List of server tasks that are blocked waiting for a call.  Stored in priority order. */
+	List_t xPendingCalls;			/*< List of calls that have not yet been accepted by a server.  Stored in client priority order. */
+} IpcEndpoint_t;
+
+/*
+ * A call in progress.  The structure is held on the client's stack for the
+ * duration of xIpcCall(), and the client blocks on its own reply list so the
+ * server can unblock it without searching for it.
+ */
+typedef struct IpcCallDefinition
+{
+	ListItem_t xPendingListItem;	/*< Used to hold the call in the endpoint's pending call list. */
+	ListItem_t xDonationListItem;	/*< Records the priority donated to the server that accepts the call, until the server replies. */
+	List_t xReplyList;				/*< The event list the client blocks on.  Only the client is ever placed in it. */
+	void *pvRequest;				/*< The request passed to xIpcCall(). */
+	void *pvReply;					/*< The reply passed to vIpcReply(). */
+	UBaseType_t uxClientPriority;	/*< The priority donated to the server that accepts the call. */
+	volatile BaseType_t xState;		/*< One of the ipcCALL_ states. */
+} IpcCall_t;
+
+/*
+ * A server that blocks on an endpoint places one of these on its own stack,
+ * and points the event data held in its TCB at it.  A client that finds the
+ * server waiting writes its call into the structure before unblocking the
+ * server.
+ */
+typedef struct IpcReceiver
+{
+	IpcCall_t * volatile pxCall;	/*< The call handed to the server, or NULL if none has been. */
+} IpcReceiver_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Waits for the server that accepted pxCall to reply.  Called with the
+ * scheduler suspended, which it resumes.
+ */
+static void prvWaitForReply( IpcCall_t * const pxCall ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+IpcEndpointHandle_t xIpcEndpointCreate( void )
+{
+IpcEndpoint_t *pxNewEndpoint;
+
+	pxNewEndpoint = ( IpcEndpoint_t * ) pvPortMalloc( sizeof( IpcEndpoint_t ) );
+
+	if( pxNewEndpoint != NULL )
+	{
+		vListInitialise( &( pxNewEndpoint->xServersWaiting ) );
+		vListInitialise( &( pxNewEndpoint->xPendingCalls ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( pxNewEndpoint );
+	return ( IpcEndpointHandle_t ) pxNewEndpoint;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIpcCall( IpcEndpointHandle_t xEndpoint, void *pvRequest, void **ppvReply, TickType_t xTicksToWait )
+{
+IpcEndpoint_t * const pxEndpoint = ( IpcEndpoint_t * ) xEndpoint;
+IpcCall_t xCall;
+IpcReceiver_t *pxReceiver;
+TaskHandle_t xServer;
+
+	configASSERT( pxEndpoint );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED );
+	}
+	#endif
+
+	xCall.pvRequest = pvRequest;
+	xCall.pvReply = NULL;
+	xCall.uxClientPriority = uxTaskPriorityGet( NULL );
+	vListInitialise( &( xCall.xReplyList ) );
+	vListInitialiseItem( &( xCall.xPendingListItem ) );
+	listSET_LIST_ITEM_OWNER( &( xCall.xPendingListItem ), &xCall );
+	vListInitialiseItem( &( xCall.xDonationListItem ) );
+	listSET_LIST_ITEM_OWNER( &( xCall.xDonationListItem ), &xCall );
+
+	/* Endpoints cannot be accessed from interrupts, so suspending the
+	scheduler is enough to prevent the endpoint's lists changing.  As with the
+	queue implementation, this function relaxes the coding standard somewhat to
+	allow return statements within the function itself. */
+	vTaskSuspendAll();
+
+	if( listLIST_IS_EMPTY( &( pxEndpoint->xServersWaiting ) ) == pdFALSE )
+	{
+		/* A server is already waiting.  Hand the call straight to the highest
+		priority waiting server, lend it the calling task's priority, and
+		arrange for the context switch that occurs when the calling task blocks
+		below to go directly to the server. */
+		xServer = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxEndpoint->xServersWaiting ) );
+		pxReceiver = ( IpcReceiver_t * ) pvTaskGetEventData( xServer );
+		configASSERT( pxReceiver );
+
+		xCall.xState = ipcCALL_ACCEPTED;
+		pxReceiver->pxCall = &xCall;
+
+		/* The pending ready list, onto which the server is moved while the
+		scheduler is suspended, can only be accessed from a critical
+		section. */
+		taskENTER_CRITICAL();
+		{
+			( void ) xTaskRemoveFromEventList( &( pxEndpoint->xServersWaiting ) );
+			vTaskPriorityDonate( xServer, &( xCall.xDonationListItem ), xCall.uxClientPriority );
+		}
+		taskEXIT_CRITICAL();
+
+		vTaskHandoffTo( xServer );
+	}
+	else if( xTicksToWait == ( TickType_t ) 0 )
+	{
+		/* No server is waiting and no block time is specified so leave
+		now. */
+		( void ) xTaskResumeAll();
+		return pdFAIL;
+	}
+	else
+	{
+		/* Hold the call on the endpoint until a server arrives to accept it.
+		The list item value is inverted so the highest priority client is at
+		the head of the list. */
+		xCall.xState = ipcCALL_PENDING;
+		listSET_LIST_ITEM_VALUE( &( xCall.xPendingListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) xCall.uxClientPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		vListInsert( &( pxEndpoint->xPendingCalls ), &( xCall.xPendingListItem ) );
+
+		vTaskPlaceOnEventList( &( xCall.xReplyList ), xTicksToWait );
+
+		if( xTaskResumeAll() == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskSuspendAll();
+
+		if( xCall.xState == ipcCALL_PENDING )
+		{
+			/* No server accepted the call before the block time expired. */
+			( void ) uxListRemove( &( xCall.xPendingListItem ) );
+			( void ) xTaskResumeAll();
+			return pdFAIL;
+		}
+		else
+		{
+			/* The call has been accepted, and possibly already replied to.
+			The block time only applies until the call is accepted. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	prvWaitForReply( &xCall );
+
+	if( ppvReply != NULL )
+	{
+		*ppvReply = xCall.pvReply;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitForReply( IpcCall_t * const pxCall )
+{
+	/* The scheduler is already suspended on entry, so the state cannot change
+	between it being checked and the task being placed on the reply list.  If
+	INCLUDE_vTaskSuspend is not 1 the task will periodically time out and go
+	around the loop again. */
+	while( pxCall->xState != ipcCALL_REPLIED )
+	{
+		vTaskPlaceOnEventList( &( pxCall->xReplyList ), portMAX_DELAY );
+
+		if( xTaskResumeAll() == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskSuspendAll();
+	}
+
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIpcReceive( IpcEndpointHandle_t xEndpoint, void **ppvRequest, IpcCallHandle_t *pxCall, TickType_t xTicksToWait )
+{
+IpcEndpoint_t * const pxEndpoint = ( IpcEndpoint_t * ) xEndpoint;
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+IpcReceiver_t xReceiver;
+IpcCall_t *pxAccepted;
+
+	configASSERT( pxEndpoint );
+	configASSERT( ppvRequest );
+	configASSERT( pxCall );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	for( ;; )
+	{
+		vTaskSuspendAll();
+		{
+			if( listLIST_IS_EMPTY( &( pxEndpoint->xPendingCalls ) ) == pdFALSE )
+			{
+				/* Accept the highest priority pending call, and take on the
+				priority of the client that made it. */
+				pxAccepted = ( IpcCall_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxEndpoint->xPendingCalls ) );
+				( void ) uxListRemove( &( pxAccepted->xPendingListItem ) );
+				pxAccepted->xState = ipcCALL_ACCEPTED;
+
+				taskENTER_CRITICAL();
+				{
+					vTaskPriorityDonate( NULL, &( pxAccepted->xDonationListItem ), pxAccepted->uxClientPriority );
+				}
+				taskEXIT_CRITICAL();
+
+				( void ) xTaskResumeAll();
+
+				*ppvRequest = pxAccepted->pvRequest;
+				*pxCall = ( IpcCallHandle_t ) pxAccepted;
+				return pdPASS;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* No call is pending and no block time is specified (or the
+				block time has expired) so leave now. */
+				( void ) xTaskResumeAll();
+				return pdFAIL;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			xReceiver.pxCall = NULL;
+			vTaskSetEventData( &xReceiver );
+			vTaskPlaceOnEventList( &( pxEndpoint->xServersWaiting ), xTicksToWait );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The task is no longer referenced from the event list, either
+			because a client handed it a call or because the block time
+			expired, so its event data can no longer be accessed. */
+			vTaskSetEventData( NULL );
+
+			if( xReceiver.pxCall != NULL )
+			{
+				/* The client has already donated its priority. */
+				*ppvRequest = xReceiver.pxCall->pvRequest;
+				*pxCall = ( IpcCallHandle_t ) xReceiver.pxCall;
+				return pdPASS;
+			}
+			else
+			{
+				/* Timed out - go around the loop again to check for a pending
+				call one last time before returning. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* The timeout has expired. */
+			( void ) xTaskResumeAll();
+			return pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vIpcReply( IpcCallHandle_t xCall, void *pvReply )
+{
+IpcCall_t * const pxCall = ( IpcCall_t * ) xCall;
+BaseType_t xYieldRequired;
+TaskHandle_t xClient = NULL;
+
+	configASSERT( pxCall );
+	configASSERT( pxCall->xState == ipcCALL_ACCEPTED );
+
+	vTaskSuspendAll();
+	{
+		pxCall->pvReply = pvReply;
+		pxCall->xState = ipcCALL_REPLIED;
+
+		/* The client is normally blocked on its reply list, but may not be if
+		its block time expired after the call was accepted and it has not yet
+		run to block again.  In that case it will see the reply when it
+		does. */
+		if( listLIST_IS_EMPTY( &( pxCall->xReplyList ) ) == pdFALSE )
+		{
+			xClient = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxCall->xReplyList ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Unblock the client and give back the priority it donated. */
+		taskENTER_CRITICAL();
+		{
+			if( xClient != NULL )
+			{
+				( void ) xTaskRemoveFromEventList( &( pxCall->xReplyList ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xYieldRequired = xTaskPriorityRestore( &( pxCall->xDonationListItem ) );
+		}
+		taskEXIT_CRITICAL();
+
+		/* Switch directly to the client at the next context switch, which
+		will be when this task blocks waiting for its next call, if it has not
+		already dropped below the client's priority. */
+		if( xClient != NULL )
+		{
+			vTaskHandoffTo( xClient );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( ( xTaskResumeAll() == pdFALSE ) && ( xYieldRequired != pdFALSE ) )
+	{
+		portYIELD_WITHIN_API();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vIpcEndpointDelete( IpcEndpointHandle_t xEndpoint )
+{
+IpcEndpoint_t * const pxEndpoint = ( IpcEndpoint_t * ) xEndpoint;
+
+	configASSERT( pxEndpoint );
+
+	/* Tasks blocked on the endpoint would be left referencing freed
+	memory. */
+	configASSERT( listLIST_IS_EMPTY( &( pxEndpoint->xServersWaiting ) ) != pdFALSE );
+	configASSERT( listLIST_IS_EMPTY( &( pxEndpoint->xPendingCalls ) ) != pdFALSE );
+
+	vPortFree( pxEndpoint );
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include IPC functionality.  If you want to include IPC functionality then
+ensure configUSE_IPC is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_IPC == 1 */
@@ -0,0 +1,473 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "port_ext.h"
+#include "lightmutex.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include lightweight mutexes.  Set configUSE_LIGHT_MUTEXES to 1 in
+FreeRTOSConfig.h to include lightweight mutexes. */
+#if ( configUSE_LIGHT_MUTEXES == 1 )
+
+/* The owner word holds the handle of the task that holds the mutex, or 0 if
+the mutex is available.  Task control blocks are at least word aligned, so
+the bottom bit of a handle is always clear and is used to record that a task
+might be blocked on the mutex.  While it is set the holder's give cannot use
+the fast path. */
+#define lightmutexWAITERS_BIT		( ( uint32_t ) 0x00000001UL )
+#define lightmutexOWNER_MASK		( ~lightmutexWAITERS_BIT )
+
+#if( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define lightmutexYIELD_IF_USING_PREEMPTION()
+#else
+	#define lightmutexYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/*
+ * Definition of a lightweight mutex.
+ */
+typedef struct LightMutexDefinition
+{
+	volatile uint32_t ulOwner;		/*< The holder's handle, plus lightmutexWAITERS_BIT.  Only ever updated using ulPortAtomicCompareAndSwap(), or from within a critical section. */
+	UBaseType_t uxRecursiveCallCount;/*< The number of times the holder has taken the mutex recursively.  Only accessed by the holder. */
+	List_t xTasksWaitingToTake;		/*< List of tasks that are blocked waiting to take the mutex.  Stored in priority order. */
+
+	#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+		ListItem_t xContendedMutexListItem;	/*< Used to reference the mutex from the holder while tasks are waiting for it. */
+	#endif
+} LightMutex_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by xLightMutexTake() when the mutex could not be claimed with a
+ * single compare and swap.  Blocks the calling task, with priority
+ * inheritance, until the mutex is claimed or xTicksToWait expires.
+ */
+static BaseType_t prvTakeContended( LightMutex_t * const pxMutex, const uint32_t ulCurrentTask, TickType_t xTicksToWait );
+
+/*-----------------------------------------------------------*/
+
+LightMutexHandle_t xLightMutexCreate( void )
+{
+LightMutex_t *pxNewMutex;
+
+	pxNewMutex = ( LightMutex_t * ) pvPortMalloc( sizeof( LightMutex_t ) );
+
+	if( pxNewMutex != NULL )
+	{
+		pxNewMutex->ulOwner = 0UL;
+		pxNewMutex->uxRecursiveCallCount = ( UBaseType_t ) 0U;
+		vListInitialise( &( pxNewMutex->xTasksWaitingToTake ) );
+
+		#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+		{
+			vListInitialiseItem( &( pxNewMutex->xContendedMutexListItem ) );
+			listSET_LIST_ITEM_OWNER( &( pxNewMutex->xContendedMutexListItem ), &( pxNewMutex->xTasksWaitingToTake ) );
+		}
+		#endif
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( pxNewMutex );
+	return ( LightMutexHandle_t ) pxNewMutex;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xLightMutexTake( LightMutexHandle_t xMutex, TickType_t xTicksToWait )
+{
+LightMutex_t * const pxMutex = ( LightMutex_t * ) xMutex;
+const uint32_t ulCurrentTask = ( uint32_t ) xTaskGetCurrentTaskHandle(); /*lint !e923 Task handles are 32-bit pointers on this port. */
+
+	configASSERT( pxMutex );
+
+	/* Taking a mutex that is already held by the calling task would
+	deadlock. */
+	configASSERT( ( pxMutex->ulOwner & lightmutexOWNER_MASK ) != ulCurrentTask );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* The uncontended case.  The mutex is counted as held by the task in the
+	same way as a semphr.h mutex, so inherited priorities are only returned
+	once all the mutexes of either type have been given back. */
+	if( ulPortAtomicCompareAndSwap( &( pxMutex->ulOwner ), 0UL, ulCurrentTask ) == 0UL )
+	{
+		( void ) pvTaskIncrementMutexHeldCount();
+		return pdTRUE;
+	}
+	else
+	{
+		return prvTakeContended( pxMutex, ulCurrentTask, xTicksToWait );
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xLightMutexGive( LightMutexHandle_t xMutex )
+{
+LightMutex_t * const pxMutex = ( LightMutex_t * ) xMutex;
+const uint32_t ulCurrentTask = ( uint32_t ) xTaskGetCurrentTaskHandle(); /*lint !e923 Task handles are 32-bit pointers on this port. */
+uint32_t ulFound;
+BaseType_t xYieldRequired = pdFALSE;
+
+	configASSERT( pxMutex );
+
+	/* The uncontended case.  The swap only succeeds if the calling task holds
+	the mutex and no task has marked itself as waiting. */
+	ulFound = ulPortAtomicCompareAndSwap( &( pxMutex->ulOwner ), ulCurrentTask, 0UL );
+
+	if( ulFound == ulCurrentTask )
+	{
+		xYieldRequired = xTaskDecrementMutexHeldCount();
+	}
+	else if( ( ulFound & lightmutexOWNER_MASK ) != ulCurrentTask )
+	{
+		/* The calling task is not the holder. */
+		return pdFALSE;
+	}
+	else
+	{
+		/* A task might be blocked on the mutex.  Unblock the highest priority
+		waiting task, which will claim the mutex when it runs unless a higher
+		priority task claims it first, and return any inherited priority. */
+		taskENTER_CRITICAL();
+		{
+			if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+			{
+				if( xTaskRemoveFromEventList( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE )
+				{
+					xYieldRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The tasks that set the waiters bit have since timed out. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The waiters bit stays set for as long as any task remains
+			blocked. */
+			if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+			{
+				pxMutex->ulOwner = lightmutexWAITERS_BIT;
+			}
+			else
+			{
+				pxMutex->ulOwner = 0UL;
+			}
+
+			#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			{
+				vTaskRemoveContendedMutex( &( pxMutex->xContendedMutexListItem ) );
+			}
+			#endif
+
+			if( xTaskPriorityDisinherit( ( TaskHandle_t ) ulCurrentTask ) != pdFALSE ) /*lint !e923 Task handles are 32-bit pointers on this port. */
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	if( xYieldRequired != pdFALSE )
+	{
+		lightmutexYIELD_IF_USING_PREEMPTION();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+
+	BaseType_t xLightMutexTakeRecursive( LightMutexHandle_t xMutex, TickType_t xTicksToWait )
+	{
+	LightMutex_t * const pxMutex = ( LightMutex_t * ) xMutex;
+	BaseType_t xReturn;
+
+		configASSERT( pxMutex );
+
+		/* Only the holder can write its own handle into the owner word, so if
+		the calling task sees its own handle there it cannot change. */
+		if( ( pxMutex->ulOwner & lightmutexOWNER_MASK ) == ( uint32_t ) xTaskGetCurrentTaskHandle() ) /*lint !e923 Task handles are 32-bit pointers on this port. */
+		{
+			( pxMutex->uxRecursiveCallCount )++;
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = xLightMutexTake( xMutex, xTicksToWait );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_RECURSIVE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+
+	BaseType_t xLightMutexGiveRecursive( LightMutexHandle_t xMutex )
+	{
+	LightMutex_t * const pxMutex = ( LightMutex_t * ) xMutex;
+	BaseType_t xReturn;
+
+		configASSERT( pxMutex );
+
+		if( ( pxMutex->ulOwner & lightmutexOWNER_MASK ) != ( uint32_t ) xTaskGetCurrentTaskHandle() ) /*lint !e923 Task handles are 32-bit pointers on this port. */
+		{
+			/* The calling task is not the holder. */
+			xReturn = pdFALSE;
+		}
+		else if( pxMutex->uxRecursiveCallCount != ( UBaseType_t ) 0U )
+		{
+			( pxMutex->uxRecursiveCallCount )--;
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			/* This is the outermost give, so the mutex is released. */
+			xReturn = xLightMutexGive( xMutex );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_RECURSIVE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xLightMutexGetHolder( LightMutexHandle_t xMutex )
+{
+LightMutex_t * const pxMutex = ( LightMutex_t * ) xMutex;
+
+	configASSERT( pxMutex );
+
+	return ( TaskHandle_t ) ( pxMutex->ulOwner & lightmutexOWNER_MASK ); /*lint !e923 Task handles are 32-bit pointers on this port. */
+}
+/*-----------------------------------------------------------*/
+
+void vLightMutexDelete( LightMutexHandle_t xMutex )
+{
+LightMutex_t * const pxMutex = ( LightMutex_t * ) xMutex;
+
+	configASSERT( pxMutex );
+	configASSERT( ( pxMutex->ulOwner & lightmutexOWNER_MASK ) == 0UL );
+	configASSERT( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE );
+
+	vPortFree( pxMutex );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTakeContended( LightMutex_t * const pxMutex, const uint32_t ulCurrentTask, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+uint32_t ulOwner;
+
+	/* The owner word is now accessed from within a critical section, so the
+	mutex cannot be given between the task deciding to block and the task
+	being placed on the list of blocked tasks.  Setting the waiters bit before
+	blocking makes the holder's give take the slow path, which will unblock
+	this task.  As with the queue implementation, this function relaxes the
+	coding standard somewhat to allow return statements within the function
+	itself. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			ulOwner = pxMutex->ulOwner;
+
+			#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			{
+				/* The task is no longer blocked on the mutex, if it was
+				blocked on it. */
+				vTaskSetBlockingMutex( NULL );
+			}
+			#endif
+
+			if( ( ulOwner & lightmutexOWNER_MASK ) == 0UL )
+			{
+				/* The mutex is available.  Keep the waiters bit, as other
+				tasks may still be blocked. */
+				pxMutex->ulOwner = ulCurrentTask | ( ulOwner & lightmutexWAITERS_BIT );
+				( void ) pvTaskIncrementMutexHeldCount();
+
+				#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+				{
+					/* The tasks still waiting for the mutex now count towards
+					the priority this task needs. */
+					if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+					{
+						vTaskAddContendedMutex( ( TaskHandle_t ) ulCurrentTask, &( pxMutex->xContendedMutexListItem ) ); /*lint !e923 Task handles are 32-bit pointers on this port. */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				taskEXIT_CRITICAL();
+				return pdTRUE;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* The mutex is held and no block time is specified (or the
+				block time has expired) so leave now. */
+				taskEXIT_CRITICAL();
+				return pdFALSE;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				pxMutex->ulOwner = ulOwner | lightmutexWAITERS_BIT;
+
+				#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+				{
+					/* Lets a priority this task inherits while blocked pass on
+					to the holder.  The waiters bit in the owner word is
+					ignored when the holder is read. */
+					vTaskSetBlockingMutex( ( void * volatile * ) &( pxMutex->ulOwner ) ); /*lint !e740 !e826 The owner word holds a task handle, which is a 32-bit pointer on this port. */
+					vTaskAddContendedMutex( ( TaskHandle_t ) ( ulOwner & lightmutexOWNER_MASK ), &( pxMutex->xContendedMutexListItem ) ); /*lint !e923 Task handles are 32-bit pointers on this port. */
+				}
+				#endif
+
+				vTaskPriorityInherit( ( TaskHandle_t ) ( ulOwner & lightmutexOWNER_MASK ) ); /*lint !e923 Task handles are 32-bit pointers on this port. */
+				vTaskPlaceOnEventList( &( pxMutex->xTasksWaitingToTake ), xTicksToWait );
+
+				/* The yield is held pending until the critical section is
+				exited.  When the task next runs it goes around the loop to try
+				claiming the mutex again. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				/* The timeout has expired. */
+				#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+				{
+					/* The holder only needs the priority of the tasks that
+					are still waiting. */
+					vTaskPriorityDisinheritAfterTimeout( ( TaskHandle_t ) ( ulOwner & lightmutexOWNER_MASK ) ); /*lint !e923 Task handles are 32-bit pointers on this port. */
+				}
+				#endif
+
+				taskEXIT_CRITICAL();
+				return pdFALSE;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include lightweight mutexes.  If you want to include lightweight mutexes
+then ensure configUSE_LIGHT_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_LIGHT_MUTEXES == 1 */
@@ -0,0 +1,483 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "port_ext.h"
+#include "lightsem.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include lightweight semaphores.  Set configUSE_LIGHT_SEMAPHORES to 1 in
+FreeRTOSConfig.h to include lightweight semaphores. */
+#if ( configUSE_LIGHT_SEMAPHORES == 1 )
+
+/* The semaphore's count is held in the low 31 bits of its value word.  The top
+bit is set by a task that is about to block on the semaphore, and forces every
+give onto the slow path until the list of blocked tasks is found to be
+empty. */
+#define lightsemWAITERS_BIT		( ( uint32_t ) 0x80000000UL )
+#define lightsemCOUNT_MASK		( ( uint32_t ) 0x7fffffffUL )
+
+/* Results of prvGiveFast(). */
+#define lightsemFULL			( ( BaseType_t ) 0 )
+#define lightsemGIVEN			( ( BaseType_t ) 1 )
+#define lightsemHAS_WAITERS		( ( BaseType_t ) 2 )
+
+#if( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define lightsemYIELD_IF_USING_PREEMPTION()
+#else
+	#define lightsemYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/*
+ * Definition of a lightweight semaphore.
+ */
+typedef struct LightSemaphoreDefinition
+{
+	volatile uint32_t ulValue;		/*< The count, plus lightsemWAITERS_BIT.  Only ever updated using ulPortAtomicCompareAndSwap(), or from within a critical section. */
+	uint32_t ulMaxCount;			/*< The maximum count the semaphore can reach. */
+	List_t xTasksWaitingToTake;		/*< List of tasks that are blocked waiting to take the semaphore.  Stored in priority order. */
+} LightSemaphore_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Decrement the count, if it is not zero, without entering the kernel.
+ * Returns pdTRUE if the count was decremented.
+ */
+static BaseType_t prvTakeFast( LightSemaphore_t * const pxSemaphore );
+
+/*
+ * Increment the count without entering the kernel, provided no task is
+ * blocked on the semaphore and the count is below its maximum.  Returns one
+ * of the lightsem result values defined above.
+ */
+static BaseType_t prvGiveFast( LightSemaphore_t * const pxSemaphore );
+
+/*
+ * Increment the count and unblock the highest priority task that is blocked
+ * on the semaphore, if there is one.  Must be called from a critical section.
+ * Returns lightsemFULL if the count was already at its maximum value,
+ * otherwise lightsemGIVEN.  *pxHigherPriorityTaskWoken is set to pdTRUE if the unblocked task
+ * has a priority above that of the running task.
+ */
+static BaseType_t prvGiveSlow( LightSemaphore_t * const pxSemaphore, BaseType_t * const pxHigherPriorityTaskWoken );
+
+/*-----------------------------------------------------------*/
+
+LightSemaphoreHandle_t xLightSemaphoreCreateCounting( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount )
+{
+LightSemaphore_t *pxNewSemaphore;
+
+	configASSERT( uxMaxCount != 0 );
+	configASSERT( ( uint32_t ) uxMaxCount <= lightsemCOUNT_MASK );
+	configASSERT( uxInitialCount <= uxMaxCount );
+
+	pxNewSemaphore = ( LightSemaphore_t * ) pvPortMalloc( sizeof( LightSemaphore_t ) );
+
+	if( pxNewSemaphore != NULL )
+	{
+		pxNewSemaphore->ulValue = ( uint32_t ) uxInitialCount;
+		pxNewSemaphore->ulMaxCount = ( uint32_t ) uxMaxCount;
+		vListInitialise( &( pxNewSemaphore->xTasksWaitingToTake ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	configASSERT( pxNewSemaphore );
+	return ( LightSemaphoreHandle_t ) pxNewSemaphore;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xLightSemaphoreTake( LightSemaphoreHandle_t xSemaphore, TickType_t xTicksToWait )
+{
+LightSemaphore_t * const pxSemaphore = ( LightSemaphore_t * ) xSemaphore;
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+uint32_t ulValue;
+
+	configASSERT( pxSemaphore );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	/* The uncontended case. */
+	if( prvTakeFast( pxSemaphore ) != pdFALSE )
+	{
+		return pdTRUE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The count was zero.  The count is now accessed from within a critical
+	section, so it cannot be incremented between the task deciding to block and
+	the task being placed on the list of blocked tasks.  Setting the waiters bit
+	before blocking makes any task or interrupt that subsequently gives the
+	semaphore take the slow path, which will unblock this task.  As with the
+	queue implementation, this function relaxes the coding standard somewhat to
+	allow return statements within the function itself. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			ulValue = pxSemaphore->ulValue;
+
+			if( ( ulValue & lightsemCOUNT_MASK ) != 0UL )
+			{
+				pxSemaphore->ulValue = ulValue - 1UL;
+				taskEXIT_CRITICAL();
+				return pdTRUE;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* The semaphore is not available and no block time is
+				specified (or the block time has expired) so leave now. */
+				taskEXIT_CRITICAL();
+				return pdFALSE;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				pxSemaphore->ulValue = ulValue | lightsemWAITERS_BIT;
+				vTaskPlaceOnEventList( &( pxSemaphore->xTasksWaitingToTake ), xTicksToWait );
+
+				/* The yield is held pending until the critical section is
+				exited.  When the task next runs it goes around the loop to try
+				taking the semaphore again. */
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				/* The timeout has expired. */
+				taskEXIT_CRITICAL();
+				return pdFALSE;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xLightSemaphoreTakeFromISR( LightSemaphoreHandle_t xSemaphore )
+{
+LightSemaphore_t * const pxSemaphore = ( LightSemaphore_t * ) xSemaphore;
+
+	configASSERT( pxSemaphore );
+
+	/* Taking never unblocks a task, so the fast path is all that is
+	needed. */
+	return prvTakeFast( pxSemaphore );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xLightSemaphoreGive( LightSemaphoreHandle_t xSemaphore )
+{
+LightSemaphore_t * const pxSemaphore = ( LightSemaphore_t * ) xSemaphore;
+BaseType_t xReturn, xYieldRequired = pdFALSE;
+
+	configASSERT( pxSemaphore );
+
+	xReturn = prvGiveFast( pxSemaphore );
+
+	if( xReturn == lightsemHAS_WAITERS )
+	{
+		taskENTER_CRITICAL();
+		{
+			xReturn = prvGiveSlow( pxSemaphore, &xYieldRequired );
+		}
+		taskEXIT_CRITICAL();
+
+		if( xYieldRequired != pdFALSE )
+		{
+			lightsemYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( xReturn != lightsemFULL ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xLightSemaphoreGiveFromISR( LightSemaphoreHandle_t xSemaphore, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+LightSemaphore_t * const pxSemaphore = ( LightSemaphore_t * ) xSemaphore;
+BaseType_t xReturn, xTaskWoken = pdFALSE;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxSemaphore );
+
+	/* See the comments in xQueueGenericSendFromISR() regarding the interrupt
+	priorities from which this function can be called. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	xReturn = prvGiveFast( pxSemaphore );
+
+	if( xReturn == lightsemHAS_WAITERS )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xReturn = prvGiveSlow( pxSemaphore, &xTaskWoken );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( ( xTaskWoken != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+		{
+			*pxHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( xReturn != lightsemFULL ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxLightSemaphoreGetCount( LightSemaphoreHandle_t xSemaphore )
+{
+LightSemaphore_t * const pxSemaphore = ( LightSemaphore_t * ) xSemaphore;
+
+	configASSERT( pxSemaphore );
+
+	return ( UBaseType_t ) ( pxSemaphore->ulValue & lightsemCOUNT_MASK );
+}
+/*-----------------------------------------------------------*/
+
+void vLightSemaphoreDelete( LightSemaphoreHandle_t xSemaphore )
+{
+LightSemaphore_t * const pxSemaphore = ( LightSemaphore_t * ) xSemaphore;
+
+	configASSERT( pxSemaphore );
+
+	/* Tasks blocked on the semaphore would be left referencing freed
+	memory. */
+	configASSERT( listLIST_IS_EMPTY( &( pxSemaphore->xTasksWaitingToTake ) ) != pdFALSE );
+
+	vPortFree( pxSemaphore );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTakeFast( LightSemaphore_t * const pxSemaphore )
+{
+uint32_t ulValue, ulFound;
+
+	ulValue = pxSemaphore->ulValue;
+
+	/* Retry until either the decrement succeeds or the count is seen to be
+	zero.  The compare and swap only fails if another task or interrupt changed
+	the value word after it was read. */
+	while( ( ulValue & lightsemCOUNT_MASK ) != 0UL )
+	{
+		ulFound = ulPortAtomicCompareAndSwap( &( pxSemaphore->ulValue ), ulValue, ulValue - 1UL );
+
+		if( ulFound == ulValue )
+		{
+			return pdTRUE;
+		}
+		else
+		{
+			ulValue = ulFound;
+		}
+	}
+
+	return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGiveFast( LightSemaphore_t * const pxSemaphore )
+{
+uint32_t ulValue, ulFound;
+
+	ulValue = pxSemaphore->ulValue;
+
+	for( ;; )
+	{
+		if( ( ulValue & lightsemWAITERS_BIT ) != 0UL )
+		{
+			/* A task might be blocked, so the kernel must be entered to unblock
+			it. */
+			return lightsemHAS_WAITERS;
+		}
+		else if( ulValue >= pxSemaphore->ulMaxCount )
+		{
+			return lightsemFULL;
+		}
+		else
+		{
+			ulFound = ulPortAtomicCompareAndSwap( &( pxSemaphore->ulValue ), ulValue, ulValue + 1UL );
+
+			if( ulFound == ulValue )
+			{
+				return lightsemGIVEN;
+			}
+			else
+			{
+				ulValue = ulFound;
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGiveSlow( LightSemaphore_t * const pxSemaphore, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+uint32_t ulCount;
+
+	/* Interrupts that can use the API are masked, and no other task can run,
+	so the value word can be updated without using the compare and swap.  A
+	task that was preempted part way through a compare and swap will find its
+	exclusive access was lost, and retry. */
+	ulCount = pxSemaphore->ulValue & lightsemCOUNT_MASK;
+
+	if( ulCount >= pxSemaphore->ulMaxCount )
+	{
+		return lightsemFULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	ulCount++;
+
+	if( listLIST_IS_EMPTY( &( pxSemaphore->xTasksWaitingToTake ) ) == pdFALSE )
+	{
+		if( xTaskRemoveFromEventList( &( pxSemaphore->xTasksWaitingToTake ) ) != pdFALSE )
+		{
+			*pxHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* The tasks that set the waiters bit have since timed out. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The waiters bit stays set for as long as any task remains blocked. */
+	if( listLIST_IS_EMPTY( &( pxSemaphore->xTasksWaitingToTake ) ) == pdFALSE )
+	{
+		pxSemaphore->ulValue = ulCount | lightsemWAITERS_BIT;
+	}
+	else
+	{
+		pxSemaphore->ulValue = ulCount;
+	}
+
+	return lightsemGIVEN;
+}
+
+/* This entire source file will be skipped if the application is not configured
+to include lightweight semaphores.  If you want to include lightweight
+semaphores then ensure configUSE_LIGHT_SEMAPHORES is set to 1 in
+FreeRTOSConfig.h. */
+#endif /* configUSE_LIGHT_SEMAPHORES == 1 */
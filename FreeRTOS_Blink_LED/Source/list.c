@@ -71,6 +71,7 @@
 #include <stdlib.h>
 #include "FreeRTOS.h"
 #include "list.h"
+#include "list_ext.h"
 
 /*-----------------------------------------------------------
  * PUBLIC LIST API documented in list.h
@@ -209,6 +210,34 @@ const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
 }
 /*-----------------------------------------------------------*/
 
+void vListInsertBefore( List_t * const pxList, ListItem_t * const pxNewListItem, ListItem_t * const pxPosition )
+{
+	/* Only effective when configASSERT() is also defined, these tests may catch
+	the list data structures being overwritten in memory.  They will not catch
+	data errors caused by incorrect configuration or use of FreeRTOS. */
+	listTEST_LIST_INTEGRITY( pxList );
+	listTEST_LIST_ITEM_INTEGRITY( pxNewListItem );
+
+	/* The position must be the list end marker, which is not recorded as
+	being in any list, or an item in the list. */
+	configASSERT( ( pxPosition == ( ListItem_t * ) &( pxList->xListEnd ) ) || ( pxPosition->pvContainer == ( void * ) pxList ) ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+
+	pxNewListItem->pxNext = pxPosition;
+	pxNewListItem->pxPrevious = pxPosition->pxPrevious;
+
+	/* Only used during decision coverage testing. */
+	mtCOVERAGE_TEST_DELAY();
+
+	pxPosition->pxPrevious->pxNext = pxNewListItem;
+	pxPosition->pxPrevious = pxNewListItem;
+
+	/* Remember which list the item is in. */
+	pxNewListItem->pvContainer = ( void * ) pxList;
+
+	( pxList->uxNumberOfItems )++;
+}
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
 {
 /* The list item knows which list it is in.  Obtain the list from the list
@@ -74,6 +74,9 @@
 /* Scheduler includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "task_ext.h"
+#include "port_ext.h"
+#include "fasttimer.h"
 
 #ifndef __TI_VFP_SUPPORT__
 	#error This port can only be used when the project options are configured to enable hardware floating point support.
@@ -104,6 +107,7 @@
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT		( 1UL << 16UL )
 #define portNVIC_PENDSVCLEAR_BIT 			( 1UL << 27UL )
 #define portNVIC_PEND_SYSTICK_CLEAR_BIT		( 1UL << 25UL )
+#define portNVIC_PEND_SYSTICK_SET_BIT		( 1UL << 26UL )
 
 #define portNVIC_PENDSV_PRI					( ( ( uint32_t ) configKERNEL_INTERRUPT_PRIORITY ) << 16UL )
 #define portNVIC_SYSTICK_PRI				( ( ( uint32_t ) configKERNEL_INTERRUPT_PRIORITY ) << 24UL )
@@ -132,6 +136,40 @@
 /* The systick is a 24-bit counter. */
 #define portMAX_24_BIT_NUMBER				( 0xffffffUL )
 
+/* The number of CPU cycles in one SysTick count, and in one tick period. */
+#define portCYCLES_PER_SYSTICK_COUNT		( configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ )
+#define portCYCLES_PER_TICK					( ( uint32_t ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) )
+
+/* Constants required to run the microsecond timebase on Wide Timer 5, which is
+concatenated into a single 64-bit timer that counts up. */
+#define portWTIMER5_BASE					( 0x4004F000UL )
+#define portWTIMER_REG( ulOffset )			( * ( ( volatile uint32_t * ) ( portWTIMER5_BASE + ( ulOffset ) ) ) )
+#define portWTIMER_CFG_REG					portWTIMER_REG( 0x000UL )
+#define portWTIMER_TAMR_REG					portWTIMER_REG( 0x004UL )
+#define portWTIMER_CTL_REG					portWTIMER_REG( 0x00CUL )
+#define portWTIMER_IMR_REG					portWTIMER_REG( 0x018UL )
+#define portWTIMER_ICR_REG					portWTIMER_REG( 0x024UL )
+#define portWTIMER_TAILR_REG				portWTIMER_REG( 0x028UL )
+#define portWTIMER_TBILR_REG				portWTIMER_REG( 0x02CUL )
+#define portWTIMER_TAMATCHR_REG				portWTIMER_REG( 0x030UL )
+#define portWTIMER_TBMATCHR_REG				portWTIMER_REG( 0x034UL )
+#define portWTIMER_TAV_REG					portWTIMER_REG( 0x050UL )
+#define portWTIMER_TBV_REG					portWTIMER_REG( 0x054UL )
+#define portWTIMER_TAMR_PERIODIC			( 0x2UL )
+#define portWTIMER_TAMR_TACDIR_BIT			( 1UL << 4UL )
+#define portWTIMER_TAMR_TAMIE_BIT			( 1UL << 5UL )
+#define portWTIMER_CTL_TAEN_BIT				( 1UL << 0UL )
+#define portWTIMER_CTL_TASTALL_BIT			( 1UL << 1UL )
+#define portWTIMER_TAMIM_BIT				( 1UL << 4UL )
+#define portSYSCTL_RCGCWTIMER_REG			( * ( ( volatile uint32_t * ) 0x400FE65C ) )
+#define portSYSCTL_PRWTIMER_REG				( * ( ( volatile uint32_t * ) 0x400FEA5C ) )
+#define portSYSCTL_WTIMER5_BIT				( 1UL << 5UL )
+#define portNVIC_WTIMER5A_ENABLE_REG		( * ( ( volatile uint32_t * ) 0xE000E10C ) )
+#define portNVIC_WTIMER5A_PEND_REG			( * ( ( volatile uint32_t * ) 0xE000E20C ) )
+#define portNVIC_WTIMER5A_PRI_REG			( * ( ( volatile uint8_t * ) 0xE000E468 ) )
+#define portNVIC_WTIMER5A_BIT				( 1UL << 8UL )
+#define portWTIMER_COUNTS_PER_MICROSECOND	( ( uint64_t ) ( configCPU_CLOCK_HZ / 1000000UL ) )
+
 /* A fiddle factor to estimate the number of SysTick counts that would have
 occurred while the SysTick counter is stopped during tickless idle
 calculations. */
@@ -172,22 +210,41 @@ extern void vPortEnableVFP( void );
  */
 static void prvTaskExitError( void );
 
+/*
+ * End the current SysTick period at the next tick on which the kernel has
+ * something to do.  Called with interrupts masked.
+ */
+#if configUSE_DYNAMIC_TICK == 1
+	static BaseType_t prvDynamicTickAnnounce( void );
+	static void prvDynamicTickReprogram( void );
+#endif /* configUSE_DYNAMIC_TICK */
+
+/*
+ * Start the 64-bit timer that provides the microsecond timebase, and read its
+ * count.
+ */
+#if configUSE_MICROSECOND_TIMEBASE == 1
+	static void prvSetupMicrosecondTimebase( void );
+	static uint64_t prvReadMicrosecondTimebaseCount( void );
+	static void prvProgramMicrosecondAlarm( void );
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+
 /*-----------------------------------------------------------*/
 
 /*
  * The number of SysTick increments that make up one tick period.
  */
-#if configUSE_TICKLESS_IDLE == 1
+#if ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_DYNAMIC_TICK == 1 )
 	static uint32_t ulTimerCountsForOneTick = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TICKLESS_IDLE || configUSE_DYNAMIC_TICK */
 
 /*
  * The maximum number of tick periods that can be suppressed is limited by the
  * 24 bit resolution of the SysTick timer.
  */
-#if configUSE_TICKLESS_IDLE == 1
+#if ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_DYNAMIC_TICK == 1 )
 	static uint32_t xMaximumPossibleSuppressedTicks = 0;
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TICKLESS_IDLE || configUSE_DYNAMIC_TICK */
 
 /*
  * Compensate for the CPU cycles that pass while the SysTick is stopped (low
@@ -197,6 +254,41 @@ static void prvTaskExitError( void );
 	static uint32_t ulStoppedTimerCompensation = 0;
 #endif /* configUSE_TICKLESS_IDLE */
 
+/*
+ * With the dynamic tick time is measured with the DWT cycle counter, which is
+ * never stopped, and the SysTick is only used as an alarm for the next tick on
+ * which the kernel has something to do.  Stopping the SysTick to reprogram it
+ * can therefore delay the alarm slightly, but cannot lose time.
+ * ulDynamicTickBaseCycles is the cycle count at the last tick boundary that
+ * was announced to the kernel, and xDynamicTickAlarmTicks is the number of
+ * tick periods after that boundary the alarm is set for, or 0 if it is not
+ * set.  The cycle counter wraps after 2^32 cycles, much longer than the
+ * longest alarm, so the boundary is always less than a wrap in the past.
+ */
+#if configUSE_DYNAMIC_TICK == 1
+	static uint32_t ulDynamicTickBaseCycles = 0;
+	static TickType_t xDynamicTickAlarmTicks = ( TickType_t ) 0;
+	static BaseType_t xDynamicTickAnnouncing = pdFALSE;
+	static BaseType_t xDynamicTickStarted = pdFALSE;
+#endif /* configUSE_DYNAMIC_TICK */
+
+/*
+ * Set once the microsecond timebase timer has been started.
+ */
+#if configUSE_MICROSECOND_TIMEBASE == 1
+	static BaseType_t xMicrosecondTimebaseStarted = pdFALSE;
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+
+/*
+ * The times at which the kernel and the fast timers want the microsecond
+ * timebase interrupt.  Both share the one match register, which is set to the
+ * earlier of the two.
+ */
+#if configUSE_MICROSECOND_TIMEBASE == 1
+	static uint64_t ullMicrosecondTaskAlarm = portMICROSECOND_NO_ALARM;
+	static uint64_t ullMicrosecondFastTimerAlarm = portMICROSECOND_NO_ALARM;
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+
 /*
  * Used by the portASSERT_IF_INTERRUPT_PRIORITY_INVALID() macro to ensure
  * FreeRTOS API functions are not called from interrupts that have been assigned
@@ -367,24 +459,183 @@ void vPortExitCritical( void )
 }
 /*-----------------------------------------------------------*/
 
-void xPortSysTickHandler( void )
-{
-	/* The SysTick runs at the lowest interrupt priority, so when this interrupt
-	executes all interrupts must be unmasked.  There is therefore no need to
-	save and then restore the interrupt mask value as its value is already
-	known. */
-	( void ) portSET_INTERRUPT_MASK_FROM_ISR();
+#if configUSE_DYNAMIC_TICK == 0
+
+	void xPortSysTickHandler( void )
 	{
-		/* Increment the RTOS tick. */
-		if( xTaskIncrementTick() != pdFALSE )
+		/* The SysTick runs at the lowest interrupt priority, so when this interrupt
+		executes all interrupts must be unmasked.  There is therefore no need to
+		save and then restore the interrupt mask value as its value is already
+		known. */
+		( void ) portSET_INTERRUPT_MASK_FROM_ISR();
 		{
-			/* A context switch is required.  Context switching is performed in
-			the PendSV interrupt.  Pend the PendSV interrupt. */
-			portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+			/* Increment the RTOS tick. */
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				/* A context switch is required.  Context switching is performed in
+				the PendSV interrupt.  Pend the PendSV interrupt. */
+				portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+			}
 		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( 0 );
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( 0 );
-}
+
+#else /* configUSE_DYNAMIC_TICK */
+
+	void xPortSysTickHandler( void )
+	{
+		( void ) portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			/* The alarm has expired, and the SysTick has reloaded with a
+			single tick period, so a new alarm is always set. */
+			xDynamicTickAlarmTicks = ( TickType_t ) 0;
+			( void ) prvDynamicTickAnnounce();
+			prvDynamicTickReprogram();
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( 0 );
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*-----------------------------------------------------------*/
+
+#if configUSE_DYNAMIC_TICK == 1
+
+	static BaseType_t prvDynamicTickAnnounce( void )
+	{
+	uint32_t ulElapsed, ulCyclesSinceTick;
+	TickType_t xTicks;
+	BaseType_t xReturn = pdFALSE;
+
+		/* The whole tick periods that have passed since the last announced
+		tick boundary, and how long ago the last of them started. */
+		ulElapsed = portGET_CYCLE_COUNT() - ulDynamicTickBaseCycles;
+		xTicks = ( TickType_t ) ( ulElapsed / portCYCLES_PER_TICK );
+
+		if( xTicks > ( TickType_t ) 0 )
+		{
+			ulCyclesSinceTick = ulElapsed - ( ( uint32_t ) xTicks * portCYCLES_PER_TICK );
+			ulDynamicTickBaseCycles += ( uint32_t ) xTicks * portCYCLES_PER_TICK;
+
+			/* The alarm is counted from the boundary, which has moved. */
+			if( xDynamicTickAlarmTicks > xTicks )
+			{
+				xDynamicTickAlarmTicks -= xTicks;
+			}
+			else
+			{
+				xDynamicTickAlarmTicks = ( TickType_t ) 0;
+			}
+
+			/* Tasks readied while the ticks are announced do not move the
+			alarm themselves, as the caller reprograms it anyway. */
+			xDynamicTickAnnouncing = pdTRUE;
+			if( xTaskAnnounceTicks( xTicks, ulCyclesSinceTick ) != pdFALSE )
+			{
+				portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+			}
+			xDynamicTickAnnouncing = pdFALSE;
+
+			xReturn = pdTRUE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*-----------------------------------------------------------*/
+
+#if configUSE_DYNAMIC_TICK == 1
+
+	static void prvDynamicTickReprogram( void )
+	{
+	TickType_t xTicks;
+	uint32_t ulElapsed, ulReloadValue;
+
+		xTicks = xTaskGetTicksToNextEvent();
+		if( xTicks > xMaximumPossibleSuppressedTicks )
+		{
+			xTicks = xMaximumPossibleSuppressedTicks;
+		}
+
+		if( xTicks == xDynamicTickAlarmTicks )
+		{
+			/* The alarm is already set for the right tick. */
+			return;
+		}
+
+		/* The next event may be due in the tick that is already in progress,
+		in which case the alarm is set for the end of that tick. */
+		ulElapsed = portGET_CYCLE_COUNT() - ulDynamicTickBaseCycles;
+		if( ( ( uint32_t ) xTicks * portCYCLES_PER_TICK ) <= ulElapsed )
+		{
+			xTicks = ( TickType_t ) ( ulElapsed / portCYCLES_PER_TICK ) + ( TickType_t ) 1;
+		}
+
+		/* Round the SysTick counts up, so the alarm never expires before the
+		tick boundary it is set for. */
+		ulReloadValue = ( ( ( uint32_t ) xTicks * portCYCLES_PER_TICK ) - ulElapsed + ( portCYCLES_PER_SYSTICK_COUNT - 1UL ) ) / portCYCLES_PER_SYSTICK_COUNT;
+		if( ulReloadValue < 2UL )
+		{
+			ulReloadValue = 2UL;
+		}
+		xDynamicTickAlarmTicks = xTicks;
+
+		/* Restart the SysTick for the alarm.  An expiry of the old alarm that
+		is still pending is superseded by the new one.  The reload value is
+		then set back to a single tick period, so the SysTick keeps
+		interrupting should the interrupt be held off. */
+		portNVIC_SYSTICK_CTRL_REG &= ~portNVIC_SYSTICK_ENABLE_BIT;
+		portNVIC_INT_CTRL_REG = portNVIC_PEND_SYSTICK_CLEAR_BIT;
+		portNVIC_SYSTICK_LOAD_REG = ulReloadValue - 1UL;
+		portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+		portNVIC_SYSTICK_CTRL_REG |= portNVIC_SYSTICK_ENABLE_BIT;
+		portNVIC_SYSTICK_LOAD_REG = ulTimerCountsForOneTick - 1UL;
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*-----------------------------------------------------------*/
+
+#if configUSE_DYNAMIC_TICK == 1
+
+	void vPortDynamicTickUpdate( void )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			/* While the tick interrupt is announcing ticks it reprograms the
+			SysTick itself once it has finished. */
+			if( ( xDynamicTickStarted != pdFALSE ) && ( xDynamicTickAnnouncing == pdFALSE ) )
+			{
+				prvDynamicTickReprogram();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*-----------------------------------------------------------*/
+
+#if configUSE_DYNAMIC_TICK == 1
+
+	void vPortDynamicTickSync( void )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( ( xDynamicTickStarted != pdFALSE ) && ( xDynamicTickAnnouncing == pdFALSE ) )
+			{
+				if( prvDynamicTickAnnounce() != pdFALSE )
+				{
+					prvDynamicTickReprogram();
+				}
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
 /*-----------------------------------------------------------*/
 
 #if configUSE_TICKLESS_IDLE == 1
@@ -548,20 +799,238 @@ void xPortSysTickHandler( void )
 void vPortSetupTimerInterrupt( void )
 {
 	/* Calculate the constants required to configure the tick interrupt. */
-	#if configUSE_TICKLESS_IDLE == 1
+	#if ( configUSE_TICKLESS_IDLE == 1 ) || ( configUSE_DYNAMIC_TICK == 1 )
 	{
 		ulTimerCountsForOneTick = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ );
 		xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
+	}
+	#endif /* configUSE_TICKLESS_IDLE || configUSE_DYNAMIC_TICK */
+
+	#if configUSE_TICKLESS_IDLE == 1
+	{
 		ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR / ( configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ );
 	}
 	#endif /* configUSE_TICKLESS_IDLE */
 
+	#if configUSE_DYNAMIC_TICK == 1
+	{
+		/* Time is measured from the start of the first tick period, so the
+		cycle counter is read before the SysTick is started. */
+		portENABLE_CYCLE_COUNTER();
+		ulDynamicTickBaseCycles = portGET_CYCLE_COUNT();
+	}
+	#endif /* configUSE_DYNAMIC_TICK */
+
 	/* Configure SysTick to interrupt at the requested rate. */
 	portNVIC_SYSTICK_LOAD_REG = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
 	portNVIC_SYSTICK_CTRL_REG = ( portNVIC_SYSTICK_CLK_BIT | portNVIC_SYSTICK_INT_BIT | portNVIC_SYSTICK_ENABLE_BIT );
+
+	#if configUSE_DYNAMIC_TICK == 1
+	{
+		/* The SysTick starts with a single tick period.  Interrupts are still
+		masked, so the alarm is first set by the first tick interrupt. */
+		xDynamicTickStarted = pdTRUE;
+	}
+	#endif /* configUSE_DYNAMIC_TICK */
+
+	#if configUSE_MICROSECOND_TIMEBASE == 1
+	{
+		prvSetupMicrosecondTimebase();
+	}
+	#endif /* configUSE_MICROSECOND_TIMEBASE */
 }
 /*-----------------------------------------------------------*/
 
+#if configUSE_MICROSECOND_TIMEBASE == 1
+
+	static void prvSetupMicrosecondTimebase( void )
+	{
+		/* Clock the timer and wait for it to be ready. */
+		portSYSCTL_RCGCWTIMER_REG |= portSYSCTL_WTIMER5_BIT;
+		while( ( portSYSCTL_PRWTIMER_REG & portSYSCTL_WTIMER5_BIT ) == 0UL )
+		{
+		}
+
+		/* A 64-bit periodic timer counting up through the full range, with
+		the match interrupt enabled but masked until an alarm is set.  The
+		timer stops while the processor is halted by the debugger, as the
+		tick does. */
+		portWTIMER_CTL_REG = 0UL;
+		portWTIMER_CFG_REG = 0UL;
+		portWTIMER_TAMR_REG = ( portWTIMER_TAMR_PERIODIC | portWTIMER_TAMR_TACDIR_BIT | portWTIMER_TAMR_TAMIE_BIT );
+		portWTIMER_TBILR_REG = 0xffffffffUL;
+		portWTIMER_TAILR_REG = 0xffffffffUL;
+		portWTIMER_IMR_REG = 0UL;
+		portWTIMER_ICR_REG = portWTIMER_TAMIM_BIT;
+
+		/* The compare interrupt unblocks tasks, so uses the highest priority
+		from which the interrupt safe API can be called. */
+		portNVIC_WTIMER5A_PRI_REG = ( uint8_t ) configMAX_SYSCALL_INTERRUPT_PRIORITY;
+		portNVIC_WTIMER5A_ENABLE_REG = portNVIC_WTIMER5A_BIT;
+
+		portWTIMER_CTL_REG = ( portWTIMER_CTL_TAEN_BIT | portWTIMER_CTL_TASTALL_BIT );
+		xMicrosecondTimebaseStarted = pdTRUE;
+
+		/* Fast timers can be started before the scheduler, in which case
+		their alarm is waiting to be programmed. */
+		prvProgramMicrosecondAlarm();
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if configUSE_MICROSECOND_TIMEBASE == 1
+
+	static uint64_t prvReadMicrosecondTimebaseCount( void )
+	{
+	uint32_t ulHigh, ulLow;
+
+		/* Read the upper half again after the lower half, and try again if
+		the lower half wrapped between the two reads. */
+		do
+		{
+			ulHigh = portWTIMER_TBV_REG;
+			ulLow = portWTIMER_TAV_REG;
+		} while( ulHigh != portWTIMER_TBV_REG );
+
+		return ( ( ( uint64_t ) ulHigh ) << 32UL ) | ( uint64_t ) ulLow;
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if configUSE_MICROSECOND_TIMEBASE == 1
+
+	uint64_t ullPortGetMicroseconds( void )
+	{
+	uint64_t ullReturn = 0ULL;
+
+		if( xMicrosecondTimebaseStarted != pdFALSE )
+		{
+			ullReturn = prvReadMicrosecondTimebaseCount() / portWTIMER_COUNTS_PER_MICROSECOND;
+		}
+
+		return ullReturn;
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if configUSE_MICROSECOND_TIMEBASE == 1
+
+	void vPortSetMicrosecondAlarm( uint64_t ullMicroseconds )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ullMicrosecondTaskAlarm = ullMicroseconds;
+			prvProgramMicrosecondAlarm();
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if configUSE_MICROSECOND_TIMEBASE == 1
+
+	void vPortSetFastTimerAlarm( uint64_t ullMicroseconds )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ullMicrosecondFastTimerAlarm = ullMicroseconds;
+			prvProgramMicrosecondAlarm();
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if configUSE_MICROSECOND_TIMEBASE == 1
+
+	static void prvProgramMicrosecondAlarm( void )
+	{
+	uint64_t ullMicroseconds, ullMatch;
+
+		/* Called with interrupts masked.  Mask the match interrupt while the
+		two halves of the match value are written, so an intermediate value
+		cannot raise it. */
+		portWTIMER_IMR_REG = 0UL;
+
+		if( ullMicrosecondTaskAlarm < ullMicrosecondFastTimerAlarm )
+		{
+			ullMicroseconds = ullMicrosecondTaskAlarm;
+		}
+		else
+		{
+			ullMicroseconds = ullMicrosecondFastTimerAlarm;
+		}
+
+		if( ( ullMicroseconds != portMICROSECOND_NO_ALARM ) && ( xMicrosecondTimebaseStarted != pdFALSE ) )
+		{
+			ullMatch = ullMicroseconds * portWTIMER_COUNTS_PER_MICROSECOND;
+			portWTIMER_TBMATCHR_REG = ( uint32_t ) ( ullMatch >> 32UL );
+			portWTIMER_TAMATCHR_REG = ( uint32_t ) ullMatch;
+			portWTIMER_ICR_REG = portWTIMER_TAMIM_BIT;
+			portWTIMER_IMR_REG = portWTIMER_TAMIM_BIT;
+
+			/* The count only passes the match value once, so if it has
+			already done so pend the interrupt directly. */
+			if( prvReadMicrosecondTimebaseCount() >= ullMatch )
+			{
+				portNVIC_WTIMER5A_PEND_REG = portNVIC_WTIMER5A_BIT;
+			}
+		}
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if configUSE_MICROSECOND_TIMEBASE == 1
+
+	void xPortMicrosecondTimerHandler( void )
+	{
+	uint64_t ullNow;
+	BaseType_t xSwitchRequired = pdFALSE;
+
+		portWTIMER_ICR_REG = portWTIMER_TAMIM_BIT;
+		ullNow = ullPortGetMicroseconds();
+
+		/* Only the owners of the alarms that are due are called, as each
+		reprograms the match register for its next alarm. */
+		if( ullMicrosecondTaskAlarm <= ullNow )
+		{
+			if( xTaskMicrosecondAlarm() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+		}
+
+		#if configUSE_FAST_TIMERS == 1
+		{
+			if( ullMicrosecondFastTimerAlarm <= ullNow )
+			{
+				if( xFastTimerAlarm() != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+			}
+		}
+		#endif /* configUSE_FAST_TIMERS */
+
+		if( xSwitchRequired != pdFALSE )
+		{
+			portNVIC_INT_CTRL_REG = portNVIC_PENDSVSET_BIT;
+		}
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
 #if( configASSERT_DEFINED == 1 )
 
 	void vPortValidateInterruptPriority( void )
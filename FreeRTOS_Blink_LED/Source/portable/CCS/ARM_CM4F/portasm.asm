@@ -78,6 +78,7 @@
 	.def vPortSVCHandler
 	.def vPortStartFirstTask
 	.def vPortEnableVFP
+	.def ulPortAtomicCompareAndSwap
 
 NVICOffsetConst:					.word 	0xE000ED08
 CPACRConst:							.word 	0xE000ED88
@@ -201,6 +202,33 @@ vPortEnableVFP: .asmfunc
 	bx	r14
 	.endasmfunc
 
+; -----------------------------------------------------------
+
+	.align 4
+ulPortAtomicCompareAndSwap: .asmfunc
+	;/* r0 holds the address of the word, r1 the value it is expected to hold
+	;and r2 the value to write if it does.  The value found in the word is
+	;returned, so the swap took place if the returned value equals r1. */
+CASRetry:
+	ldrex r3, [r0]
+	cmp r3, r1
+	bne CASMismatch
+
+	;/* The store only succeeds if nothing has written to the word, and no
+	;exception has occurred, since the ldrex.  Otherwise try again. */
+	strex r12, r2, [r0]
+	cmp r12, #0
+	bne CASRetry
+	dmb
+	mov r0, r3
+	bx r14
+
+CASMismatch:
+	clrex
+	mov r0, r3
+	bx r14
+	.endasmfunc
+
 	.end
 
 ; -----------------------------------------------------------
@@ -78,6 +78,8 @@ task.h is included from an application file. */
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "queue_ext.h"
+#include "task_ext.h"
 
 #if ( configUSE_CO_ROUTINES == 1 )
 	#include "croutine.h"
@@ -158,6 +160,10 @@ typedef struct QueueDefinition
 		struct QueueDefinition *pxQueueSetContainer;
 	#endif
 
+	#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+		ListItem_t xContendedMutexListItem;	/*< Used to reference the mutex from the holder while tasks are waiting for it.  Only used when the structure is used as a mutex. */
+	#endif
+
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
@@ -236,6 +242,31 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+	/*
+	 * Copies uxItemCount items to the back of the queue.  The copy is performed
+	 * using at most two calls to memcpy() - one up to the end of the queue
+	 * storage area and one from the start of the storage area if the items
+	 * wrap.  The caller must have already checked there is enough space.
+	 */
+	static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItemsToQueue, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Copies uxItemCount items out of the queue, again using at most two calls
+	 * to memcpy().  The caller must have already checked there are at least
+	 * uxItemCount items in the queue.
+	 */
+	static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Removes up to uxMaxTasks tasks from the event list pxEventList.  Returns
+	 * pdTRUE if any of the tasks removed has a priority above that of the
+	 * calling task, so the caller only has to make one yield decision however
+	 * many tasks were unblocked.
+	 */
+	static BaseType_t prvUnblockMultipleFromEventList( List_t * const pxEventList, UBaseType_t uxMaxTasks ) PRIVILEGED_FUNCTION;
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -434,6 +465,13 @@ QueueHandle_t xReturn = NULL;
 			vListInitialise( &( pxNewQueue->xTasksWaitingToSend ) );
 			vListInitialise( &( pxNewQueue->xTasksWaitingToReceive ) );
 
+			#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			{
+				vListInitialiseItem( &( pxNewQueue->xContendedMutexListItem ) );
+				listSET_LIST_ITEM_OWNER( &( pxNewQueue->xContendedMutexListItem ), &( pxNewQueue->xTasksWaitingToReceive ) );
+			}
+			#endif
+
 			traceCREATE_MUTEX( pxNewQueue );
 
 			/* Start with the semaphore in the expected state. */
@@ -1408,6 +1446,21 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 							/* Record the information required to implement
 							priority inheritance should it become necessary. */
 							pxQueue->pxMutexHolder = ( int8_t * ) pvTaskIncrementMutexHeldCount(); /*lint !e961 Cast is not redundant as TaskHandle_t is a typedef. */
+
+							#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+							{
+								/* The tasks still waiting for the mutex now
+								count towards the priority this task needs. */
+								if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+								{
+									vTaskAddContendedMutex( ( void * ) pxQueue->pxMutexHolder, &( pxQueue->xContendedMutexListItem ) );
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							#endif
 						}
 						else
 						{
@@ -1508,6 +1561,13 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 					{
 						taskENTER_CRITICAL();
 						{
+							#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+							{
+								vTaskSetBlockingMutex( ( void * volatile * ) &( pxQueue->pxMutexHolder ) );
+								vTaskAddContendedMutex( ( void * ) pxQueue->pxMutexHolder, &( pxQueue->xContendedMutexListItem ) );
+							}
+							#endif
+
 							vTaskPriorityInherit( ( void * ) pxQueue->pxMutexHolder );
 						}
 						taskEXIT_CRITICAL();
@@ -1529,6 +1589,14 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+				{
+					/* The task is no longer blocked on the mutex, if it was
+					blocked on one. */
+					vTaskSetBlockingMutex( NULL );
+				}
+				#endif
 			}
 			else
 			{
@@ -1539,6 +1607,26 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		}
 		else
 		{
+			#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+			{
+				/* The holder may have inherited this task's priority while it
+				was blocked.  Now it has timed out the holder only needs the
+				priority of the tasks that are still waiting. */
+				if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+				{
+					taskENTER_CRITICAL();
+					{
+						vTaskPriorityDisinheritAfterTimeout( ( void * ) pxQueue->pxMutexHolder );
+					}
+					taskEXIT_CRITICAL();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			prvUnlockQueue( pxQueue );
 			( void ) xTaskResumeAll();
 			traceQUEUE_RECEIVE_FAILED( pxQueue );
@@ -1689,6 +1777,461 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+
+	BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+	UBaseType_t uxItemsToSend;
+	TimeOut_t xTimeOut;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItemsToQueue );
+		configASSERT( uxItemCount > ( UBaseType_t ) 0U );
+
+		/* Semaphores and mutexes have no storage area to copy into. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/* As per xQueueGenericSend(), this function relaxes the coding standard
+		somewhat to allow return statements within the function itself. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+				{
+					/* Post as many of the items as there is room for. */
+					uxItemsToSend = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+					if( uxItemsToSend > uxItemCount )
+					{
+						uxItemsToSend = uxItemCount;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					traceQUEUE_SEND( pxQueue );
+					prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxItemsToSend );
+
+					#if ( configUSE_QUEUE_SETS == 1 )
+					{
+						if( pxQueue->pxQueueSetContainer != NULL )
+						{
+						UBaseType_t uxItem;
+
+							/* The queue set must hold one entry for each item
+							posted to one of its member queues. */
+							xYieldRequired = pdFALSE;
+							for( uxItem = ( UBaseType_t ) 0; uxItem < uxItemsToSend; uxItem++ )
+							{
+								if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) == pdTRUE )
+								{
+									xYieldRequired = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+						}
+						else
+						{
+							/* One task can be unblocked for each item posted. */
+							xYieldRequired = prvUnblockMultipleFromEventList( &( pxQueue->xTasksWaitingToReceive ), uxItemsToSend );
+						}
+					}
+					#else /* configUSE_QUEUE_SETS */
+					{
+						/* One task can be unblocked for each item posted. */
+						xYieldRequired = prvUnblockMultipleFromEventList( &( pxQueue->xTasksWaitingToReceive ), uxItemsToSend );
+					}
+					#endif /* configUSE_QUEUE_SETS */
+
+					if( xYieldRequired != pdFALSE )
+					{
+						/* At least one of the unblocked tasks has a priority
+						higher than our own.  A single yield is performed no
+						matter how many tasks were unblocked. */
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					taskEXIT_CRITICAL();
+					return ( BaseType_t ) uxItemsToSend;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* The queue was full and no block time is specified (or
+						the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_SEND_FAILED( pxQueue );
+						return ( BaseType_t ) 0;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						/* The queue was full and a block time was specified so
+						configure the timeout structure. */
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* Interrupts and other tasks can send to and receive from the queue
+			now the critical section has been exited. */
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsQueueFull( pxQueue ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* The timeout has expired. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+				traceQUEUE_SEND_FAILED( pxQueue );
+				return ( BaseType_t ) 0;
+			}
+		}
+	}
+
+#endif /* configUSE_QUEUE_MULTIPLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+
+	BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	UBaseType_t uxItemsToReceive;
+	TimeOut_t xTimeOut;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+		configASSERT( uxMaxItems > ( UBaseType_t ) 0U );
+
+		/* Semaphores and mutexes have no storage area to copy from. */
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		/* As per xQueueGenericReceive(), this function relaxes the coding
+		standard somewhat to allow return statements within the function
+		itself. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+				{
+					/* Receive as many items as are available, up to the size of
+					the buffer. */
+					uxItemsToReceive = pxQueue->uxMessagesWaiting;
+					if( uxItemsToReceive > uxMaxItems )
+					{
+						uxItemsToReceive = uxMaxItems;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					traceQUEUE_RECEIVE( pxQueue );
+					prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxItemsToReceive );
+
+					/* One task waiting to send can be unblocked for each item
+					removed, but only one yield decision is made. */
+					if( prvUnblockMultipleFromEventList( &( pxQueue->xTasksWaitingToSend ), uxItemsToReceive ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					taskEXIT_CRITICAL();
+					return ( BaseType_t ) uxItemsToReceive;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* The queue was empty and no block time is specified (or
+						the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_RECEIVE_FAILED( pxQueue );
+						return ( BaseType_t ) 0;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						/* The queue was empty and a block time was specified so
+						configure the timeout structure. */
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* Interrupts and other tasks can send to and receive from the queue
+			now the critical section has been exited. */
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueue );
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+					prvUnlockQueue( pxQueue );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueue );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return ( BaseType_t ) 0;
+			}
+		}
+	}
+
+#endif /* configUSE_QUEUE_MULTIPLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+
+	BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	BaseType_t xYieldRequired = pdFALSE;
+	UBaseType_t uxItemsToSend, uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItemsToQueue );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+		/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+		system call interrupt priority. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			uxItemsToSend = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+			if( uxItemsToSend > uxItemCount )
+			{
+				uxItemsToSend = uxItemCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( uxItemsToSend > ( UBaseType_t ) 0 )
+			{
+				traceQUEUE_SEND_FROM_ISR( pxQueue );
+				prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxItemsToSend );
+
+				/* The event list is not altered if the queue is locked.  This
+				will be done when the queue is unlocked later. */
+				if( pxQueue->xTxLock == queueUNLOCKED )
+				{
+					#if ( configUSE_QUEUE_SETS == 1 )
+					{
+						if( pxQueue->pxQueueSetContainer != NULL )
+						{
+						UBaseType_t uxItem;
+
+							for( uxItem = ( UBaseType_t ) 0; uxItem < uxItemsToSend; uxItem++ )
+							{
+								if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) == pdTRUE )
+								{
+									xYieldRequired = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+						}
+						else
+						{
+							xYieldRequired = prvUnblockMultipleFromEventList( &( pxQueue->xTasksWaitingToReceive ), uxItemsToSend );
+						}
+					}
+					#else /* configUSE_QUEUE_SETS */
+					{
+						xYieldRequired = prvUnblockMultipleFromEventList( &( pxQueue->xTasksWaitingToReceive ), uxItemsToSend );
+					}
+					#endif /* configUSE_QUEUE_SETS */
+
+					if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Increment the lock count by the number of items posted so
+					the task that unlocks the queue can unblock one task per
+					item. */
+					pxQueue->xTxLock += ( BaseType_t ) uxItemsToSend;
+				}
+			}
+			else
+			{
+				traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return ( BaseType_t ) uxItemsToSend;
+	}
+
+#endif /* configUSE_QUEUE_MULTIPLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+
+	BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	UBaseType_t uxItemsToReceive, uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+		/* See the comments in xQueueGenericSendFromISR() regarding the maximum
+		system call interrupt priority. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			uxItemsToReceive = pxQueue->uxMessagesWaiting;
+			if( uxItemsToReceive > uxMaxItems )
+			{
+				uxItemsToReceive = uxMaxItems;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( uxItemsToReceive > ( UBaseType_t ) 0 )
+			{
+				traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+				prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxItemsToReceive );
+
+				/* If the queue is locked the event list will not be modified.
+				Instead update the lock count so the task that unlocks the queue
+				will know how many items were removed while it was locked. */
+				if( pxQueue->xRxLock == queueUNLOCKED )
+				{
+					if( prvUnblockMultipleFromEventList( &( pxQueue->xTasksWaitingToSend ), uxItemsToReceive ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					pxQueue->xRxLock += ( BaseType_t ) uxItemsToReceive;
+				}
+			}
+			else
+			{
+				traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return ( BaseType_t ) uxItemsToReceive;
+	}
+
+#endif /* configUSE_QUEUE_MULTIPLE */
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
 {
 UBaseType_t uxReturn;
@@ -1792,6 +2335,12 @@ BaseType_t xReturn = pdFALSE;
 			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 			{
 				/* The mutex is no longer being held. */
+				#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+				{
+					vTaskRemoveContendedMutex( &( pxQueue->xContendedMutexListItem ) );
+				}
+				#endif
+
 				xReturn = xTaskPriorityDisinherit( ( void * ) pxQueue->pxMutexHolder );
 				pxQueue->pxMutexHolder = NULL;
 			}
@@ -1873,6 +2422,112 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+
+	static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItemsToQueue, const UBaseType_t uxItemCount )
+	{
+	size_t xBytesToCopy, xBytesToEnd;
+	const int8_t *pcSource = ( const int8_t * ) pvItemsToQueue;
+
+		xBytesToCopy = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+		xBytesToEnd = ( size_t ) ( pxQueue->pcTail - pxQueue->pcWriteTo ); /*lint !e946 !e947 MISRA exception justified as both pointers reference the same storage area. */
+
+		if( xBytesToCopy < xBytesToEnd )
+		{
+			/* The items fit without reaching the end of the storage area. */
+			( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcSource, xBytesToCopy ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+			pxQueue->pcWriteTo += xBytesToCopy;
+		}
+		else
+		{
+			/* Fill to the end of the storage area, then place any remaining
+			items at the start of the storage area. */
+			( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pcSource, xBytesToEnd ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+			xBytesToCopy -= xBytesToEnd;
+			( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) &( pcSource[ xBytesToEnd ] ), xBytesToCopy ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+			pxQueue->pcWriteTo = pxQueue->pcHead + xBytesToCopy;
+		}
+
+		pxQueue->uxMessagesWaiting += uxItemCount;
+	}
+
+#endif /* configUSE_QUEUE_MULTIPLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+
+	static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxItemCount )
+	{
+	size_t xBytesToCopy, xBytesToEnd;
+	int8_t *pcReadFrom;
+	int8_t * const pcDestination = ( int8_t * ) pvBuffer;
+
+		/* u.pcReadFrom points to the last item that was read, so the first item
+		to read now is the one that follows it. */
+		pcReadFrom = pxQueue->u.pcReadFrom + pxQueue->uxItemSize;
+		if( pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+		{
+			pcReadFrom = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		xBytesToCopy = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+		xBytesToEnd = ( size_t ) ( pxQueue->pcTail - pcReadFrom ); /*lint !e946 !e947 MISRA exception justified as both pointers reference the same storage area. */
+
+		if( xBytesToCopy <= xBytesToEnd )
+		{
+			( void ) memcpy( ( void * ) pcDestination, ( void * ) pcReadFrom, xBytesToCopy ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+			pcReadFrom += xBytesToCopy;
+		}
+		else
+		{
+			/* The items wrap past the end of the storage area. */
+			( void ) memcpy( ( void * ) pcDestination, ( void * ) pcReadFrom, xBytesToEnd ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+			xBytesToCopy -= xBytesToEnd;
+			( void ) memcpy( ( void * ) &( pcDestination[ xBytesToEnd ] ), ( void * ) pxQueue->pcHead, xBytesToCopy ); /*lint !e961 !e418 MISRA exception as the casts are only redundant for some ports. */
+			pcReadFrom = pxQueue->pcHead + xBytesToCopy;
+		}
+
+		/* Leave u.pcReadFrom pointing to the last item read, as expected by
+		prvCopyDataFromQueue(). */
+		pxQueue->u.pcReadFrom = pcReadFrom - pxQueue->uxItemSize;
+		pxQueue->uxMessagesWaiting -= uxItemCount;
+	}
+
+#endif /* configUSE_QUEUE_MULTIPLE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE == 1 )
+
+	static BaseType_t prvUnblockMultipleFromEventList( List_t * const pxEventList, UBaseType_t uxMaxTasks )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		/* Called from within a critical section, or from an ISR with the queue
+		unlocked, so the event list cannot change while it is being emptied. */
+		while( ( uxMaxTasks > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+		{
+			if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+			{
+				xHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			--uxMaxTasks;
+		}
+
+		return xHigherPriorityTaskWoken;
+	}
+
+#endif /* configUSE_QUEUE_MULTIPLE */
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
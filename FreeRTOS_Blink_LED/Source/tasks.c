@@ -81,6 +81,14 @@ task.h is included from an application file. */
 #include "task.h"
 #include "timers.h"
 #include "StackMacros.h"
+#include "task_ext.h"
+#include "cyclic.h"
+#include "port_ext.h"
+#include "list_ext.h"
+
+#if ( configUSE_CO_ROUTINES != 0 )
+	#include "croutine_ext.h"
+#endif
 
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
@@ -192,6 +200,74 @@ typedef struct tskTaskControlBlock
 		volatile eNotifyValue eNotifyState;
 	#endif
 
+	#if ( ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) )
+		void			*pvEventData;		/*< Describes the operation the task is blocked on when a kernel object passes data directly to or from the task.  See vTaskSetEventData(). */
+	#endif
+
+	#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+		void * volatile	*ppvBlockingMutexHolder;	/*< Points to the holder field of the mutex the task is blocked on, if any, so an inherited priority can be passed along a chain of holders.  See vTaskSetBlockingMutex(). */
+		List_t			xContendedMutexList;		/*< Holds an item for each mutex the task holds that other tasks have blocked on, so an inherited priority can be recalculated from the highest priority waiter of each.  See vTaskAddContendedMutex(). */
+	#endif
+
+	#if ( ( configUSE_IPC == 1 ) && ( configUSE_MUTEXES == 1 ) )
+		List_t			xDonationList;		/*< Holds an item for each IPC call the task has accepted and not yet replied to, in the order of the priority donated with each call.  See vTaskPriorityDonate(). */
+	#endif
+
+	#if ( configUSE_CEILING_MUTEXES == 1 )
+		List_t			xCeilingMutexList;			/*< Holds an item for each ceiling mutex the task holds, highest ceiling first.  See vTaskPriorityRaiseToCeiling(). */
+		UBaseType_t		uxCeilingSavedBasePriority;	/*< The base priority the task had before it took the ceiling mutexes it holds. */
+	#endif
+
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+		UBaseType_t		uxPreemptionThreshold;	/*< Once the task has started running it can only be preempted by tasks of a priority above this value, until it blocks.  See vTaskPreemptionThresholdSet(). */
+		struct tskTaskControlBlock *pxPreemptedThresholdTCB;	/*< The task that was at the top of the stack of preempted threshold holders when this task joined it.  See pxThresholdTCB. */
+	#endif
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xRelativeDeadline;	/*< The deadline of each release of the task, relative to the release time.  0 if the task has not declared a deadline. */
+		TickType_t		xAbsoluteDeadline;	/*< The tick count by which the current release of the task must complete.  Only valid if xHasDeadline is pdTRUE. */
+		BaseType_t		xHasDeadline;		/*< pdTRUE if xAbsoluteDeadline is valid.  Tasks without a deadline run after those with one at configEDF_TASK_PRIORITY. */
+		UBaseType_t		uxDeadlineHeapIndex;	/*< One more than the position of the task in the deadline heap, or 0 if the task is not in the heap. */
+	#endif
+
+	#if ( configUSE_TASK_BUDGETS == 1 )
+		ListItem_t		xBudgetListItem;			/*< Used to reference the task from a budget replenishment list while a replenishment is pending. */
+		uint32_t		ulBudgetCycles;				/*< The execution budget of the task in CPU cycles, or 0 if the task has no budget.  See vTaskBudgetSet(). */
+		uint32_t		ulBudgetRemaining;			/*< The cycles the task can use before its budget is enforced. */
+		uint32_t		ulBudgetConsumed;			/*< The cycles used during the current activation, which are returned one replenishment period after the activation started. */
+		uint32_t		ulBudgetPendingReplenishment;	/*< The cycles that will be returned when xBudgetListItem reaches the head of pxBudgetReplenishList. */
+		uint32_t		ulBudgetExhaustions;		/*< The number of times the budget has been enforced. */
+		TickType_t		xBudgetPeriod;				/*< The replenishment period of the budget. */
+		TickType_t		xBudgetActivationTime;		/*< The tick count at which the current activation started. */
+		eBudgetAction	eExhaustedAction;			/*< What is done to the task when its budget is exhausted. */
+		BaseType_t		xBudgetActive;				/*< pdTRUE from when the task starts running until it stops being ready. */
+		BaseType_t		xBudgetEnforced;			/*< pdTRUE while the task is demoted or suspended because its budget is exhausted.  A demoted task has its base priority capped, see taskGET_UNINHERITED_PRIORITY(). */
+	#endif
+
+	#if ( configUSE_TIMING_MONITOR == 1 )
+		TaskTimingStatus_t	xTimingStatus;			/*< The timing statistics of the periods the task has completed using vTaskDelayUntil().  See vTaskGetTimingStatus(). */
+		TickType_t		xTimingRelease;				/*< The tick at which the current period of the task was released. */
+		BaseType_t		xTimingAwaitingStart;		/*< pdTRUE from when the task blocks in vTaskDelayUntil() until it next starts running. */
+		uint32_t		ulTimingExecutionCycles;	/*< The cycles the task has run for during its current period, up to when it was last switched out. */
+	#endif
+
+	#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+		uint64_t		ullMicrosecondWakeTime;		/*< The time at which the task is to be removed from xMicrosecondDelayedList. */
+	#endif
+
+	#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+		uint64_t		ullWakeTime;				/*< The 64-bit tick count at which the task is to be removed from the delayed list.  Only the lower half fits in the list item value. */
+	#endif
+
+	#if ( configUSE_BASIC_TASKS == 1 )
+		TaskFunction_t	pxBasicTaskCode;			/*< The function run each time a basic task is activated, or NULL if the task has its own stack.  See xTaskCreateBasic(). */
+		void			*pvBasicTaskParameters;		/*< The parameter passed to pxBasicTaskCode. */
+		struct tskTaskControlBlock *pxPreemptedBasicTask;	/*< The basic task that was at the top of the shared stack when this basic task started, if any. */
+		BaseType_t		xBasicTaskStarted;			/*< pdTRUE from when a basic task starts running on the shared stack until it completes. */
+		BaseType_t		xBasicTaskNested;			/*< pdTRUE if the basic task was started by a function call made on the shared stack on behalf of pxPreemptedBasicTask, so returns to it when it completes. */
+		UBaseType_t		uxBasicTaskActivations;		/*< Activations made while the basic task was already active, each of which runs it again once it completes. */
+	#endif
+
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -206,6 +282,50 @@ typedef tskTCB TCB_t;
 	#define static
 #endif
 
+/*
+ * With configUSE_64_BIT_TICK_COUNT the tick count is extended to 64 bits, with
+ * xNumOfOverflows as the upper half, and wake times are held in 64 bits.  They
+ * therefore never overflow, so a single delayed list is used and the lists
+ * are never switched.  taskTICK_COUNT_64() must be used with interrupts
+ * masked, from the tick interrupt, or with the scheduler suspended.
+ */
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+	typedef uint64_t WakeTime_t;
+	#define taskNO_WAKE_TIME				( ( WakeTime_t ) 0xffffffffffffffffULL )
+	#define taskTICK_COUNT_64( xTicks )		( ( ( WakeTime_t ) ( uint32_t ) xNumOfOverflows << 32 ) | ( WakeTime_t ) ( xTicks ) )
+	#define taskWAKE_TIME_OF( pxTCB )		( ( pxTCB )->ullWakeTime )
+#else
+	typedef TickType_t WakeTime_t;
+	#define taskNO_WAKE_TIME				portMAX_DELAY
+	#define taskTICK_COUNT_64( xTicks )		( xTicks )
+	#define taskWAKE_TIME_OF( pxTCB )		listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xGenericListItem ) )
+#endif /* configUSE_64_BIT_TICK_COUNT */
+
+/*
+ * The priority a task returns to once it no longer inherits a priority through
+ * a mutex.  With IPC endpoints this is the base priority of the task raised to
+ * the highest priority still donated to it by a client awaiting a reply.  With
+ * task budgets the base priority of a task that is demoted because its budget
+ * is exhausted is first capped at configBUDGET_DEMOTED_PRIORITY, so giving
+ * back a mutex does not undo the demotion.
+ */
+#if ( ( ( configUSE_IPC == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) ) && ( configUSE_MUTEXES == 1 ) )
+	#define taskGET_UNINHERITED_PRIORITY( pxTCB )	prvGetUninheritedPriority( pxTCB )
+#else
+	#define taskGET_UNINHERITED_PRIORITY( pxTCB )	( ( pxTCB )->uxBasePriority )
+#endif
+
+/*
+ * The holder of the mutex a task is blocked on.  A mutex may use the bottom bit
+ * of its holder field as a flag - lightweight mutexes use it to record that a
+ * task is waiting - so the bit is masked off.  Task control blocks are at least
+ * word aligned, so the bit is never part of a handle.
+ */
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+	#define taskBLOCKING_MUTEX_HOLDER_FLAG	( ( portPOINTER_SIZE_TYPE ) 1 )
+	#define taskGET_BLOCKING_MUTEX_HOLDER( pxTCB )	( ( TCB_t * ) ( ( portPOINTER_SIZE_TYPE ) *( ( pxTCB )->ppvBlockingMutexHolder ) & ~taskBLOCKING_MUTEX_HOLDER_FLAG ) ) /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical. */
+#endif
+
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
@@ -214,9 +334,11 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
 PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#if ( configUSE_64_BIT_TICK_COUNT == 0 )
+	PRIVILEGED_DATA static List_t xDelayedTaskList2;					/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;	/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#endif
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -247,7 +369,7 @@ PRIVILEGED_DATA static volatile UBaseType_t uxPendedTicks 			= ( UBaseType_t ) 0
 PRIVILEGED_DATA static volatile BaseType_t xYieldPending 			= pdFALSE;
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 			= ( BaseType_t ) 0;
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber 					= ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime		= ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
+PRIVILEGED_DATA static volatile WakeTime_t xNextTaskUnblockTime		= ( WakeTime_t ) 0U; /* Initialised to taskNO_WAKE_TIME before the scheduler starts. */
 
 /* Context switches are held pending while the scheduler is suspended.  Also,
 interrupts must not manipulate the xGenericListItem of a TCB, or any of the
@@ -259,6 +381,64 @@ when the scheduler is unsuspended.  The pending ready list itself can only be
 accessed from a critical section. */
 PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t ) pdFALSE;
 
+#if ( configUSE_IPC == 1 )
+
+	PRIVILEGED_DATA static TCB_t * volatile pxHandoffTCB = NULL;	/*< A task to switch to directly, without searching the ready lists, on the next context switch.  See vTaskHandoffTo(). */
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	PRIVILEGED_DATA static TCB_t **pxDeadlineHeap = NULL;						/*< Binary heap of the ready tasks of priority configEDF_TASK_PRIORITY that have a deadline, earliest deadline first. */
+	PRIVILEGED_DATA static UBaseType_t uxDeadlineHeapLength = ( UBaseType_t ) 0U;	/*< The number of tasks in the deadline heap. */
+	PRIVILEGED_DATA static UBaseType_t uxDeadlineHeapSize = ( UBaseType_t ) 0U;	/*< The number of tasks the deadline heap has room for. */
+	PRIVILEGED_DATA static UBaseType_t uxDeadlineTasks = ( UBaseType_t ) 0U;		/*< The number of tasks that have a relative deadline, so may be placed in the deadline heap. */
+
+#endif
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	PRIVILEGED_DATA static TCB_t * volatile pxThresholdTCB = NULL;	/*< The task most recently preempted while its preemption threshold was in force.  Each such task links to the one preempted before it, and the threshold of each stays in force until it runs again. */
+
+#endif
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	PRIVILEGED_DATA static List_t xBudgetReplenishList1;						/*< Tasks with a budget replenishment pending, in order of replenishment time. */
+	PRIVILEGED_DATA static List_t xBudgetReplenishList2;						/*< Tasks with a budget replenishment pending (two lists are used - one for replenishment times that have overflowed the current tick count. */
+	PRIVILEGED_DATA static List_t * volatile pxBudgetReplenishList;			/*< Points to the budget replenishment list currently being used. */
+	PRIVILEGED_DATA static List_t * volatile pxOverflowBudgetReplenishList;	/*< Points to the budget replenishment list currently being used to hold replenishment times that have overflowed the current tick count. */
+	PRIVILEGED_DATA static uint32_t ulBudgetLastChargeCycles = 0UL;	/*< The cycle count at which the running task was last charged for its execution. */
+
+#endif
+
+#if ( configUSE_TIMING_MONITOR == 1 )
+
+	PRIVILEGED_DATA static volatile uint32_t ulTimingTickCycles = 0UL;			/*< The cycle count at the most recent tick interrupt. */
+	PRIVILEGED_DATA static volatile TickType_t xTimingTickCount = ( TickType_t ) 0U;	/*< The tick count that tick interrupt advanced time to, including any ticks that are pended. */
+	PRIVILEGED_DATA static uint32_t ulTimingSwitchedInCycles = 0UL;				/*< The cycle count at which the running task was switched in, or completed its last period. */
+
+	#if ( configUSE_DYNAMIC_TICK == 1 )
+		PRIVILEGED_DATA static uint32_t ulTimingTickEdgeCycles = 0UL;			/*< The cycle count at which the tick being announced by xTaskAnnounceTicks() started. */
+	#endif
+
+#endif
+
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+	PRIVILEGED_DATA static List_t xMicrosecondDelayedList;		/*< Tasks blocked in xTaskDelayUntilMicroseconds(), in wake time order.  Only accessed from a critical section, as the compare interrupt accesses it too. */
+	PRIVILEGED_DATA static uint64_t ullMicrosecondNextWakeTime = portMICROSECOND_NO_ALARM;	/*< The wake time the timebase compare is set to. */
+
+#endif
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	PRIVILEGED_DATA static List_t xDormantBasicTaskList;				/*< Basic tasks that are not active. */
+	PRIVILEGED_DATA static StackType_t *pxBasicTaskStack = NULL;		/*< The stack shared by all basic tasks.  Allocated when the first basic task is created. */
+	PRIVILEGED_DATA static TCB_t * volatile pxTopBasicTask = NULL;	/*< The basic task that started most recently and has not yet completed, so is at the top of the shared stack.  Each basic task links to the one it preempted. */
+
+#endif
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
 	PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
@@ -286,6 +466,45 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	/* The ready tasks of configEDF_TASK_PRIORITY that have a deadline are also
+	held in a binary heap keyed on deadline, so the task with the earliest
+	deadline is at its top.  The ready lists for other priorities are indexed
+	through so tasks of equal priority share the processor. */
+	#define taskSELECT_FROM_READY_LIST( uxReadyPriority )													\
+	{																										\
+		if( ( uxReadyPriority ) == ( UBaseType_t ) configEDF_TASK_PRIORITY )								\
+		{																									\
+			pxCurrentTCB = prvSelectDeadlineTask();															\
+		}																									\
+		else																								\
+		{																									\
+			listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxReadyPriority ) ] ) );		\
+		}																									\
+	}
+
+	/* Deadlines are compared by their signed difference so the comparison
+	remains valid when the tick count overflows, provided the two deadlines
+	are within half the range of TickType_t of each other. */
+	#define taskDEADLINE_IS_BEFORE( xDeadline, xOtherDeadline ) ( ( BaseType_t ) ( ( xDeadline ) - ( xOtherDeadline ) ) < ( BaseType_t ) 0 )
+
+	/* The deadline heap is held in an array, with the children of the task at
+	position n at positions 2n + 1 and 2n + 2.  The array is allocated when the
+	first task declares a deadline, and doubled in size whenever it could
+	otherwise become full. */
+	#define taskDEADLINE_HEAP_PARENT( uxPosition )	( ( ( uxPosition ) - ( UBaseType_t ) 1U ) >> 1 )
+	#define taskDEADLINE_HEAP_CHILD( uxPosition )	( ( ( uxPosition ) << 1 ) + ( UBaseType_t ) 1U )
+	#define taskDEADLINE_HEAP_INITIAL_SIZE			( ( UBaseType_t ) 4U )
+
+#else
+
+	#define taskSELECT_FROM_READY_LIST( uxReadyPriority ) listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxReadyPriority ) ] ) )
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -313,9 +532,9 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 			--uxTopReadyPriority;																		\
 		}																								\
 																										\
-		/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of						\
+		/* taskSELECT_FROM_READY_LIST indexes through the list, so the tasks of						\
 		the	same priority get an equal share of the processor time. */									\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopReadyPriority ] ) );		\
+		taskSELECT_FROM_READY_LIST( uxTopReadyPriority );												\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
 	/*-----------------------------------------------------------*/
@@ -344,7 +563,7 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 		/* Find the highest priority queue that contains ready tasks. */							\
 		portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );								\
 		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		taskSELECT_FROM_READY_LIST( uxTopPriority );												\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
 
 	/*-----------------------------------------------------------*/
@@ -364,32 +583,177 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_IPC == 1 )
+
+	/* A handoff target can be switched to directly, rather than by calling
+	taskSELECT_HIGHEST_PRIORITY_TASK(), if it is in the Ready state and no
+	task of a higher priority is ready to run.  When the generic method of task
+	selection is used uxTopReadyPriority is never below the priority of the
+	highest priority ready task, and when the port optimised method is used it
+	holds a bit for each priority that has a ready task. */
+	#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		#define taskHANDOFF_TARGET_IS_HIGHEST( pxTCB ) ( ( pxTCB )->uxPriority >= uxTopReadyPriority )
+	#else
+		#define taskHANDOFF_TARGET_IS_HIGHEST( pxTCB ) ( ( ( uxTopReadyPriority >> ( pxTCB )->uxPriority ) >> 1UL ) == 0UL )
+	#endif
+
+	#define taskSELECT_HANDOFF_OR_HIGHEST_PRIORITY_TASK()																			\
+	{																																\
+		if( ( pxHandoffTCB != NULL ) &&																								\
+			( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxHandoffTCB->uxPriority ] ), &( pxHandoffTCB->xGenericListItem ) ) != pdFALSE ) &&	\
+			( taskHANDOFF_TARGET_IS_HIGHEST( pxHandoffTCB ) ) )																		\
+		{																															\
+			pxCurrentTCB = pxHandoffTCB;																							\
+		}																															\
+		else																														\
+		{																															\
+			taskSELECT_HIGHEST_PRIORITY_TASK();																						\
+		}																															\
+		pxHandoffTCB = NULL;																										\
+	}
+
+#endif /* configUSE_IPC */
+
+#if ( configUSE_IPC == 1 )
+	#define taskSELECT_NEXT_TASK() taskSELECT_HANDOFF_OR_HIGHEST_PRIORITY_TASK()
+#else
+	#define taskSELECT_NEXT_TASK() taskSELECT_HIGHEST_PRIORITY_TASK()
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	/* A task that becomes ready can only preempt the running task if its
+	priority is above both the priority and the preemption threshold of the
+	running task.  A task of the same priority as the running task only shares
+	the processor with it if the threshold of the running task is not above
+	its priority, as a task at or below the threshold cannot run until the
+	running task blocks. */
+	#define taskPREEMPTS_CURRENT_TASK( uxReadyPriority )	( ( ( uxReadyPriority ) > pxCurrentTCB->uxPriority ) && ( ( uxReadyPriority ) > pxCurrentTCB->uxPreemptionThreshold ) )
+	#define taskPREEMPTS_OR_SHARES_WITH_CURRENT_TASK( uxReadyPriority ) ( ( ( ( uxReadyPriority ) == pxCurrentTCB->uxPriority ) && ( pxCurrentTCB->uxPreemptionThreshold <= pxCurrentTCB->uxPriority ) ) || taskPREEMPTS_CURRENT_TASK( uxReadyPriority ) )
+
+#else
+
+	#define taskPREEMPTS_CURRENT_TASK( uxReadyPriority )	( ( uxReadyPriority ) > pxCurrentTCB->uxPriority )
+	#define taskPREEMPTS_OR_SHARES_WITH_CURRENT_TASK( uxReadyPriority ) ( ( uxReadyPriority ) >= pxCurrentTCB->uxPriority )
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	/* A task that becomes ready can also preempt a running task of the same
+	deadline scheduled priority if its deadline is earlier.  Time slicing is not
+	used between deadline scheduled tasks as the task with the earliest deadline
+	is always selected. */
+	#define taskTCB_PREEMPTS_CURRENT_TASK( pxTCB )																\
+		( ( taskPREEMPTS_CURRENT_TASK( ( pxTCB )->uxPriority ) ) ||												\
+		  ( ( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) &&												\
+			( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_TASK_PRIORITY ) &&								\
+			( ( pxTCB )->xHasDeadline != pdFALSE ) &&																\
+			( ( pxCurrentTCB->xHasDeadline == pdFALSE ) || ( taskDEADLINE_IS_BEFORE( ( pxTCB )->xAbsoluteDeadline, pxCurrentTCB->xAbsoluteDeadline ) ) ) ) )
+
+	#define taskPRIORITY_IS_TIME_SLICED( uxReadyPriority ) ( ( uxReadyPriority ) != ( UBaseType_t ) configEDF_TASK_PRIORITY )
+
+#else
+
+	#define taskTCB_PREEMPTS_CURRENT_TASK( pxTCB ) taskPREEMPTS_CURRENT_TASK( ( pxTCB )->uxPriority )
+	#define taskPRIORITY_IS_TIME_SLICED( uxReadyPriority ) ( pdTRUE )
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*-----------------------------------------------------------*/
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
-count overflows. */
-#define taskSWITCH_DELAYED_LISTS()																	\
-{																									\
-	List_t *pxTemp;																					\
+count overflows.  With a 64-bit tick count only the upper half of the count is
+incremented. */
+#if ( configUSE_64_BIT_TICK_COUNT == 0 )
+	#define taskSWITCH_DELAYED_LISTS()																\
+	{																								\
+		List_t *pxTemp;																				\
 																									\
-	/* The delayed tasks list should be empty when the lists are switched. */						\
-	configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );										\
+		/* The delayed tasks list should be empty when the lists are switched. */					\
+		configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );									\
 																									\
-	pxTemp = pxDelayedTaskList;																		\
-	pxDelayedTaskList = pxOverflowDelayedTaskList;													\
-	pxOverflowDelayedTaskList = pxTemp;																\
-	xNumOfOverflows++;																				\
-	prvResetNextTaskUnblockTime();																	\
-}
+		pxTemp = pxDelayedTaskList;																	\
+		pxDelayedTaskList = pxOverflowDelayedTaskList;												\
+		pxOverflowDelayedTaskList = pxTemp;															\
+		xNumOfOverflows++;																			\
+		prvResetNextTaskUnblockTime();																\
+	}
+#else
+	#define taskSWITCH_DELAYED_LISTS()	xNumOfOverflows++
+#endif /* configUSE_64_BIT_TICK_COUNT */
+
+/* Budget replenishment times are held in list item values, so whatever the
+width of the tick count pxBudgetReplenishList and pxOverflowBudgetReplenishList
+are switched when the tick count overflows, as the delayed lists are. */
+#if ( configUSE_TASK_BUDGETS == 1 )
+	#define taskSWITCH_BUDGET_REPLENISH_LISTS()														\
+	{																								\
+		List_t *pxTemp;																				\
+																									\
+		/* The replenishment list should be empty when the lists are switched. */					\
+		configASSERT( ( listLIST_IS_EMPTY( pxBudgetReplenishList ) ) );								\
+																									\
+		pxTemp = pxBudgetReplenishList;																\
+		pxBudgetReplenishList = pxOverflowBudgetReplenishList;										\
+		pxOverflowBudgetReplenishList = pxTemp;														\
+	}
+#else
+	#define taskSWITCH_BUDGET_REPLENISH_LISTS()
+#endif /* configUSE_TASK_BUDGETS */
 
 /*-----------------------------------------------------------*/
 
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted at the end of the list.
+ * the task.  It is inserted at the end of the list, and also into the deadline
+ * heap if it is a deadline scheduled task.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	#define taskINSERT_INTO_READY_LIST( pxTCB ) prvInsertIntoReadyList( pxTCB )
+#else
+	#define taskINSERT_INTO_READY_LIST( pxTCB ) vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xGenericListItem ) )
+#endif
+
+/*
+ * With the dynamic tick the tick interrupt is only generated when the kernel
+ * has something to do.  taskDYNAMIC_TICK_SYNC() brings the tick count up to
+ * date before it is used to calculate a wake or timeout time, and
+ * taskDYNAMIC_TICK_UPDATE() moves the next tick interrupt if the time of the
+ * next event may have changed.  A task becoming ready at the priority of the
+ * running task may mean the two must now be time sliced.
+ */
+#if ( configUSE_DYNAMIC_TICK == 1 )
+	#define taskDYNAMIC_TICK_SYNC()		vPortDynamicTickSync()
+	#define taskDYNAMIC_TICK_UPDATE()	vPortDynamicTickUpdate()
+	#define taskDYNAMIC_TICK_READIED( pxTCB )														\
+		if( ( xSchedulerRunning != pdFALSE ) && ( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) )	\
+		{																							\
+			vPortDynamicTickUpdate();																\
+		}
+#else
+	#define taskDYNAMIC_TICK_SYNC()
+	#define taskDYNAMIC_TICK_UPDATE()
+	#define taskDYNAMIC_TICK_READIED( pxTCB )
+#endif /* configUSE_DYNAMIC_TICK */
+
+/*
+ * Basic tasks run to completion on the shared stack, so the running task is
+ * only allowed to leave the ready state if it has a stack of its own.
  */
+#if ( configUSE_BASIC_TASKS == 1 )
+	#define taskASSERT_CURRENT_TASK_CAN_BLOCK()	configASSERT( pxCurrentTCB->pxBasicTaskCode == NULL )
+#else
+	#define taskASSERT_CURRENT_TASK_CAN_BLOCK()
+#endif /* configUSE_BASIC_TASKS */
+
 #define prvAddTaskToReadyList( pxTCB )																\
 	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
-	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xGenericListItem ) )
+	taskINSERT_INTO_READY_LIST( pxTCB );															\
+	taskDYNAMIC_TICK_READIED( pxTCB )
 /*-----------------------------------------------------------*/
 
 /*
@@ -414,6 +778,28 @@ to its original value when it is released. */
 	#define taskEVENT_LIST_ITEM_VALUE_IN_USE	0x80000000UL
 #endif
 
+#if ( ( configUSE_TIMING_MONITOR == 1 ) || ( configUSE_DYNAMIC_TICK == 1 ) )
+
+	/* The number of CPU cycles in one tick period, used to convert tick counts
+	to the cycle counter timestamps of the timing monitor, and budgets to the
+	number of ticks that can pass before they are exhausted. */
+	#define taskCYCLES_PER_TICK	( ( uint32_t ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) )
+
+#endif /* ( configUSE_TIMING_MONITOR == 1 ) || ( configUSE_DYNAMIC_TICK == 1 ) */
+
+/*
+ * The cycle count the timing monitor timestamps a tick with.  With the dynamic
+ * tick a tick can be processed well after the tick period started, even from a
+ * task, so the time the period started is passed in by the port.
+ */
+#if ( configUSE_TIMING_MONITOR == 1 )
+	#if ( configUSE_DYNAMIC_TICK == 1 )
+		#define taskTIMING_TICK_CYCLES()	ulTimingTickEdgeCycles
+	#else
+		#define taskTIMING_TICK_CYCLES()	portGET_CYCLE_COUNT()
+	#endif
+#endif /* configUSE_TIMING_MONITOR */
+
 /* Callback function prototypes. --------------------------*/
 #if configCHECK_FOR_STACK_OVERFLOW > 0
 	extern void vApplicationStackOverflowHook( TaskHandle_t xTask, char *pcTaskName );
@@ -440,6 +826,196 @@ static void prvInitialiseTCBVariables( TCB_t * const pxTCB, const char * const p
 	static BaseType_t prvTaskIsTaskSuspended( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif /* INCLUDE_vTaskSuspend */
 
+/*
+ * The two halves of vTaskSwitchContext() either side of the selection of the
+ * next task.  prvSwitchOutCurrentTask() accounts for the time the running task
+ * has run, and prvSwitchInCurrentTask() prepares for running the task
+ * pxCurrentTCB then points to.  Basic tasks that start or complete without a
+ * context switch use them too.
+ */
+static void prvSwitchOutCurrentTask( void ) PRIVILEGED_FUNCTION;
+static void prvSwitchInCurrentTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by vTaskSwitchContext() in place of taskSELECT_NEXT_TASK() when tasks
+ * have preemption thresholds.  The running task keeps the processor if it is
+ * still ready and no ready task has a priority above its threshold.  If it is
+ * preempted instead its threshold stays in force - it is pushed onto the stack
+ * headed by pxThresholdTCB, and a task selected to run that is not above the
+ * threshold of the task at the top of the stack is replaced by that task.
+ */
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+	static void prvSelectTaskWithThresholds( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Removes pxTCB from the stack of tasks preempted while their preemption
+	 * threshold was in force, if it is in it.
+	 */
+	static void prvRemoveFromThresholdStack( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	/*
+	 * Every basic task starts in this function, which runs the task function
+	 * and then returns the task to the dormant state.  pvParameters is the TCB
+	 * of the task.
+	 */
+	static portTASK_FUNCTION_PROTO( prvBasicTaskEntry, pvParameters );
+
+	/*
+	 * Runs the basic task pxTCB, which must already be the running task, on
+	 * the current stack.  When it completes the next task to run is switched
+	 * to without a context switch if that is possible - a basic task that
+	 * would start at the same place on the shared stack is run by the same
+	 * call, and a task started by a function call returns to the basic task
+	 * that made it.
+	 */
+	static void prvRunBasicTask( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Makes pxTCB, a basic task that has not started, the running task at the
+	 * top of the shared stack above pxPreempted, without a context switch.
+	 * xNested is pdTRUE if pxTCB is being started by a function call made on
+	 * behalf of pxPreempted.
+	 */
+	static void prvStartBasicTaskInPlace( TCB_t * const pxTCB, TCB_t * const pxPreempted, const BaseType_t xNested ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the task that vTaskSwitchContext() would certainly select if it
+	 * were called now, or NULL if that cannot be known without running the
+	 * selection.  A task is only returned if it is the only ready task of the
+	 * highest ready priority, and no preemption threshold or directed handoff
+	 * can change the selection.
+	 */
+	static TCB_t *prvGetCertainNextTask( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Utility used by vTaskSwitchContext() once the next task has been
+	 * selected.  A basic task that has not yet started is started on the
+	 * shared stack if its priority is above that of the basic task at the top
+	 * of the stack, otherwise the basic task at the top of the stack runs in
+	 * its place.
+	 */
+	static void prvSwitchInBasicTask( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_BASIC_TASKS */
+
+/*
+ * Inserts pxTCB into the ready list for its priority.  A task of priority
+ * configEDF_TASK_PRIORITY that has a deadline is also inserted into the
+ * deadline heap, and a task of any other priority is removed from it.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	static void prvInsertIntoReadyList( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*
+ * Sets the absolute deadline of pxTCB, and inserts the task into, moves it
+ * within, or removes it from the deadline heap to match.  Must be called from
+ * a critical section or with the scheduler suspended.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	static void prvSetDeadline( TCB_t * const pxTCB, const BaseType_t xHasDeadline, const TickType_t xAbsoluteDeadline ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*
+ * Sets the relative deadline of pxTCB.  When a task declares its first
+ * deadline the deadline heap is grown if necessary, so it always has room for
+ * every task that has a relative deadline.  Returns pdFAIL if the heap could
+ * not be grown.  Must be called with the scheduler suspended.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	static BaseType_t prvSetRelativeDeadline( TCB_t * const pxTCB, const TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*
+ * Functions that maintain the deadline heap.  prvDeadlineHeapSift() moves the
+ * task at uxPosition up or down the heap until its deadline is in order, and
+ * prvDeadlineHeapRemove() does nothing if pxTCB is not in the heap.  Each
+ * takes time proportional to the logarithm of the number of tasks in the heap.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	static void prvDeadlineHeapInsert( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvDeadlineHeapRemove( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvDeadlineHeapSift( UBaseType_t uxPosition ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*
+ * Returns the ready task of priority configEDF_TASK_PRIORITY that should run:
+ * the one with the earliest deadline, or if none of them has a deadline the
+ * next one in the ready list.
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	static TCB_t *prvSelectDeadlineTask( void ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*
+ * Charges the running task for the cycles that have elapsed since the last
+ * charge.  Returns pdTRUE if the running task has a budget that is not already
+ * being enforced, and the charge used the last of it.
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+	static BaseType_t prvBudgetCharge( void ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TASK_BUDGETS */
+
+/*
+ * Ends the current activation of pxTCB, scheduling the return of the cycles
+ * it consumed one replenishment period after the activation started.
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+	static void prvBudgetEndActivation( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TASK_BUDGETS */
+
+/*
+ * Demotes or suspends the running task, pxTCB, once its budget is exhausted,
+ * and the matching function that undoes that once the budget is replenished.
+ * prvBudgetRelease() returns pdTRUE if the released task should preempt the
+ * running task.  Both must be called from a critical section or the tick
+ * interrupt.
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+	static void prvBudgetEnforce( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static BaseType_t prvBudgetRelease( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TASK_BUDGETS */
+
+/*
+ * Changes the priority of pxTCB, moving it to the matching ready list if it is
+ * ready to run.  Used to demote a task and to restore it again.
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+	static void prvBudgetSetPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TASK_BUDGETS */
+
+/*
+ * Returns the cycle count at which the tick count reached xTick, worked back
+ * from the timestamp of the most recent tick interrupt.  Must be called from a
+ * critical section or with interrupts masked.
+ */
+#if ( configUSE_TIMING_MONITOR == 1 )
+	static uint32_t prvTimingCyclesAtTick( const TickType_t xTick ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TIMING_MONITOR */
+
+/*
+ * Record the time at which the current period of pxTCB started running, and
+ * the time at which it completed.  The cycle counts are passed in so they can
+ * be read as close to the event as possible.
+ */
+#if ( configUSE_TIMING_MONITOR == 1 )
+	static void prvTimingRecordStart( TCB_t * const pxTCB, const uint32_t ulReleaseCycles, const uint32_t ulStartCycles ) PRIVILEGED_FUNCTION;
+	static void prvTimingRecordCompletion( TCB_t * const pxTCB, const uint32_t ulReleaseCycles, const uint32_t ulCompletionCycles, const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TIMING_MONITOR */
+
+/*
+ * Insert pxTCB into xMicrosecondDelayedList behind the tasks that wake no
+ * later than it, so the list is kept in wake time order.  vListInsert() cannot
+ * be used as a list item value cannot hold a 64-bit wake time.  Must be called
+ * from a critical section.
+ */
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+	static void prvInsertMicrosecondDelayed( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+
 /*
  * Utility to ready all the lists used by the scheduler.  This is called
  * automatically upon the creation of the first task.
@@ -537,6 +1113,68 @@ static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t *
  */
 static void prvResetNextTaskUnblockTime( void );
 
+/*
+ * Process the ticks that were pended while the scheduler was suspended.  The
+ * tick count is stepped over the pended ticks in one go, and the delayed list
+ * is then checked once, rather than once per pended tick.
+ */
+#if ( configUSE_BATCHED_PENDED_TICKS == 1 )
+
+	static BaseType_t prvProcessPendedTicks( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	/*
+	 * Returns the list of tasks waiting for the mutex that pxTCB is blocked on,
+	 * or NULL if pxTCB is not blocked on a mutex.
+	 */
+	static List_t *prvGetBlockingMutexWaitList( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Set the priority of a task that holds a mutex to uxNewPriority, moving
+	 * it between the ready lists if it is ready, and re-sorting it within the
+	 * list of tasks waiting for a mutex if it is itself blocked on one.
+	 */
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called after pxTCB has inherited uxPriority.  If pxTCB is blocked on a
+	 * mutex then the holder of that mutex inherits uxPriority too, and so on
+	 * along the chain, to a depth of configMAX_PRIORITY_INHERITANCE_DEPTH.
+	 */
+	static void prvInheritAlongChain( TCB_t *pxTCB, const UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the priority pxTCB needs while it holds the mutexes it holds - the
+	 * higher of its uninherited priority and the priority of the highest
+	 * priority task waiting for any mutex in its xContendedMutexList.
+	 */
+	static UBaseType_t prvGetHighestContendedPriority( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called after a task of priority uxLeavingPriority has stopped waiting for
+	 * a mutex held by pxTCB, without obtaining it.  Lowers the priority pxTCB
+	 * inherited to that returned by prvGetHighestContendedPriority(), and so on
+	 * along the chain.
+	 */
+	static void prvDisinheritAlongChain( TCB_t *pxTCB, const UBaseType_t uxLeavingPriority ) PRIVILEGED_FUNCTION;
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+
+#if ( ( ( configUSE_IPC == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) ) && ( configUSE_MUTEXES == 1 ) )
+
+	/*
+	 * Returns the base priority of pxTCB, capped while pxTCB is demoted by its
+	 * budget, or the highest priority donated to pxTCB by an IPC call it has
+	 * not yet replied to if that is higher.  See
+	 * taskGET_UNINHERITED_PRIORITY().
+	 */
+	static UBaseType_t prvGetUninheritedPriority( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* ( ( configUSE_IPC == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) ) && ( configUSE_MUTEXES == 1 ) */
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -720,7 +1358,7 @@ StackType_t *pxTopOfStack;
 		{
 			/* If the created task is of a higher priority than the current task
 			then it should run now. */
-			if( pxCurrentTCB->uxPriority < uxPriority )
+			if( taskPREEMPTS_CURRENT_TASK( uxPriority ) )
 			{
 				taskYIELD_IF_USING_PREEMPTION();
 			}
@@ -751,6 +1389,21 @@ StackType_t *pxTopOfStack;
 			being deleted. */
 			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
 
+			#if ( configUSE_BASIC_TASKS == 1 )
+			{
+				/* Basic tasks do not own their stack, so cannot be deleted. */
+				configASSERT( pxTCB->pxBasicTaskCode == NULL );
+			}
+			#endif /* configUSE_BASIC_TASKS */
+
+			#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+			{
+				/* The task may have been deleted while it was preempted with its
+				threshold in force. */
+				prvRemoveFromThresholdStack( pxTCB );
+			}
+			#endif /* configUSE_PREEMPTION_THRESHOLD */
+
 			/* Remove task from the ready list and place in the	termination list.
 			This will stop the task from be scheduled.  The idle task will check
 			the termination list and free up any memory allocated by the
@@ -764,18 +1417,85 @@ StackType_t *pxTopOfStack;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if ( configUSE_EDF_SCHEDULING == 1 )
+			{
+				/* The deadline heap no longer needs room for the task. */
+				if( pxTCB->xRelativeDeadline != ( TickType_t ) 0U )
+				{
+					uxDeadlineTasks--;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvDeadlineHeapRemove( pxTCB );
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
 			/* Is the task waiting on an event also? */
 			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
 			{
-				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+				{
+				List_t * const pxWaitList = prvGetBlockingMutexWaitList( pxTCB );
+
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+
+					/* If the task was waiting for a mutex then the holder of
+					the mutex may have inherited its priority. */
+					if( pxWaitList != NULL )
+					{
+						prvDisinheritAlongChain( taskGET_BLOCKING_MUTEX_HOLDER( pxTCB ), pxTCB->uxPriority );
+						pxTCB->ppvBlockingMutexHolder = NULL;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#else
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				#endif
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if ( configUSE_TASK_BUDGETS == 1 )
+			{
+				/* Discard any budget replenishment that is pending. */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TASK_BUDGETS */
+
 			vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xGenericListItem ) );
 
+			#if ( configUSE_IPC == 1 )
+			{
+				/* Don't leave a handoff pending to a task that no longer
+				exists. */
+				if( pxHandoffTCB == pxTCB )
+				{
+					pxHandoffTCB = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_IPC */
+
 			/* Increment the ucTasksDeleted variable so the idle task knows
 			there is a task that has been deleted and that it should therefore
 			check the xTasksWaitingTermination list. */
@@ -827,17 +1547,31 @@ StackType_t *pxTopOfStack;
 	{
 	TickType_t xTimeToWake;
 	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+	#if ( configUSE_TIMING_MONITOR == 1 )
+		uint32_t ulCompletionCycles, ulReleaseCycles, ulNextReleaseCycles;
+	#endif
 
 		configASSERT( pxPreviousWakeTime );
 		configASSERT( ( xTimeIncrement > 0U ) );
 		configASSERT( uxSchedulerSuspended == 0 );
 
+		taskDYNAMIC_TICK_SYNC();
 		vTaskSuspendAll();
 		{
 			/* Minor optimisation.  The tick count cannot change in this
 			block. */
 			const TickType_t xConstTickCount = xTickCount;
 
+			#if ( configUSE_TIMING_MONITOR == 1 )
+			{
+				/* The period the task is running in completes now.  The
+				sample is taken with the scheduler suspended so the task
+				cannot be switched out, and switched in again later than the
+				sample, before the execution time is calculated from it. */
+				ulCompletionCycles = portGET_CYCLE_COUNT();
+			}
+			#endif
+
 			/* Generate the tick time at which the task wants to wake. */
 			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
 
@@ -872,6 +1606,34 @@ StackType_t *pxTopOfStack;
 				}
 			}
 
+			#if ( configUSE_TIMING_MONITOR == 1 )
+			{
+				/* The tick interrupt can still update its timestamp while
+				the scheduler is suspended. */
+				taskENTER_CRITICAL();
+				{
+					ulReleaseCycles = prvTimingCyclesAtTick( *pxPreviousWakeTime );
+					ulNextReleaseCycles = prvTimingCyclesAtTick( xTimeToWake );
+				}
+				taskEXIT_CRITICAL();
+
+				prvTimingRecordCompletion( pxCurrentTCB, ulReleaseCycles, ulCompletionCycles, xTimeIncrement );
+				pxCurrentTCB->xTimingRelease = xTimeToWake;
+
+				/* If the next period has already been released the task
+				starts it straight away, otherwise the start is recorded when
+				the task is next switched in. */
+				if( xShouldDelay != pdFALSE )
+				{
+					pxCurrentTCB->xTimingAwaitingStart = pdTRUE;
+				}
+				else
+				{
+					prvTimingRecordStart( pxCurrentTCB, ulNextReleaseCycles, portGET_CYCLE_COUNT() );
+				}
+			}
+			#endif /* configUSE_TIMING_MONITOR */
+
 			/* Update the wake time ready for the next call. */
 			*pxPreviousWakeTime = xTimeToWake;
 
@@ -879,6 +1641,8 @@ StackType_t *pxTopOfStack;
 			{
 				traceTASK_DELAY_UNTIL();
 
+				taskASSERT_CURRENT_TASK_CAN_BLOCK();
+
 				/* Remove the task from the ready list before adding it to the
 				blocked list as the same list item is used for both lists. */
 				if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
@@ -899,6 +1663,23 @@ StackType_t *pxTopOfStack;
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			#if ( configUSE_EDF_SCHEDULING == 1 )
+			{
+				/* A task that has declared a relative deadline is given the
+				absolute deadline of its next release, measured from the wake
+				time.  The task is no longer ready, so this also takes it out of
+				the deadline heap. */
+				if( pxCurrentTCB->xRelativeDeadline != ( TickType_t ) 0U )
+				{
+					prvSetDeadline( pxCurrentTCB, pdTRUE, xTimeToWake + pxCurrentTCB->xRelativeDeadline );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
 		}
 		xAlreadyYielded = xTaskResumeAll();
 
@@ -929,6 +1710,7 @@ StackType_t *pxTopOfStack;
 		if( xTicksToDelay > ( TickType_t ) 0U )
 		{
 			configASSERT( uxSchedulerSuspended == 0 );
+			taskDYNAMIC_TICK_SYNC();
 			vTaskSuspendAll();
 			{
 				traceTASK_DELAY();
@@ -945,6 +1727,8 @@ StackType_t *pxTopOfStack;
 				not a problem. */
 				xTimeToWake = xTickCount + xTicksToDelay;
 
+				taskASSERT_CURRENT_TASK_CAN_BLOCK();
+
 				/* We must remove ourselves from the ready list before adding
 				ourselves to the blocked list as the same list item is used for
 				both lists. */
@@ -983,6 +1767,197 @@ StackType_t *pxTopOfStack;
 #endif /* INCLUDE_vTaskDelay */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+	uint64_t ullTaskGetMicroseconds( void )
+	{
+		return ullPortGetMicroseconds();
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+	BaseType_t xTaskDelayUntilMicroseconds( const uint64_t ullWakeTime )
+	{
+	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+
+		configASSERT( uxSchedulerSuspended == 0 );
+
+		vTaskSuspendAll();
+		{
+			/* The compare interrupt cannot move a task into the ready lists
+			while the scheduler is suspended, but it does access
+			xMicrosecondDelayedList. */
+			taskENTER_CRITICAL();
+			{
+				if( ullWakeTime > ullPortGetMicroseconds() )
+				{
+					traceTASK_DELAY();
+
+					taskASSERT_CURRENT_TASK_CAN_BLOCK();
+
+					/* The same list item is used for the ready and the
+					delayed lists, as in vTaskDelay(). */
+					if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+					{
+						portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxCurrentTCB->ullMicrosecondWakeTime = ullWakeTime;
+					prvInsertMicrosecondDelayed( pxCurrentTCB );
+
+					if( ullWakeTime < ullMicrosecondNextWakeTime )
+					{
+						ullMicrosecondNextWakeTime = ullWakeTime;
+						vPortSetMicrosecondAlarm( ullWakeTime );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xShouldDelay = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+		xAlreadyYielded = xTaskResumeAll();
+
+		if( ( xShouldDelay != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xShouldDelay;
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+	BaseType_t xTaskMicrosecondAlarm( void )
+	{
+	ListItem_t *pxIterator, *pxNext;
+	TCB_t *pxTCB;
+	uint64_t ullNow, ullNextWakeTime = portMICROSECOND_NO_ALARM;
+	BaseType_t xSwitchRequired = pdFALSE;
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ullNow = ullPortGetMicroseconds();
+
+			/* The list is in wake time order, so only the tasks at its head
+			need be looked at.  Tasks already woken while the scheduler was
+			suspended are at the head too, until xTaskResumeAll() removes
+			them. */
+			pxIterator = listGET_HEAD_ENTRY( &xMicrosecondDelayedList );
+			while( pxIterator != ( ListItem_t * ) listGET_END_MARKER( &xMicrosecondDelayedList ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+			{
+				pxNext = listGET_NEXT( pxIterator );
+				pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+
+				if( pxTCB->ullMicrosecondWakeTime > ullNow )
+				{
+					/* This and all the tasks behind it are still to wake. */
+					ullNextWakeTime = pxTCB->ullMicrosecondWakeTime;
+					break;
+				}
+				else if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					/* Already woken while the scheduler was suspended, and
+					waiting in xPendingReadyList. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+				else
+				{
+					if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+					{
+						( void ) uxListRemove( pxIterator );
+						prvAddTaskToReadyList( pxTCB );
+
+						if( taskTCB_PREEMPTS_CURRENT_TASK( pxTCB ) )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						/* xTaskResumeAll() removes the task from this list
+						when it moves it to the ready list. */
+						vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					}
+				}
+
+				pxIterator = pxNext;
+			}
+
+			ullMicrosecondNextWakeTime = ullNextWakeTime;
+			vPortSetMicrosecondAlarm( ullNextWakeTime );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xSwitchRequired;
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+	static void prvInsertMicrosecondDelayed( TCB_t * const pxTCB )
+	{
+	ListItem_t *pxIterator;
+	ListItem_t * const pxNewListItem = &( pxTCB->xGenericListItem );
+
+		/* Find the last task that wakes no later than pxTCB, searching back
+		from the end as a periodic task usually wakes after those already
+		waiting. */
+		pxIterator = ( ListItem_t * ) xMicrosecondDelayedList.xListEnd.pxPrevious;
+		while( pxIterator != ( ListItem_t * ) listGET_END_MARKER( &xMicrosecondDelayedList ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		{
+			if( ( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) )->ullMicrosecondWakeTime <= pxTCB->ullMicrosecondWakeTime )
+			{
+				break;
+			}
+			else
+			{
+				pxIterator = pxIterator->pxPrevious;
+			}
+		}
+
+		/* As in vListInsert(). */
+		pxNewListItem->pxNext = pxIterator->pxNext;
+		pxNewListItem->pxNext->pxPrevious = pxNewListItem;
+		pxNewListItem->pxPrevious = pxIterator;
+		pxIterator->pxNext = pxNewListItem;
+		pxNewListItem->pvContainer = ( void * ) &xMicrosecondDelayedList;
+
+		( xMicrosecondDelayedList.uxNumberOfItems )++;
+	}
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_eTaskGetState == 1 )
 
 	eTaskState eTaskGetState( TaskHandle_t xTask )
@@ -1006,7 +1981,11 @@ StackType_t *pxTopOfStack;
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			#if ( configUSE_64_BIT_TICK_COUNT == 0 )
+				if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			#else
+				if( pxStateList == pxDelayedTaskList )
+			#endif
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1030,6 +2009,14 @@ StackType_t *pxTopOfStack;
 				}
 			#endif
 
+			#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+				else if( pxStateList == &xMicrosecondDelayedList )
+				{
+					/* The task is blocked in xTaskDelayUntilMicroseconds(). */
+					eReturn = eBlocked;
+				}
+			#endif
+
 			#if ( INCLUDE_vTaskDelete == 1 )
 				else if( pxStateList == &xTasksWaitingTermination )
 				{
@@ -1039,6 +2026,23 @@ StackType_t *pxTopOfStack;
 				}
 			#endif
 
+			#if ( configUSE_BASIC_TASKS == 1 )
+				else if( pxStateList == &xDormantBasicTaskList )
+				{
+					/* A dormant basic task is reported as suspended, unless it
+					has been activated from an interrupt while the scheduler
+					was suspended. */
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL )
+					{
+						eReturn = eSuspended;
+					}
+					else
+					{
+						eReturn = eReady;
+					}
+				}
+			#endif
+
 			else /*lint !e525 Negative indentation is intended to make use of pre-processor clearer. */
 			{
 				/* If the task is not in any other state, it must be in the
@@ -1075,6 +2079,43 @@ StackType_t *pxTopOfStack;
 #endif /* INCLUDE_uxTaskPriorityGet */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_uxTaskPriorityGet == 1 ) )
+
+	UBaseType_t uxTaskBasePriorityGet( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the base priority of the
+			task that called uxTaskBasePriorityGet() that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxBasePriority;
+
+			#if ( configUSE_CEILING_MUTEXES == 1 )
+			{
+				/* While the task holds a ceiling mutex its base priority is the
+				ceiling, and the priority it was assigned is saved. */
+				if( listLIST_IS_EMPTY( &( pxTCB->xCeilingMutexList ) ) == pdFALSE )
+				{
+					uxReturn = pxTCB->uxCeilingSavedBasePriority;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_CEILING_MUTEXES */
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( INCLUDE_uxTaskPriorityGet == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_uxTaskPriorityGet == 1 )
 
 	UBaseType_t uxTaskPriorityGetFromISR( TaskHandle_t xTask )
@@ -1164,7 +2205,7 @@ StackType_t *pxTopOfStack;
 						/* The priority of a task other than the currently
 						running task is being raised.  Is the priority being
 						raised above that of the running task? */
-						if( uxNewPriority >= pxCurrentTCB->uxPriority )
+						if( taskPREEMPTS_OR_SHARES_WITH_CURRENT_TASK( uxNewPriority ) )
 						{
 							xYieldRequired = pdTRUE;
 						}
@@ -1201,19 +2242,23 @@ StackType_t *pxTopOfStack;
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
+				UBaseType_t uxUninheritedPriority = taskGET_UNINHERITED_PRIORITY( pxTCB );
+
+					/* The base priority gets set whatever. */
+					pxTCB->uxBasePriority = uxNewPriority;
+
 					/* Only change the priority being used if the task is not
-					currently using an inherited priority. */
-					if( pxTCB->uxBasePriority == pxTCB->uxPriority )
+					currently using an inherited priority.  The priority used
+					is the base priority unless a priority is donated to the
+					task or the base priority is capped by a budget. */
+					if( uxUninheritedPriority == pxTCB->uxPriority )
 					{
-						pxTCB->uxPriority = uxNewPriority;
+						pxTCB->uxPriority = taskGET_UNINHERITED_PRIORITY( pxTCB );
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-
-					/* The base priority gets set whatever. */
-					pxTCB->uxBasePriority = uxNewPriority;
 				}
 				#else
 				{
@@ -1291,6 +2336,14 @@ StackType_t *pxTopOfStack;
 			being suspended. */
 			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
 
+			#if ( configUSE_BASIC_TASKS == 1 )
+			{
+				/* A basic task that has started cannot be set aside while it
+				holds the shared stack, so basic tasks cannot be suspended. */
+				configASSERT( pxTCB->pxBasicTaskCode == NULL );
+			}
+			#endif /* configUSE_BASIC_TASKS */
+
 			traceTASK_SUSPEND( pxTCB );
 
 			/* Remove task from the ready/delayed list and place in the
@@ -1304,10 +2357,38 @@ StackType_t *pxTopOfStack;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if ( configUSE_EDF_SCHEDULING == 1 )
+			{
+				prvDeadlineHeapRemove( pxTCB );
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
 			/* Is the task waiting on an event also? */
 			if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
 			{
-				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+				{
+				List_t * const pxWaitList = prvGetBlockingMutexWaitList( pxTCB );
+
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+
+					/* If the task was waiting for a mutex then the holder of
+					the mutex may have inherited its priority. */
+					if( pxWaitList != NULL )
+					{
+						prvDisinheritAlongChain( taskGET_BLOCKING_MUTEX_HOLDER( pxTCB ), pxTCB->uxPriority );
+						pxTCB->ppvBlockingMutexHolder = NULL;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#else
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				#endif
 			}
 			else
 			{
@@ -1439,7 +2520,7 @@ StackType_t *pxTopOfStack;
 					prvAddTaskToReadyList( pxTCB );
 
 					/* We may have just resumed a higher priority task. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskPREEMPTS_OR_SHARES_WITH_CURRENT_TASK( pxTCB->uxPriority ) )
 					{
 						/* This yield may not cause the task just resumed to run,
 						but will leave the lists in the correct state for the
@@ -1507,7 +2588,7 @@ StackType_t *pxTopOfStack;
 				{
 					/* Ready lists can be accessed so move the task from the
 					suspended list to the ready list directly. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskPREEMPTS_OR_SHARES_WITH_CURRENT_TASK( pxTCB->uxPriority ) )
 					{
 						xYieldRequired = pdTRUE;
 					}
@@ -1588,7 +2669,7 @@ BaseType_t xReturn;
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
-		xNextTaskUnblockTime = portMAX_DELAY;
+		xNextTaskUnblockTime = taskNO_WAKE_TIME;
 		xSchedulerRunning = pdTRUE;
 		xTickCount = ( TickType_t ) 0U;
 
@@ -1597,6 +2678,13 @@ BaseType_t xReturn;
 		the run time counter time base. */
 		portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
 
+		#if ( configUSE_TIMING_MONITOR == 1 )
+		{
+			/* The timing monitor timestamps events with the cycle counter. */
+			portENABLE_CYCLE_COUNTER();
+		}
+		#endif /* configUSE_TIMING_MONITOR */
+
 		/* Setting up the timer tick is hardware specific and thus in the
 		portable interface. */
 		if( xPortStartScheduler() != pdFALSE )
@@ -1701,7 +2789,7 @@ BaseType_t xAlreadyYielded = pdFALSE;
 
 					/* If the moved task has a priority higher than the current
 					task then a yield must be performed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskPREEMPTS_OR_SHARES_WITH_CURRENT_TASK( pxTCB->uxPriority ) )
 					{
 						xYieldPending = pdTRUE;
 					}
@@ -1717,9 +2805,9 @@ BaseType_t xAlreadyYielded = pdFALSE;
 				time. */
 				if( uxPendedTicks > ( UBaseType_t ) 0U )
 				{
-					while( uxPendedTicks > ( UBaseType_t ) 0U )
+					#if ( configUSE_BATCHED_PENDED_TICKS == 1 )
 					{
-						if( xTaskIncrementTick() != pdFALSE )
+						if( prvProcessPendedTicks() != pdFALSE )
 						{
 							xYieldPending = pdTRUE;
 						}
@@ -1727,8 +2815,23 @@ BaseType_t xAlreadyYielded = pdFALSE;
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
-						--uxPendedTicks;
 					}
+					#else
+					{
+						while( uxPendedTicks > ( UBaseType_t ) 0U )
+						{
+							if( xTaskIncrementTick() != pdFALSE )
+							{
+								xYieldPending = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+							--uxPendedTicks;
+						}
+					}
+					#endif /* configUSE_BATCHED_PENDED_TICKS */
 				}
 				else
 				{
@@ -1765,6 +2868,8 @@ TickType_t xTaskGetTickCount( void )
 {
 TickType_t xTicks;
 
+	taskDYNAMIC_TICK_SYNC();
+
 	/* Critical section required if running on a 16 bit processor. */
 	portTICK_TYPE_ENTER_CRITICAL();
 	{
@@ -1797,6 +2902,8 @@ UBaseType_t uxSavedInterruptStatus;
 	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
 	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
+	taskDYNAMIC_TICK_SYNC();
+
 	uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
 	{
 		xReturn = xTickCount;
@@ -1807,11 +2914,36 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxTaskGetNumberOfTasks( void )
-{
-	/* A critical section is not required because the variables are of type
-	BaseType_t. */
-	return uxCurrentNumberOfTasks;
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+
+	uint64_t ullTaskGetTickCount64( void )
+	{
+	uint64_t ullReturn;
+	UBaseType_t uxSavedInterruptStatus;
+
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		taskDYNAMIC_TICK_SYNC();
+
+		/* Unlike the 32-bit tick count, the two halves cannot be read in one
+		access, and the tick interrupt updates them one after the other. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ullReturn = taskTICK_COUNT_64( xTickCount );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return ullReturn;
+	}
+
+#endif /* configUSE_64_BIT_TICK_COUNT */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTaskGetNumberOfTasks( void )
+{
+	/* A critical section is not required because the variables are of type
+	BaseType_t. */
+	return uxCurrentNumberOfTasks;
 }
 /*-----------------------------------------------------------*/
 
@@ -1853,7 +2985,17 @@ UBaseType_t uxTaskGetNumberOfTasks( void )
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
 				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if ( configUSE_64_BIT_TICK_COUNT == 0 )
+				{
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#endif
+
+				#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+				{
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xMicrosecondDelayedList, eBlocked );
+				}
+				#endif
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -1871,6 +3013,13 @@ UBaseType_t uxTaskGetNumberOfTasks( void )
 				}
 				#endif
 
+				#if ( configUSE_BASIC_TASKS == 1 )
+				{
+					/* Dormant basic tasks are reported as suspended. */
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xDormantBasicTaskList, eSuspended );
+				}
+				#endif
+
 				#if ( configGENERATE_RUN_TIME_STATS == 1)
 				{
 					if( pulTotalRunTime != NULL )
@@ -1936,10 +3085,249 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 #endif /* configUSE_TICKLESS_IDLE */
 /*----------------------------------------------------------*/
 
+#if ( configUSE_DYNAMIC_TICK == 1 )
+
+	TickType_t xTaskGetTicksToNextEvent( void )
+	{
+	TickType_t xTicks;
+
+		/* Ticks that occur while the scheduler is suspended are pended, and
+		are processed one at a time when it is resumed, so the tick is not
+		suppressed while that is outstanding. */
+		if( ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE ) || ( uxPendedTicks != ( UBaseType_t ) 0U ) )
+		{
+			return ( TickType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The next task to unblock.  xNextTaskUnblockTime is portMAX_DELAY
+		if no task is blocked with a timeout, which ends the wait no later
+		than the tick count wrapping. */
+		#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+		{
+			if( xNextTaskUnblockTime <= taskTICK_COUNT_64( xTickCount ) )
+			{
+				xTicks = ( TickType_t ) 0U;
+			}
+			else if( ( xNextTaskUnblockTime - taskTICK_COUNT_64( xTickCount ) ) < ( WakeTime_t ) portMAX_DELAY )
+			{
+				xTicks = ( TickType_t ) ( xNextTaskUnblockTime - taskTICK_COUNT_64( xTickCount ) );
+			}
+			else
+			{
+				xTicks = portMAX_DELAY;
+			}
+		}
+		#else
+		{
+			xTicks = xNextTaskUnblockTime - xTickCount;
+		}
+		#endif /* configUSE_64_BIT_TICK_COUNT */
+
+		/* Tasks that share the priority of the running task are switched on
+		every tick. */
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+		{
+			if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) && ( taskPRIORITY_IS_TIME_SLICED( pxCurrentTCB->uxPriority ) ) )
+			{
+				xTicks = ( TickType_t ) 1U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+		#if ( configUSE_TASK_BUDGETS == 1 )
+		{
+		TickType_t xBudgetTicks;
+
+			/* The tick after the running task could exhaust its budget. */
+			if( ( pxCurrentTCB->ulBudgetCycles != 0UL ) && ( pxCurrentTCB->xBudgetEnforced == pdFALSE ) )
+			{
+				xBudgetTicks = ( TickType_t ) ( pxCurrentTCB->ulBudgetRemaining / taskCYCLES_PER_TICK ) + ( TickType_t ) 1U;
+
+				if( xBudgetTicks < xTicks )
+				{
+					xTicks = xBudgetTicks;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The next budget replenishment.  Those in the overflow list
+			are not reached until after the tick count overflows. */
+			if( listLIST_IS_EMPTY( pxBudgetReplenishList ) == pdFALSE )
+			{
+				xBudgetTicks = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxBudgetReplenishList ) - xTickCount;
+
+				if( ( ( BaseType_t ) xBudgetTicks > ( BaseType_t ) 0 ) && ( xBudgetTicks < xTicks ) )
+				{
+					xTicks = xBudgetTicks;
+				}
+				else if( ( BaseType_t ) xBudgetTicks <= ( BaseType_t ) 0 )
+				{
+					xTicks = ( TickType_t ) 1U;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TASK_BUDGETS */
+
+		#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+		{
+		const TickType_t xSlotTicks = xCyclicExecutiveTicksToNextEvent();
+
+			if( xSlotTicks < xTicks )
+			{
+				xTicks = xSlotTicks;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_CYCLIC_EXECUTIVE */
+
+		if( xTicks == ( TickType_t ) 0U )
+		{
+			xTicks = ( TickType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xTicks;
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*----------------------------------------------------------*/
+
+#if ( configUSE_DYNAMIC_TICK == 1 )
+
+	BaseType_t xTaskAnnounceTicks( const TickType_t xTicks, const uint32_t ulCyclesSinceTick )
+	{
+	TickType_t xTick, xTicksToStep;
+	BaseType_t xSwitchRequired = pdFALSE;
+	#if ( configUSE_TIMING_MONITOR == 1 )
+		const uint32_t ulLastTickCycles = portGET_CYCLE_COUNT() - ulCyclesSinceTick;
+	#endif
+
+		configASSERT( xTicks > ( TickType_t ) 0U );
+
+		#if ( configUSE_TIMING_MONITOR == 0 )
+		{
+			/* Only the timing monitor timestamps ticks. */
+			( void ) ulCyclesSinceTick;
+		}
+		#endif
+
+		/* The port ends each tick period at or before the next event, so all
+		but the last of the ticks normally have nothing to do and the tick
+		count can be stepped over them, as vTaskStepTick() does.  If the next
+		event has since moved to within the step (or the scheduler is
+		suspended), the ticks are processed one at a time instead.  As in
+		prvProcessPendedTicks(), the step stops short of the tick before the
+		tick count wraps, so the wrap is processed by xTaskIncrementTick(),
+		which switches the delayed lists and, with a 64-bit tick count,
+		increments its upper half. */
+		xTicksToStep = xTicks - ( TickType_t ) 1U;
+
+		if( xTicksToStep >= xTaskGetTicksToNextEvent() )
+		{
+			xTicksToStep = ( TickType_t ) 0U;
+		}
+		else if( xTickCount == portMAX_DELAY )
+		{
+			xTicksToStep = ( TickType_t ) 0U;
+		}
+		else if( xTicksToStep > ( ( portMAX_DELAY - ( TickType_t ) 1U ) - xTickCount ) )
+		{
+			xTicksToStep = ( portMAX_DELAY - ( TickType_t ) 1U ) - xTickCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xTicksToStep > ( TickType_t ) 0U )
+		{
+			xTickCount += xTicksToStep;
+			traceINCREASE_TICK_COUNT( xTicksToStep );
+
+			#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+			{
+				vCyclicExecutiveStepTicks( xTicksToStep );
+			}
+			#endif /* configUSE_CYCLIC_EXECUTIVE */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Any ticks that were not stepped over, other than the last. */
+		for( xTick = xTicksToStep + ( TickType_t ) 1U; xTick < xTicks; xTick++ )
+		{
+			#if ( configUSE_TIMING_MONITOR == 1 )
+			{
+				ulTimingTickEdgeCycles = ulLastTickCycles - ( ( uint32_t ) ( xTicks - xTick ) * taskCYCLES_PER_TICK );
+			}
+			#endif
+
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		#if ( configUSE_TIMING_MONITOR == 1 )
+		{
+			ulTimingTickEdgeCycles = ulLastTickCycles;
+		}
+		#endif
+
+		if( xTaskIncrementTick() != pdFALSE )
+		{
+			xSwitchRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xSwitchRequired;
+	}
+
+#endif /* configUSE_DYNAMIC_TICK */
+/*----------------------------------------------------------*/
+
 BaseType_t xTaskIncrementTick( void )
 {
 TCB_t * pxTCB;
-TickType_t xItemValue;
+WakeTime_t xItemValue;
 BaseType_t xSwitchRequired = pdFALSE;
 
 	/* Called by the portable layer each time a tick interrupt occurs.
@@ -1952,6 +3340,23 @@ BaseType_t xSwitchRequired = pdFALSE;
 		delayed lists if it wraps to 0. */
 		++xTickCount;
 
+		#if ( configUSE_TIMING_MONITOR == 1 )
+		{
+			/* Timestamp the tick, unless it is a pended tick being unwound
+			when the scheduler is unlocked, in which case the timestamp was
+			taken when the tick was pended. */
+			if( uxPendedTicks == ( UBaseType_t ) 0U )
+			{
+				ulTimingTickCycles = taskTIMING_TICK_CYCLES();
+				xTimingTickCount = xTickCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TIMING_MONITOR */
+
 		{
 			/* Minor optimisation.  The tick count cannot change in this
 			block. */
@@ -1960,6 +3365,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 			if( xConstTickCount == ( TickType_t ) 0U )
 			{
 				taskSWITCH_DELAYED_LISTS();
+				taskSWITCH_BUDGET_REPLENISH_LISTS();
 			}
 			else
 			{
@@ -1970,7 +3376,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 			the	queue in the order of their wake time - meaning once one task
 			has been found whose block time has not expired there is no need to
 			look any further down the list. */
-			if( xConstTickCount >= xNextTaskUnblockTime )
+			if( taskTICK_COUNT_64( xConstTickCount ) >= xNextTaskUnblockTime )
 			{
 				for( ;; )
 				{
@@ -1981,7 +3387,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 						unlikely that the
 						if( xTickCount >= xNextTaskUnblockTime ) test will pass
 						next time through. */
-						xNextTaskUnblockTime = portMAX_DELAY;
+						xNextTaskUnblockTime = taskNO_WAKE_TIME;
 						break;
 					}
 					else
@@ -1991,9 +3397,9 @@ BaseType_t xSwitchRequired = pdFALSE;
 						at which the task at the head of the delayed list must
 						be removed from the Blocked state. */
 						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
+						xItemValue = taskWAKE_TIME_OF( pxTCB );
 
-						if( xConstTickCount < xItemValue )
+						if( taskTICK_COUNT_64( xConstTickCount ) < xItemValue )
 						{
 							/* It is not time to unblock this item yet, but the
 							item value is the time at which the task at the head
@@ -2034,7 +3440,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 							only be performed if the unblocked task has a
 							priority that is equal to or higher than the
 							currently executing task. */
-							if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+							if( taskPREEMPTS_OR_SHARES_WITH_CURRENT_TASK( pxTCB->uxPriority ) )
 							{
 								xSwitchRequired = pdTRUE;
 							}
@@ -2049,12 +3455,73 @@ BaseType_t xSwitchRequired = pdFALSE;
 			}
 		}
 
+		#if ( configUSE_TASK_BUDGETS == 1 )
+		{
+			/* Charge the running task for the cycles it has used since the
+			last tick or context switch, and demote or suspend it if that
+			exhausted its budget.  A task can therefore overrun its budget by
+			at most one tick. */
+			if( prvBudgetCharge() != pdFALSE )
+			{
+				prvBudgetEnforce( pxCurrentTCB );
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Return the cycles consumed by earlier activations once their
+			replenishment time is reached.  The list is ordered by time, and
+			replenishment times that have overflowed the tick count are held
+			in pxOverflowBudgetReplenishList, so only the head of
+			pxBudgetReplenishList need be checked. */
+			while( listLIST_IS_EMPTY( pxBudgetReplenishList ) == pdFALSE )
+			{
+				pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxBudgetReplenishList );
+
+				if( xTickCount < listGET_LIST_ITEM_VALUE( &( pxTCB->xBudgetListItem ) ) )
+				{
+					break;
+				}
+
+				( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+
+				if( pxTCB->ulBudgetPendingReplenishment < ( pxTCB->ulBudgetCycles - pxTCB->ulBudgetRemaining ) )
+				{
+					pxTCB->ulBudgetRemaining += pxTCB->ulBudgetPendingReplenishment;
+				}
+				else
+				{
+					pxTCB->ulBudgetRemaining = pxTCB->ulBudgetCycles;
+				}
+				pxTCB->ulBudgetPendingReplenishment = 0UL;
+
+				if( pxTCB->xBudgetEnforced != pdFALSE )
+				{
+					if( prvBudgetRelease( pxTCB ) != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		#endif /* configUSE_TASK_BUDGETS */
+
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
 		writer has not explicitly turned time slicing off. */
 		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+			if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) && ( taskPRIORITY_IS_TIME_SLICED( pxCurrentTCB->uxPriority ) ) )
 			{
 				xSwitchRequired = pdTRUE;
 			}
@@ -2065,6 +3532,22 @@ BaseType_t xSwitchRequired = pdFALSE;
 		}
 		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
+		#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+		{
+			/* Start the next slot of the cyclic executive if its offset within
+			the major frame has been reached, and check the budget of the slot
+			that is running. */
+			if( xCyclicExecutiveTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_CYCLIC_EXECUTIVE */
+
 		#if ( configUSE_TICK_HOOK == 1 )
 		{
 			/* Guard against the tick hook being called when the pended tick
@@ -2084,6 +3567,13 @@ BaseType_t xSwitchRequired = pdFALSE;
 	{
 		++uxPendedTicks;
 
+		#if ( configUSE_TIMING_MONITOR == 1 )
+		{
+			ulTimingTickCycles = taskTIMING_TICK_CYCLES();
+			xTimingTickCount = xTickCount + ( TickType_t ) uxPendedTicks;
+		}
+		#endif /* configUSE_TIMING_MONITOR */
+
 		/* The tick hook gets called at regular intervals, even if the
 		scheduler is locked. */
 		#if ( configUSE_TICK_HOOK == 1 )
@@ -2211,51 +3701,204 @@ void vTaskSwitchContext( void )
 	else
 	{
 		xYieldPending = pdFALSE;
-		traceTASK_SWITCHED_OUT();
+		prvSwitchOutCurrentTask();
 
-		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		/* Select a new task to run using either the generic C or port
+		optimised asm code.  If a directed handoff has been requested then the
+		target of the handoff is used in preference, provided it is eligible to
+		run. */
+		#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
 		{
-				#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-					portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-				#else
-					ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-				#endif
+			prvSelectTaskWithThresholds();
+		}
+		#else
+		{
+			taskSELECT_NEXT_TASK();
+		}
+		#endif /* configUSE_PREEMPTION_THRESHOLD */
 
-				/* Add the amount of time the task has been running to the
-				accumulated	time so far.  The time the task started running was
-				stored in ulTaskSwitchedInTime.  Note that there is no overflow
-				protection here	so count values are only valid until the timer
-				overflows.  The guard against negative values is to protect
-				against suspect run time stat counter implementations - which
-				are provided by the application, not the kernel. */
-				if( ulTotalRunTime > ulTaskSwitchedInTime )
+		#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+		{
+		TCB_t * const pxSlotTCB = ( TCB_t * ) xCyclicExecutiveGetDispatchTask();
+
+			/* While a slot of the cyclic executive is within its budget the
+			task of the slot runs whenever it is ready, whatever the priority
+			of the other ready tasks. */
+			if( pxSlotTCB != NULL )
+			{
+				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxSlotTCB->uxPriority ] ), &( pxSlotTCB->xGenericListItem ) ) != pdFALSE )
 				{
-					pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+					pxCurrentTCB = pxSlotTCB;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
-				ulTaskSwitchedInTime = ulTotalRunTime;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		#endif /* configGENERATE_RUN_TIME_STATS */
+		#endif /* configUSE_CYCLIC_EXECUTIVE */
 
-		/* Check for stack overflow, if configured. */
-		taskCHECK_FOR_STACK_OVERFLOW();
+		#if ( configUSE_BASIC_TASKS == 1 )
+		{
+			prvSwitchInBasicTask();
+		}
+		#endif /* configUSE_BASIC_TASKS */
+		prvSwitchInCurrentTask();
+	}
+}
+/*-----------------------------------------------------------*/
 
-		/* Select a new task to run using either the generic C or port
-		optimised asm code. */
-		taskSELECT_HIGHEST_PRIORITY_TASK();
-		traceTASK_SWITCHED_IN();
+static void prvSwitchOutCurrentTask( void )
+{
+#if ( configUSE_TIMING_MONITOR == 1 )
+	uint32_t ulTimingNow;
+#endif
 
-		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+	traceTASK_SWITCHED_OUT();
+
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	{
+			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+				portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
+			#else
+				ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+			#endif
+
+			/* Add the amount of time the task has been running to the
+			accumulated	time so far.  The time the task started running was
+			stored in ulTaskSwitchedInTime.  Note that there is no overflow
+			protection here	so count values are only valid until the timer
+			overflows.  The guard against negative values is to protect
+			against suspect run time stat counter implementations - which
+			are provided by the application, not the kernel. */
+			if( ulTotalRunTime > ulTaskSwitchedInTime )
+			{
+				pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			ulTaskSwitchedInTime = ulTotalRunTime;
+	}
+	#endif /* configGENERATE_RUN_TIME_STATS */
+
+	/* Check for stack overflow, if configured. */
+	taskCHECK_FOR_STACK_OVERFLOW();
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	{
+		/* A deadline scheduled task that blocked while running is still in
+		the deadline heap, so is taken out of it as it is switched out. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_TASK_PRIORITY ] ), &( pxCurrentTCB->xGenericListItem ) ) == pdFALSE )
 		{
-			/* Switch Newlib's _impure_ptr variable to point to the _reent
-			structure specific to this task. */
-			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+			prvDeadlineHeapRemove( pxCurrentTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_EDF_SCHEDULING */
+
+	#if ( configUSE_TIMING_MONITOR == 1 )
+	{
+		/* Add the time the task being switched out has run to the
+		execution time of its current period. */
+		ulTimingNow = portGET_CYCLE_COUNT();
+		pxCurrentTCB->ulTimingExecutionCycles += ulTimingNow - ulTimingSwitchedInCycles;
+		ulTimingSwitchedInCycles = ulTimingNow;
+	}
+	#endif /* configUSE_TIMING_MONITOR */
+
+	#if ( configUSE_TASK_BUDGETS == 1 )
+	{
+		/* Charge the task being switched out.  If that exhausts its
+		budget the budget is enforced by the next tick that occurs while
+		the task is running. */
+		( void ) prvBudgetCharge();
+
+		/* An activation ends when the task stops being ready to run.  The
+		budget of a task that is being deleted is not replenished. */
+		if( ( pxCurrentTCB->xBudgetActive != pdFALSE ) &&
+			( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xGenericListItem ) ) == pdFALSE ) )
+		{
+			#if ( INCLUDE_vTaskDelete == 1 )
+			{
+				if( listIS_CONTAINED_WITHIN( &xTasksWaitingTermination, &( pxCurrentTCB->xGenericListItem ) ) == pdFALSE )
+				{
+					prvBudgetEndActivation( pxCurrentTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#else
+			{
+				prvBudgetEndActivation( pxCurrentTCB );
+			}
+			#endif /* INCLUDE_vTaskDelete */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_TASK_BUDGETS */
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchInCurrentTask( void )
+{
+	traceTASK_SWITCHED_IN();
+
+	#if ( configUSE_TASK_BUDGETS == 1 )
+	{
+		/* A task with a budget starts a new activation when it starts
+		running after having not been ready. */
+		if( ( pxCurrentTCB->ulBudgetCycles != 0UL ) && ( pxCurrentTCB->xBudgetActive == pdFALSE ) )
+		{
+			pxCurrentTCB->xBudgetActive = pdTRUE;
+			pxCurrentTCB->xBudgetActivationTime = xTickCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_TASK_BUDGETS */
+
+	#if ( configUSE_TIMING_MONITOR == 1 )
+	{
+		/* A periodic task starting a new period records its release
+		jitter.  Interrupts are masked, so the tick timestamp is stable. */
+		if( pxCurrentTCB->xTimingAwaitingStart != pdFALSE )
+		{
+			prvTimingRecordStart( pxCurrentTCB, prvTimingCyclesAtTick( pxCurrentTCB->xTimingRelease ), ulTimingSwitchedInCycles );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#endif /* configUSE_NEWLIB_REENTRANT */
 	}
+	#endif /* configUSE_TIMING_MONITOR */
+
+	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+	{
+		/* Switch Newlib's _impure_ptr variable to point to the _reent
+		structure specific to this task. */
+		_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+	}
+	#endif /* configUSE_NEWLIB_REENTRANT */
+
+	/* The task switched in may need ticks the task switched out did not,
+	and vice versa. */
+	taskDYNAMIC_TICK_UPDATE();
 }
 /*-----------------------------------------------------------*/
 
@@ -2264,6 +3907,7 @@ void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksT
 TickType_t xTimeToWake;
 
 	configASSERT( pxEventList );
+	taskASSERT_CURRENT_TASK_CAN_BLOCK();
 
 	/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
 	SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
@@ -2323,6 +3967,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
 TickType_t xTimeToWake;
 
 	configASSERT( pxEventList );
+	taskASSERT_CURRENT_TASK_CAN_BLOCK();
 
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
 	the event groups implementation. */
@@ -2391,6 +4036,7 @@ TickType_t xTimeToWake;
 	TickType_t xTimeToWake;
 
 		configASSERT( pxEventList );
+		taskASSERT_CURRENT_TASK_CAN_BLOCK();
 
 		/* This function should not be called by application code hence the
 		'Restricted' in its name.  It is not part of the public API.  It is
@@ -2480,6 +4126,22 @@ BaseType_t xReturn;
 
 	This function assumes that a check has already been made to ensure that
 	pxEventList is not empty. */
+	#if ( ( configUSE_CO_ROUTINES != 0 ) && ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 ) )
+	{
+		/* Co-routines can wait on the same event list as tasks but are always
+		ordered after them, so if the first waiter is a co-routine no task is
+		waiting. */
+		if( ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxEventList ) & corEVENT_LIST_ITEM_FLAG ) != ( TickType_t ) 0U )
+		{
+			( void ) xCoRoutineRemoveFromEventList( pxEventList );
+
+			/* xCoRoutineRemoveFromEventList() has already pended any switch
+			to the task that runs the co-routines. */
+			return pdFALSE;
+		}
+	}
+	#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+
 	pxUnblockedTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
 	configASSERT( pxUnblockedTCB );
 	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
@@ -2496,7 +4158,7 @@ BaseType_t xReturn;
 		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
 	}
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( taskTCB_PREEMPTS_CURRENT_TASK( pxUnblockedTCB ) )
 	{
 		/* Return true if the task removed from the event list has a higher
 		priority than the calling task.  This allows the calling task to know if
@@ -2554,7 +4216,7 @@ BaseType_t xReturn;
 	( void ) uxListRemove( &( pxUnblockedTCB->xGenericListItem ) );
 	prvAddTaskToReadyList( pxUnblockedTCB );
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( taskTCB_PREEMPTS_CURRENT_TASK( pxUnblockedTCB ) )
 	{
 		/* Return true if the task removed from the event list has
 		a higher priority than the calling task.  This allows
@@ -2578,6 +4240,7 @@ BaseType_t xReturn;
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
 	configASSERT( pxTimeOut );
+	taskDYNAMIC_TICK_SYNC();
 	pxTimeOut->xOverflowCount = xNumOfOverflows;
 	pxTimeOut->xTimeOnEntering = xTickCount;
 }
@@ -2590,6 +4253,8 @@ BaseType_t xReturn;
 	configASSERT( pxTimeOut );
 	configASSERT( pxTicksToWait );
 
+	taskDYNAMIC_TICK_SYNC();
+
 	taskENTER_CRITICAL();
 	{
 		/* Minor optimisation.  The tick count cannot change in this block. */
@@ -2875,6 +4540,52 @@ UBaseType_t x;
 	}
 	#endif /* configUSE_MUTEXES */
 
+	#if ( configUSE_CEILING_MUTEXES == 1 )
+	{
+		vListInitialise( &( pxTCB->xCeilingMutexList ) );
+		pxTCB->uxCeilingSavedBasePriority = uxPriority;
+	}
+	#endif /* configUSE_CEILING_MUTEXES */
+
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+	{
+		/* A threshold equal to the priority of the task has no effect. */
+		pxTCB->uxPreemptionThreshold = uxPriority;
+		pxTCB->pxPreemptedThresholdTCB = NULL;
+	}
+	#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	{
+		pxTCB->xRelativeDeadline = ( TickType_t ) 0U;
+		pxTCB->xAbsoluteDeadline = ( TickType_t ) 0U;
+		pxTCB->xHasDeadline = pdFALSE;
+		pxTCB->uxDeadlineHeapIndex = ( UBaseType_t ) 0U;
+	}
+	#endif /* configUSE_EDF_SCHEDULING */
+
+	#if ( configUSE_TASK_BUDGETS == 1 )
+	{
+		/* Tasks are created without a budget.  The remaining fields are set
+		by vTaskBudgetSet(). */
+		pxTCB->ulBudgetCycles = 0UL;
+		pxTCB->ulBudgetExhaustions = 0UL;
+		pxTCB->xBudgetActive = pdFALSE;
+		pxTCB->xBudgetEnforced = pdFALSE;
+		vListInitialiseItem( &( pxTCB->xBudgetListItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxTCB->xBudgetListItem ), pxTCB );
+	}
+	#endif /* configUSE_TASK_BUDGETS */
+
+	#if ( configUSE_TIMING_MONITOR == 1 )
+	{
+		( void ) memset( ( void * ) &( pxTCB->xTimingStatus ), 0x00, sizeof( pxTCB->xTimingStatus ) );
+		pxTCB->xTimingRelease = ( TickType_t ) 0U;
+		pxTCB->xTimingAwaitingStart = pdFALSE;
+		pxTCB->ulTimingExecutionCycles = 0UL;
+	}
+	#endif /* configUSE_TIMING_MONITOR */
+
 	vListInitialiseItem( &( pxTCB->xGenericListItem ) );
 	vListInitialiseItem( &( pxTCB->xEventListItem ) );
 
@@ -2931,6 +4642,36 @@ UBaseType_t x;
 	}
 	#endif
 
+	#if ( ( configUSE_IPC == 1 ) && ( configUSE_MUTEXES == 1 ) )
+	{
+		vListInitialise( &( pxTCB->xDonationList ) );
+	}
+	#endif
+
+	#if ( ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) )
+	{
+		pxTCB->pvEventData = NULL;
+	}
+	#endif
+
+	#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+	{
+		pxTCB->ppvBlockingMutexHolder = NULL;
+		vListInitialise( &( pxTCB->xContendedMutexList ) );
+	}
+	#endif
+
+	#if ( configUSE_BASIC_TASKS == 1 )
+	{
+		pxTCB->pxBasicTaskCode = NULL;
+		pxTCB->pvBasicTaskParameters = NULL;
+		pxTCB->pxPreemptedBasicTask = NULL;
+		pxTCB->xBasicTaskStarted = pdFALSE;
+		pxTCB->xBasicTaskNested = pdFALSE;
+		pxTCB->uxBasicTaskActivations = ( UBaseType_t ) 0U;
+	}
+	#endif
+
 	#if ( configUSE_NEWLIB_REENTRANT == 1 )
 	{
 		/* Initialise this task's Newlib reent structure. */
@@ -3005,7 +4746,11 @@ UBaseType_t uxPriority;
 	}
 
 	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if ( configUSE_64_BIT_TICK_COUNT == 0 )
+	{
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#endif /* configUSE_64_BIT_TICK_COUNT */
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3020,10 +4765,35 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
+	#if ( configUSE_TASK_BUDGETS == 1 )
+	{
+		vListInitialise( &xBudgetReplenishList1 );
+		vListInitialise( &xBudgetReplenishList2 );
+		pxBudgetReplenishList = &xBudgetReplenishList1;
+		pxOverflowBudgetReplenishList = &xBudgetReplenishList2;
+	}
+	#endif /* configUSE_TASK_BUDGETS */
+
+	#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+	{
+		vListInitialise( &xMicrosecondDelayedList );
+	}
+	#endif /* configUSE_MICROSECOND_TIMEBASE */
+
+	#if ( configUSE_BASIC_TASKS == 1 )
+	{
+		vListInitialise( &xDormantBasicTaskList );
+	}
+	#endif /* configUSE_BASIC_TASKS */
+
 	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
 	using list2. */
 	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if ( configUSE_64_BIT_TICK_COUNT == 0 )
+	{
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif /* configUSE_64_BIT_TICK_COUNT */
 }
 /*-----------------------------------------------------------*/
 
@@ -3070,6 +4840,37 @@ static void prvCheckTasksWaitingTermination( void )
 
 static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
 {
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+ListItem_t *pxIterator;
+WakeTime_t xWakeTime;
+
+	/* The wake time is less than a full tick count range ahead of the tick
+	count, so its upper half follows from how far ahead it is.  The list
+	item value cannot hold a 64-bit time, so the position in the list is found
+	by comparing the wake times held in the TCBs. */
+	xWakeTime = taskTICK_COUNT_64( xTickCount ) + ( WakeTime_t ) ( TickType_t ) ( xTimeToWake - xTickCount );
+	pxCurrentTCB->ullWakeTime = xWakeTime;
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xGenericListItem ), xTimeToWake );
+
+	for( pxIterator = listGET_HEAD_ENTRY( pxDelayedTaskList ); pxIterator != ( ListItem_t * ) listGET_END_MARKER( pxDelayedTaskList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	{
+		if( taskWAKE_TIME_OF( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) ) > xWakeTime )
+		{
+			break;
+		}
+	}
+
+	vListInsertBefore( pxDelayedTaskList, &( pxCurrentTCB->xGenericListItem ), pxIterator );
+
+	if( xWakeTime < xNextTaskUnblockTime )
+	{
+		xNextTaskUnblockTime = xWakeTime;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+#else
 	/* The list item will be inserted in wake time order. */
 	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xGenericListItem ), xTimeToWake );
 
@@ -3095,6 +4896,7 @@ static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
+#endif /* configUSE_64_BIT_TICK_COUNT */
 }
 /*-----------------------------------------------------------*/
 
@@ -3354,7 +5156,7 @@ TCB_t *pxTCB;
 		the maximum possible value so it is	extremely unlikely that the
 		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
 		there is an item in the delayed list. */
-		xNextTaskUnblockTime = portMAX_DELAY;
+		xNextTaskUnblockTime = taskNO_WAKE_TIME;
 	}
 	else
 	{
@@ -3363,11 +5165,100 @@ TCB_t *pxTCB;
 		which the task at the head of the delayed list should be removed
 		from the Blocked state. */
 		( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xGenericListItem ) );
+		xNextTaskUnblockTime = taskWAKE_TIME_OF( pxTCB );
 	}
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_BATCHED_PENDED_TICKS == 1 )
+
+	static BaseType_t prvProcessPendedTicks( void )
+	{
+	TickType_t xTicksToStep;
+	BaseType_t xSwitchRequired = pdFALSE;
+
+		/* Called from xTaskResumeAll() with interrupts masked and the
+		scheduler no longer suspended, so uxPendedTicks cannot change other
+		than here. */
+		while( uxPendedTicks > ( UBaseType_t ) 0U )
+		{
+			/* Step over all but the last pended tick.  The step stops short of
+			the tick before the tick count wraps, so the delayed list is
+			emptied of tasks due before the wrap, and the lists switched, by
+			xTaskIncrementTick() just as they would be if the ticks were
+			processed one at a time. */
+			xTicksToStep = ( TickType_t ) uxPendedTicks - ( TickType_t ) 1U;
+
+			if( xTickCount == portMAX_DELAY )
+			{
+				xTicksToStep = ( TickType_t ) 0U;
+			}
+			else if( xTicksToStep > ( ( portMAX_DELAY - ( TickType_t ) 1U ) - xTickCount ) )
+			{
+				xTicksToStep = ( portMAX_DELAY - ( TickType_t ) 1U ) - xTickCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xTicksToStep > ( TickType_t ) 0U )
+			{
+				#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+				{
+				TickType_t xTick;
+
+					/* The cyclic executive keeps its own position within the
+					major frame, which is advanced a tick at a time so any slot
+					that should have started during the step is still
+					released (late) and counted as it would have been. */
+					for( xTick = ( TickType_t ) 0U; xTick < xTicksToStep; xTick++ )
+					{
+						if( xCyclicExecutiveTick() != pdFALSE )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#endif /* configUSE_CYCLIC_EXECUTIVE */
+
+				xTickCount += xTicksToStep;
+				uxPendedTicks -= ( UBaseType_t ) xTicksToStep;
+				traceINCREASE_TICK_COUNT( xTicksToStep );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The last tick of the step is processed in full.  As the delayed
+			list is ordered by wake time, the single pass made of it unblocks
+			every task whose wake time has passed, as does the check of the
+			budget replenishment list.  uxPendedTicks is not decremented until
+			afterwards, so neither the tick hook nor the timing monitor
+			timestamp is repeated for a tick that was already seen when it
+			was pended. */
+			if( xTaskIncrementTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			--uxPendedTicks;
+		}
+
+		return xSwitchRequired;
+	}
+
+#endif /* configUSE_BATCHED_PENDED_TICKS */
+/*-----------------------------------------------------------*/
+
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
 
 	TaskHandle_t xTaskGetCurrentTaskHandle( void )
@@ -3464,6 +5355,14 @@ TCB_t *pxTCB;
 				}
 
 				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+
+				#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+				{
+					/* If the holder is itself blocked on a mutex then the
+					holder of that mutex must inherit the priority too. */
+					prvInheritAlongChain( pxTCB, pxCurrentTCB->uxPriority );
+				}
+				#endif
 			}
 			else
 			{
@@ -3499,7 +5398,7 @@ TCB_t *pxTCB;
 
 			/* Has the holder of the mutex inherited the priority of another
 			task? */
-			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+			if( pxTCB->uxPriority != taskGET_UNINHERITED_PRIORITY( pxTCB ) )
 			{
 				/* Only disinherit if no other mutexes are held. */
 				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
@@ -3520,8 +5419,8 @@ TCB_t *pxTCB;
 
 					/* Disinherit the priority before adding the task into the
 					new	ready list. */
-					traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-					pxTCB->uxPriority = pxTCB->uxBasePriority;
+					traceTASK_PRIORITY_DISINHERIT( pxTCB, taskGET_UNINHERITED_PRIORITY( pxTCB ) );
+					pxTCB->uxPriority = taskGET_UNINHERITED_PRIORITY( pxTCB );
 
 					/* Reset the event list item value.  It cannot be in use for
 					any other purpose if this task is running, and it must be
@@ -3896,38 +5795,2373 @@ TickType_t uxReturn;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( ( configUSE_LIGHT_MUTEXES == 1 ) && ( configUSE_MUTEXES == 1 ) )
 
-	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	BaseType_t xTaskDecrementMutexHeldCount( void )
 	{
-	TickType_t xTimeToWake;
-	uint32_t ulReturn;
+	BaseType_t xReturn;
 
+		/* A critical section is needed even when the task has its base
+		priority.  A task that preempts this one can inherit onto it through a
+		different mutex and then time out, and the code run on the time out
+		reads the mutex held count to decide whether the inherited priority can
+		be returned.  The count and the priority must therefore change
+		together. */
 		taskENTER_CRITICAL();
 		{
-			/* Only block if the notification count is not already non-zero. */
-			if( pxCurrentTCB->ulNotifiedValue == 0UL )
+			xReturn = xTaskPriorityDisinherit( ( TaskHandle_t ) pxCurrentTCB );
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* ( configUSE_LIGHT_MUTEXES == 1 ) && ( configUSE_MUTEXES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	void vTaskSetBlockingMutex( void * volatile * const ppvMutexHolder )
+	{
+		/* Only the running task sets its own blocking mutex, and it is only
+		followed by other tasks while the task is referenced from the mutex's
+		event list, so no critical section is needed here. */
+		pxCurrentTCB->ppvBlockingMutexHolder = ppvMutexHolder;
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	void vTaskAddContendedMutex( TaskHandle_t const pxMutexHolder, ListItem_t * const pxMutexListItem )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  If the mutex
+		was given back by an interrupt while the queue was locked then the
+		mutex holder might now be NULL. */
+		if( pxTCB != NULL )
+		{
+			if( listIS_CONTAINED_WITHIN( &( pxTCB->xContendedMutexList ), pxMutexListItem ) == pdFALSE )
 			{
-				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->eNotifyState = eWaitingNotification;
+				configASSERT( listLIST_ITEM_CONTAINER( pxMutexListItem ) == NULL );
+				vListInsertEnd( &( pxTCB->xContendedMutexList ), pxMutexListItem );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
 
-				if( xTicksToWait > ( TickType_t ) 0 )
-				{
-					/* The task is going to block.  First it must be removed
-					from the ready list. */
-					if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						/* The current task must be in a ready list, so there is
-						no need to check, and the port reset macro can be called
-						directly. */
-						portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
 
-					#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	void vTaskRemoveContendedMutex( ListItem_t * const pxMutexListItem )
+	{
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		if( listLIST_ITEM_CONTAINER( pxMutexListItem ) != NULL )
+		{
+			( void ) uxListRemove( pxMutexListItem );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder )
+	{
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The calling
+		task has already been removed from the list of tasks waiting for the
+		mutex by the tick interrupt. */
+		prvDisinheritAlongChain( ( TCB_t * ) pxMutexHolder, pxCurrentTCB->uxPriority );
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	static List_t *prvGetBlockingMutexWaitList( const TCB_t * const pxTCB )
+	{
+	List_t *pxReturn = NULL;
+
+		/* A task that has been unblocked, but has not yet run to clear its
+		blocking mutex, is no longer referenced from the mutex's event list so
+		is not treated as blocked.  If it was unblocked while the scheduler was
+		suspended its event list item is held in the pending ready list
+		instead, which is not a list of tasks waiting for a mutex. */
+		if( pxTCB->ppvBlockingMutexHolder != NULL )
+		{
+			pxReturn = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+
+			if( pxReturn == &xPendingReadyList )
+			{
+				pxReturn = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxReturn;
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority )
+	{
+	List_t * const pxWaitList = prvGetBlockingMutexWaitList( pxTCB );
+
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+		{
+			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->uxPriority = uxNewPriority;
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			pxTCB->uxPriority = uxNewPriority;
+		}
+
+		/* Event lists are held in priority order, so a task blocked on a mutex
+		is moved to its new position to keep the task at the head of the list
+		the highest priority waiter. */
+		if( pxWaitList != NULL )
+		{
+			( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			vListInsert( pxWaitList, &( pxTCB->xEventListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	static void prvInheritAlongChain( TCB_t *pxTCB, const UBaseType_t uxPriority )
+	{
+	UBaseType_t uxDepth;
+	List_t *pxWaitList;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  pxTCB has just
+		inherited uxPriority in vTaskPriorityInherit(), which does not update
+		the task's position in any event list it is blocked on. */
+		pxWaitList = prvGetBlockingMutexWaitList( pxTCB );
+
+		if( pxWaitList != NULL )
+		{
+			( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+			vListInsert( pxWaitList, &( pxTCB->xEventListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The depth limit bounds the time spent in the critical section, and
+		also ends the walk if the chain is a deadlock cycle. */
+		for( uxDepth = ( UBaseType_t ) 1U; ( pxWaitList != NULL ) && ( uxDepth < ( UBaseType_t ) configMAX_PRIORITY_INHERITANCE_DEPTH ); uxDepth++ )
+		{
+			pxTCB = taskGET_BLOCKING_MUTEX_HOLDER( pxTCB );
+
+			if( ( pxTCB == NULL ) || ( pxTCB->uxPriority >= uxPriority ) )
+			{
+				break;
+			}
+			else
+			{
+				traceTASK_PRIORITY_INHERIT( pxTCB, uxPriority );
+				prvSetInheritedPriority( pxTCB, uxPriority );
+				pxWaitList = prvGetBlockingMutexWaitList( pxTCB );
+			}
+		}
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	static UBaseType_t prvGetHighestContendedPriority( const TCB_t * const pxTCB )
+	{
+	UBaseType_t uxPriority, uxWaitingPriority;
+	const ListItem_t *pxIterator;
+	List_t *pxWaitList;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  Event lists
+		are held in priority order, so the task at the head of each mutex's
+		list of waiting tasks is the highest priority task waiting for it. */
+		uxPriority = taskGET_UNINHERITED_PRIORITY( pxTCB );
+
+		for( pxIterator = listGET_HEAD_ENTRY( &( pxTCB->xContendedMutexList ) ); pxIterator != listGET_END_MARKER( &( pxTCB->xContendedMutexList ) ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		{
+			pxWaitList = ( List_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+
+			if( listLIST_IS_EMPTY( pxWaitList ) == pdFALSE )
+			{
+				uxWaitingPriority = ( ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxWaitList ) )->uxPriority;
+
+				if( uxWaitingPriority > uxPriority )
+				{
+					uxPriority = uxWaitingPriority;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return uxPriority;
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	static void prvDisinheritAlongChain( TCB_t *pxTCB, const UBaseType_t uxLeavingPriority )
+	{
+	UBaseType_t uxDepth, uxNewPriority;
+	List_t *pxWaitList;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		for( uxDepth = ( UBaseType_t ) 0U; uxDepth < ( UBaseType_t ) configMAX_PRIORITY_INHERITANCE_DEPTH; uxDepth++ )
+		{
+			/* Stop if there is no holder, or if the holder's priority is above
+			any it could have inherited from the task that stopped waiting. */
+			if( ( pxTCB == NULL ) ||
+				( pxTCB->uxPriority > uxLeavingPriority ) ||
+				( pxTCB->uxPriority == pxTCB->uxBasePriority ) )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The holder keeps the priority of the highest priority task
+			still waiting for any of the mutexes it holds. */
+			uxNewPriority = prvGetHighestContendedPriority( pxTCB );
+
+			if( uxNewPriority >= pxTCB->uxPriority )
+			{
+				break;
+			}
+			else
+			{
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxNewPriority );
+				prvSetInheritedPriority( pxTCB, uxNewPriority );
+			}
+
+			/* If the holder is itself blocked on a mutex then the holder of
+			that mutex may have inherited the priority through it. */
+			pxWaitList = prvGetBlockingMutexWaitList( pxTCB );
+
+			if( pxWaitList == NULL )
+			{
+				break;
+			}
+			else
+			{
+				pxTCB = taskGET_BLOCKING_MUTEX_HOLDER( pxTCB );
+			}
+		}
+	}
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+	void vTaskPriorityRaiseToCeiling( ListItem_t * const pxCeilingListItem, UBaseType_t uxCeilingPriority )
+	{
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The base
+		priority the task had before it took its first ceiling mutex is saved,
+		so the mutexes can be given back in any order. */
+		if( listLIST_IS_EMPTY( &( pxCurrentTCB->xCeilingMutexList ) ) != pdFALSE )
+		{
+			pxCurrentTCB->uxCeilingSavedBasePriority = pxCurrentTCB->uxBasePriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* A task that uses a ceiling mutex must not have a priority above
+		the ceiling, otherwise the mutex could be held by a task it
+		preempted.  A mutex whose ceiling is below that of a mutex the task
+		already holds is allowed, and leaves the priority unchanged. */
+		configASSERT( pxCurrentTCB->uxCeilingSavedBasePriority <= uxCeilingPriority );
+
+		listSET_LIST_ITEM_VALUE( pxCeilingListItem, ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxCeilingPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		vListInsert( &( pxCurrentTCB->xCeilingMutexList ), pxCeilingListItem );
+
+		if( uxCeilingPriority > pxCurrentTCB->uxBasePriority )
+		{
+			pxCurrentTCB->uxBasePriority = uxCeilingPriority;
+
+			/* The task may already be running at or above the ceiling if
+			it has inherited a priority. */
+			if( uxCeilingPriority > pxCurrentTCB->uxPriority )
+			{
+				/* The running task is in the ready list, and raising its
+				priority never requires a context switch. */
+				if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxCurrentTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceTASK_PRIORITY_SET( pxCurrentTCB, uxCeilingPriority );
+				pxCurrentTCB->uxPriority = uxCeilingPriority;
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxCeilingPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				prvAddTaskToReadyList( pxCurrentTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+	BaseType_t xTaskPriorityRestoreFromCeiling( ListItem_t * const pxCeilingListItem )
+	{
+	BaseType_t xReturn = pdFALSE;
+	UBaseType_t uxOldPriority, uxNewBasePriority, uxHighestCeiling;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		configASSERT( listIS_CONTAINED_WITHIN( &( pxCurrentTCB->xCeilingMutexList ), pxCeilingListItem ) != pdFALSE );
+		( void ) uxListRemove( pxCeilingListItem );
+
+		/* The base priority drops to the highest ceiling of the mutexes the
+		task still holds, which are not necessarily those it took most
+		recently, or to the priority it had before it took any. */
+		uxNewBasePriority = pxCurrentTCB->uxCeilingSavedBasePriority;
+
+		if( listLIST_IS_EMPTY( &( pxCurrentTCB->xCeilingMutexList ) ) == pdFALSE )
+		{
+			uxHighestCeiling = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxCurrentTCB->xCeilingMutexList ) );
+
+			if( uxHighestCeiling > uxNewBasePriority )
+			{
+				uxNewBasePriority = uxHighestCeiling;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pxCurrentTCB->uxBasePriority != uxNewBasePriority )
+		{
+			/* If the task is running at a priority inherited from above the
+			ceiling then the inherited priority is kept, and is returned as
+			normal when the mutex it relates to is given back. */
+			uxOldPriority = taskGET_UNINHERITED_PRIORITY( pxCurrentTCB );
+			pxCurrentTCB->uxBasePriority = uxNewBasePriority;
+
+			if( ( pxCurrentTCB->uxPriority == uxOldPriority ) && ( taskGET_UNINHERITED_PRIORITY( pxCurrentTCB ) != uxOldPriority ) )
+			{
+				if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxCurrentTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceTASK_PRIORITY_SET( pxCurrentTCB, taskGET_UNINHERITED_PRIORITY( pxCurrentTCB ) );
+				pxCurrentTCB->uxPriority = taskGET_UNINHERITED_PRIORITY( pxCurrentTCB );
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				prvAddTaskToReadyList( pxCurrentTCB );
+
+				/* A task that became ready while the ceiling was held may
+				now have a higher priority than this task. */
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	BaseType_t xTaskCreateBasic( TaskFunction_t pxTaskCode, const char * const pcName, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	TCB_t *pxNewTCB = NULL;
+	BaseType_t xReturn;
+
+		configASSERT( pxTaskCode );
+		configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		/* The shared stack is allocated when the first basic task is
+		created. */
+		vTaskSuspendAll();
+		{
+			if( pxBasicTaskStack == NULL )
+			{
+				pxBasicTaskStack = ( StackType_t * ) pvPortMallocAligned( ( ( ( size_t ) configBASIC_TASK_STACK_SIZE ) * sizeof( StackType_t ) ), NULL ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+				#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+				{
+					if( pxBasicTaskStack != NULL )
+					{
+						( void ) memset( pxBasicTaskStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) configBASIC_TASK_STACK_SIZE * sizeof( StackType_t ) );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		if( pxBasicTaskStack != NULL )
+		{
+			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pxNewTCB != NULL )
+		{
+			/* pxStack is the base of the shared stack, so the stack overflow
+			checks and the high water mark apply to the shared stack. */
+			pxNewTCB->pxStack = pxBasicTaskStack;
+			prvInitialiseTCBVariables( pxNewTCB, pcName, uxPriority, NULL, ( uint16_t ) configBASIC_TASK_STACK_SIZE );
+			pxNewTCB->pxBasicTaskCode = pxTaskCode;
+			pxNewTCB->pvBasicTaskParameters = pvParameters;
+
+			/* The initial context is created each time the task starts. */
+			pxNewTCB->pxTopOfStack = NULL;
+
+			if( ( void * ) pxCreatedTask != NULL )
+			{
+				*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			taskENTER_CRITICAL();
+			{
+				uxCurrentNumberOfTasks++;
+
+				if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+				{
+					/* This is the first task to be created. */
+					prvInitialiseTaskLists();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				uxTaskNumber++;
+
+				#if ( configUSE_TRACE_FACILITY == 1 )
+				{
+					pxNewTCB->uxTCBNumber = uxTaskNumber;
+				}
+				#endif /* configUSE_TRACE_FACILITY */
+				traceTASK_CREATE( pxNewTCB );
+
+				/* Basic tasks are dormant until they are activated. */
+				vListInsertEnd( &xDormantBasicTaskList, &( pxNewTCB->xGenericListItem ) );
+				portSETUP_TCB( pxNewTCB );
+			}
+			taskEXIT_CRITICAL();
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			traceTASK_CREATE_FAILED();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	void vTaskActivate( TaskHandle_t xTask )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xTask;
+	BaseType_t xYieldRequired = pdFALSE;
+	BaseType_t xRunNested = pdFALSE;
+
+		configASSERT( pxTCB );
+		configASSERT( pxTCB->pxBasicTaskCode != NULL );
+
+		taskENTER_CRITICAL();
+		{
+			if( ( listIS_CONTAINED_WITHIN( &xDormantBasicTaskList, &( pxTCB->xGenericListItem ) ) != pdFALSE ) &&
+				( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE ) )
+			{
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+
+				if( xSchedulerRunning != pdFALSE )
+				{
+					if( taskPREEMPTS_CURRENT_TASK( pxTCB->uxPriority ) )
+					{
+						#if ( configUSE_PREEMPTION == 1 )
+						{
+							/* If the calling task is the basic task at the top
+							of the shared stack, and the activated task is
+							certainly the next task to run, the activated task
+							is started by a function call on the current stack
+							instead of by a context switch. */
+							if( ( pxCurrentTCB == pxTopBasicTask ) &&
+								( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) &&
+								( prvGetCertainNextTask() == pxTCB ) )
+							{
+								prvStartBasicTaskInPlace( pxTCB, pxCurrentTCB, pdTRUE );
+								xRunNested = pdTRUE;
+							}
+							else
+							{
+								xYieldRequired = pdTRUE;
+							}
+						}
+						#else
+						{
+							xYieldRequired = pdTRUE;
+						}
+						#endif /* configUSE_PREEMPTION */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The task is already active, so runs again when it
+				completes. */
+				pxTCB->uxBasicTaskActivations++;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xRunNested != pdFALSE )
+		{
+			/* The calling task continues when the activated task, and any
+			basic task that runs in its place, has completed. */
+			prvRunBasicTask( pxTCB );
+		}
+		else if( xYieldRequired != pdFALSE )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	void vTaskActivateFromISR( TaskHandle_t xTask, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) xTask;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( pxTCB );
+		configASSERT( pxTCB->pxBasicTaskCode != NULL );
+
+		/* See the comments in xTaskResumeFromISR() regarding interrupt
+		priorities. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( ( listIS_CONTAINED_WITHIN( &xDormantBasicTaskList, &( pxTCB->xGenericListItem ) ) != pdFALSE ) &&
+				( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE ) )
+			{
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					/* The ready lists cannot be accessed, so the task is held
+					in the pending ready list until the scheduler is
+					unsuspended. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+				}
+
+				if( taskPREEMPTS_CURRENT_TASK( pxTCB->uxPriority ) )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The task is already active, so runs again when it
+				completes. */
+				pxTCB->uxBasicTaskActivations++;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	static portTASK_FUNCTION( prvBasicTaskEntry, pvParameters )
+	{
+		/* A task started by a context switch has no task to return to, so
+		prvRunBasicTask() ends in a context switch rather than returning. */
+		prvRunBasicTask( ( TCB_t * ) pvParameters );
+
+		/* The task is never switched back in here, as it is started from the
+		beginning of this function each time it is activated. */
+		for( ;; )
+		{
+			configASSERT( pvParameters == NULL );
+		}
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	static void prvRunBasicTask( TCB_t *pxTCB )
+	{
+	TCB_t *pxPreempted;
+	TCB_t *pxNext;
+	BaseType_t xRunNext;
+
+		do
+		{
+			/* Run the task to completion.  It does not block, so nothing
+			started on the shared stack after it is still there when it
+			returns. */
+			pxTCB->pxBasicTaskCode( pxTCB->pvBasicTaskParameters );
+
+			taskENTER_CRITICAL();
+			{
+				/* The task function must not return with the scheduler
+				suspended. */
+				configASSERT( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE );
+				configASSERT( pxCurrentTCB == pxTCB );
+
+				/* Give the shared stack above the task back to the basic task
+				it preempted.  The context of the task is not needed again, so
+				the task is simply removed from the top of the stack. */
+				configASSERT( pxTopBasicTask == pxTCB );
+				pxPreempted = pxTCB->pxPreemptedBasicTask;
+				pxTopBasicTask = pxPreempted;
+				pxTCB->xBasicTaskStarted = pdFALSE;
+
+				if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( pxTCB->uxBasicTaskActivations > ( UBaseType_t ) 0U )
+				{
+					/* The task was activated again while it ran, so it stays
+					ready and starts again from the beginning.  Being added to
+					the end of its ready list lets tasks of the same priority
+					run first. */
+					pxTCB->uxBasicTaskActivations--;
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					vListInsertEnd( &xDormantBasicTaskList, &( pxTCB->xGenericListItem ) );
+				}
+
+				xRunNext = pdFALSE;
+				pxNext = prvGetCertainNextTask();
+
+				if( ( pxNext != NULL ) && ( pxNext->pxBasicTaskCode != NULL ) && ( pxNext->xBasicTaskStarted == pdFALSE ) &&
+					( ( pxPreempted == NULL ) || ( pxNext->uxPriority > pxPreempted->uxPriority ) ) )
+				{
+					/* The next task to run is a basic task that would start
+					where this task started, which includes this task if it was
+					activated again.  It is run by this call, so returns to the
+					same place as this task would have. */
+					prvStartBasicTaskInPlace( pxNext, pxPreempted, pxTCB->xBasicTaskNested );
+					pxTCB = pxNext;
+					xRunNext = pdTRUE;
+				}
+				else if( pxTCB->xBasicTaskNested != pdFALSE )
+				{
+					/* The task was started by a function call made by the task
+					it preempted, so returning from this function resumes that
+					task.  The scheduler only has to be told. */
+					configASSERT( pxPreempted != NULL );
+					prvSwitchOutCurrentTask();
+					pxCurrentTCB = pxPreempted;
+					prvSwitchInCurrentTask();
+
+					if( pxNext != pxPreempted )
+					{
+						/* Another task may have to run first, so the context
+						of the preempted task is saved and the next task
+						selected as normal.  The switch takes place when the
+						critical section is exited. */
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* The task was started by a context switch, so there is
+					nothing on the stack to return to, and the next task is
+					switched to by a context switch too.  The switch takes
+					place when the critical section is exited. */
+					portYIELD_WITHIN_API();
+				}
+			}
+			taskEXIT_CRITICAL();
+		} while( xRunNext != pdFALSE );
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	static void prvStartBasicTaskInPlace( TCB_t * const pxTCB, TCB_t * const pxPreempted, const BaseType_t xNested )
+	{
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The context of
+		the task is never saved before it starts, so pxTopOfStack is only set
+		if the task is preempted by a context switch. */
+		pxTCB->pxPreemptedBasicTask = pxPreempted;
+		pxTCB->xBasicTaskStarted = pdTRUE;
+		pxTCB->xBasicTaskNested = xNested;
+		pxTopBasicTask = pxTCB;
+
+		if( pxCurrentTCB != pxTCB )
+		{
+			prvSwitchOutCurrentTask();
+			pxCurrentTCB = pxTCB;
+			prvSwitchInCurrentTask();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	static TCB_t *prvGetCertainNextTask( void )
+	{
+	UBaseType_t uxTopPriority;
+	TCB_t *pxReturn = NULL;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		{
+			/* uxTopReadyPriority may be above the priority of the highest
+			priority ready task, so lower it first in the same way as
+			taskSELECT_HIGHEST_PRIORITY_TASK(). */
+			while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) )
+			{
+				configASSERT( uxTopReadyPriority );
+				--uxTopReadyPriority;
+			}
+
+			uxTopPriority = uxTopReadyPriority;
+		}
+		#else
+		{
+			portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+		}
+		#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+		/* Tasks of the same priority share the processor, and the deadline
+		scheduled priority is ordered by deadline, so a task is only certain to
+		be selected if it is the only one of its priority that is ready. */
+		if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) == ( UBaseType_t ) 1 )
+		{
+			pxReturn = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ uxTopPriority ] ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+		{
+			/* A threshold in force on the running task, or on a task it
+			preempted, can hold off the highest priority task. */
+			if( ( pxCurrentTCB->uxPreemptionThreshold > pxCurrentTCB->uxPriority ) ||
+				( ( pxThresholdTCB != NULL ) && ( uxTopPriority <= pxThresholdTCB->uxPreemptionThreshold ) ) )
+			{
+				pxReturn = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+		#if ( configUSE_IPC == 1 )
+		{
+			/* A pending directed handoff is honoured by the next context
+			switch. */
+			if( pxHandoffTCB != NULL )
+			{
+				pxReturn = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_IPC */
+
+		return pxReturn;
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	static void prvSwitchInBasicTask( void )
+	{
+	StackType_t *pxTopOfStack;
+
+		if( ( pxCurrentTCB->pxBasicTaskCode != NULL ) && ( pxCurrentTCB->xBasicTaskStarted == pdFALSE ) )
+		{
+			if( ( pxTopBasicTask != NULL ) && ( pxCurrentTCB->uxPriority <= pxTopBasicTask->uxPriority ) )
+			{
+				/* The task would start on top of a basic task of the same or a
+				higher priority, so the basic task at the top of the stack runs
+				until it completes instead.  Basic tasks cannot block or be
+				suspended, so it must still be ready. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTopBasicTask->xGenericListItem ) ) == &( pxReadyTasksLists[ pxTopBasicTask->uxPriority ] ) );
+				pxCurrentTCB = pxTopBasicTask;
+			}
+			else
+			{
+				/* The task is being started by a context switch, as it was
+				activated from an interrupt or by a task with its own stack.
+				Start it just below the saved context of the basic task it
+				preempts, or at the base of the shared stack.  An initial frame
+				is created for the task, which the port then restores in the
+				same way as any other saved context. */
+				if( pxTopBasicTask == NULL )
+				{
+					pxTopOfStack = pxBasicTaskStack + ( configBASIC_TASK_STACK_SIZE - 1 );
+				}
+				else
+				{
+					pxTopOfStack = ( StackType_t * ) pxTopBasicTask->pxTopOfStack;
+				}
+
+				pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+				pxCurrentTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, prvBasicTaskEntry, ( void * ) pxCurrentTCB );
+				pxCurrentTCB->pxPreemptedBasicTask = pxTopBasicTask;
+				pxCurrentTCB->xBasicTaskStarted = pdTRUE;
+				pxCurrentTCB->xBasicTaskNested = pdFALSE;
+				pxTopBasicTask = pxCurrentTCB;
+			}
+		}
+		else
+		{
+			/* A basic task that has started can only run again once every
+			basic task above it on the shared stack has completed. */
+			configASSERT( ( pxCurrentTCB->pxBasicTaskCode == NULL ) || ( pxCurrentTCB == pxTopBasicTask ) );
+		}
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	void vTaskPreemptionThresholdSet( TaskHandle_t xTask, UBaseType_t uxNewThreshold )
+	{
+	TCB_t *pxTCB;
+	BaseType_t xYieldRequired = pdFALSE;
+
+		configASSERT( ( uxNewThreshold < configMAX_PRIORITIES ) );
+
+		/* Ensure the new threshold is valid. */
+		if( uxNewThreshold >= ( UBaseType_t ) configMAX_PRIORITIES )
+		{
+			uxNewThreshold = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the threshold of the calling
+			task that is being changed. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			/* Lowering the threshold of the running task may allow a task that
+			is already ready to run to preempt it.  vTaskSwitchContext() makes
+			the final decision. */
+			if( ( pxTCB == pxCurrentTCB ) && ( uxNewThreshold < pxTCB->uxPreemptionThreshold ) )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->uxPreemptionThreshold = uxNewThreshold;
+		}
+		taskEXIT_CRITICAL();
+
+		if( xYieldRequired != pdFALSE )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	UBaseType_t uxTaskPreemptionThresholdGet( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the threshold of the task
+			that called uxTaskPreemptionThresholdGet() that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxPreemptionThreshold;
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	static void prvSelectTaskWithThresholds( void )
+	{
+	UBaseType_t uxTopPriority;
+	BaseType_t xKeepCurrentTask = pdFALSE;
+
+		/* The threshold can only hold off other tasks while the running task
+		is still able to run.  If it has blocked, been suspended or been
+		deleted it is no longer referenced from a ready list. */
+		if( ( pxCurrentTCB->uxPreemptionThreshold > pxCurrentTCB->uxPriority ) &&
+			( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xGenericListItem ) ) != pdFALSE ) )
+		{
+			#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+			{
+				/* uxTopReadyPriority may be above the priority of the highest
+				priority ready task, so lower it first in the same way as
+				taskSELECT_HIGHEST_PRIORITY_TASK(). */
+				while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) )
+				{
+					configASSERT( uxTopReadyPriority );
+					--uxTopReadyPriority;
+				}
+
+				uxTopPriority = uxTopReadyPriority;
+			}
+			#else
+			{
+				portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+			}
+			#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+			/* Tasks of the same priority as the running task are at or below
+			its threshold too, so do not share the processor with it. */
+			if( uxTopPriority <= pxCurrentTCB->uxPreemptionThreshold )
+			{
+				xKeepCurrentTask = pdTRUE;
+			}
+			else
+			{
+				/* The running task is being preempted part way through, so
+				its threshold stays in force until it runs again.  Any task
+				already in the stack has a threshold below the priority of the
+				running task, so the stack stays in threshold order. */
+				pxCurrentTCB->pxPreemptedThresholdTCB = pxThresholdTCB;
+				pxThresholdTCB = pxCurrentTCB;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xKeepCurrentTask == pdFALSE )
+		{
+			taskSELECT_NEXT_TASK();
+
+			/* A task in the stack that has since been suspended, or has had
+			its priority changed, gives up its threshold. */
+			while( ( pxThresholdTCB != NULL ) &&
+				   ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxThresholdTCB->uxPriority ] ), &( pxThresholdTCB->xGenericListItem ) ) == pdFALSE ) )
+			{
+				pxThresholdTCB = pxThresholdTCB->pxPreemptedThresholdTCB;
+			}
+
+			/* Only a task above the threshold of the most recently preempted
+			holder can run ahead of it.  The holders below it in the stack
+			have lower thresholds, so do not need to be checked. */
+			if( pxThresholdTCB != NULL )
+			{
+				if( ( pxCurrentTCB == pxThresholdTCB ) || ( pxCurrentTCB->uxPriority <= pxThresholdTCB->uxPreemptionThreshold ) )
+				{
+					pxCurrentTCB = pxThresholdTCB;
+					pxThresholdTCB = pxCurrentTCB->pxPreemptedThresholdTCB;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	static void prvRemoveFromThresholdStack( const TCB_t * const pxTCB )
+	{
+	TCB_t *pxWalk;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		if( pxThresholdTCB == pxTCB )
+		{
+			pxThresholdTCB = pxTCB->pxPreemptedThresholdTCB;
+		}
+		else
+		{
+			for( pxWalk = pxThresholdTCB; pxWalk != NULL; pxWalk = pxWalk->pxPreemptedThresholdTCB )
+			{
+				if( pxWalk->pxPreemptedThresholdTCB == pxTCB )
+				{
+					pxWalk->pxPreemptedThresholdTCB = pxTCB->pxPreemptedThresholdTCB;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+	}
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULING == 1 ) && ( INCLUDE_vTaskDelayUntil == 1 ) )
+
+	BaseType_t xTaskDelayUntilWithDeadline( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement, const TickType_t xRelativeDeadline )
+	{
+	BaseType_t xReturn = pdPASS;
+
+		/* The relative deadline is not a sort key, so it can be changed while
+		the task is in a ready list.  vTaskDelayUntil() uses it to set the
+		absolute deadline of the next release.  The deadline heap only needs
+		to be grown when the relative deadline changes. */
+		if( pxCurrentTCB->xRelativeDeadline != xRelativeDeadline )
+		{
+			vTaskSuspendAll();
+			{
+				xReturn = prvSetRelativeDeadline( pxCurrentTCB, xRelativeDeadline );
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xReturn != pdFAIL )
+		{
+			vTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( configUSE_EDF_SCHEDULING == 1 ) && ( INCLUDE_vTaskDelayUntil == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	BaseType_t xTaskDeadlineSet( TaskHandle_t xTask, const TickType_t xRelativeDeadline )
+	{
+	TCB_t *pxTCB;
+	BaseType_t xReturn;
+	BaseType_t xYieldRequired = pdFALSE;
+
+		/* The scheduler is suspended rather than interrupts disabled as the
+		deadline heap might need to be grown.  The ready lists and the heap are
+		not changed by interrupts while the scheduler is suspended. */
+		vTaskSuspendAll();
+		{
+			/* If null is passed in here then it is the deadline of the calling
+			task that is being set. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			xReturn = prvSetRelativeDeadline( pxTCB, xRelativeDeadline );
+
+			if( ( xReturn != pdFAIL ) && ( xRelativeDeadline != ( TickType_t ) 0U ) )
+			{
+				prvSetDeadline( pxTCB, pdTRUE, xTickCount + xRelativeDeadline );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The change may alter which of the deadline scheduled tasks should
+			be running. */
+			if( ( pxTCB->uxPriority == ( UBaseType_t ) configEDF_TASK_PRIORITY ) && ( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_TASK_PRIORITY ) )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( ( xTaskResumeAll() == pdFALSE ) && ( xYieldRequired != pdFALSE ) && ( xSchedulerRunning != pdFALSE ) )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	TickType_t xTaskDeadlineGet( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	TickType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the deadline of the task
+			that called xTaskDeadlineGet() that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			if( pxTCB->xHasDeadline != pdFALSE )
+			{
+				xReturn = pxTCB->xAbsoluteDeadline;
+			}
+			else
+			{
+				xReturn = portMAX_DELAY;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static BaseType_t prvSetRelativeDeadline( TCB_t * const pxTCB, const TickType_t xRelativeDeadline )
+	{
+	BaseType_t xReturn = pdPASS;
+	TCB_t **pxNewHeap;
+	UBaseType_t uxNewSize;
+
+		if( ( pxTCB->xRelativeDeadline == ( TickType_t ) 0U ) && ( xRelativeDeadline != ( TickType_t ) 0U ) )
+		{
+			/* The task may now be placed in the deadline heap, so make sure
+			the heap has room for it before it is needed.  The heap is grown
+			here, from a task, so that it is never allocated from an interrupt
+			or from within the scheduler. */
+			if( uxDeadlineTasks == uxDeadlineHeapSize )
+			{
+				if( uxDeadlineHeapSize == ( UBaseType_t ) 0U )
+				{
+					uxNewSize = taskDEADLINE_HEAP_INITIAL_SIZE;
+				}
+				else
+				{
+					uxNewSize = uxDeadlineHeapSize << 1;
+				}
+
+				pxNewHeap = ( TCB_t ** ) pvPortMalloc( ( size_t ) uxNewSize * sizeof( TCB_t * ) );
+
+				if( pxNewHeap != NULL )
+				{
+					if( pxDeadlineHeap != NULL )
+					{
+						memcpy( ( void * ) pxNewHeap, ( void * ) pxDeadlineHeap, ( size_t ) uxDeadlineHeapLength * sizeof( TCB_t * ) );
+						vPortFree( pxDeadlineHeap );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxDeadlineHeap = pxNewHeap;
+					uxDeadlineHeapSize = uxNewSize;
+				}
+				else
+				{
+					xReturn = pdFAIL;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xReturn != pdFAIL )
+			{
+				uxDeadlineTasks++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( ( pxTCB->xRelativeDeadline != ( TickType_t ) 0U ) && ( xRelativeDeadline == ( TickType_t ) 0U ) )
+		{
+			/* Removing the deadline also takes the task out of the heap. */
+			uxDeadlineTasks--;
+			prvSetDeadline( pxTCB, pdFALSE, ( TickType_t ) 0U );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xReturn != pdFAIL )
+		{
+			pxTCB->xRelativeDeadline = xRelativeDeadline;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvInsertIntoReadyList( TCB_t * const pxTCB )
+	{
+		vListInsertEnd( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) );
+
+		if( ( pxTCB->uxPriority == ( UBaseType_t ) configEDF_TASK_PRIORITY ) && ( pxTCB->xHasDeadline != pdFALSE ) )
+		{
+			/* A task that blocked and was readied again before it was switched
+			out is still in the heap. */
+			if( pxTCB->uxDeadlineHeapIndex == ( UBaseType_t ) 0U )
+			{
+				prvDeadlineHeapInsert( pxTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* A ready task whose priority was changed away from
+			configEDF_TASK_PRIORITY is put back in the ready lists through
+			here, so is taken out of the heap. */
+			prvDeadlineHeapRemove( pxTCB );
+		}
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvSetDeadline( TCB_t * const pxTCB, const BaseType_t xHasDeadline, const TickType_t xAbsoluteDeadline )
+	{
+		pxTCB->xHasDeadline = xHasDeadline;
+		pxTCB->xAbsoluteDeadline = xAbsoluteDeadline;
+
+		/* The deadline is the key of the deadline heap, so a task in the heap
+		is moved to its new position.  Only ready tasks are kept in the heap. */
+		if( ( xHasDeadline != pdFALSE ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_TASK_PRIORITY ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE ) )
+		{
+			if( pxTCB->uxDeadlineHeapIndex != ( UBaseType_t ) 0U )
+			{
+				prvDeadlineHeapSift( pxTCB->uxDeadlineHeapIndex - ( UBaseType_t ) 1U );
+			}
+			else
+			{
+				prvDeadlineHeapInsert( pxTCB );
+			}
+		}
+		else
+		{
+			prvDeadlineHeapRemove( pxTCB );
+		}
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvDeadlineHeapInsert( TCB_t * const pxTCB )
+	{
+		/* prvSetRelativeDeadline() makes sure the heap has room for every task
+		that has a relative deadline. */
+		configASSERT( uxDeadlineHeapLength < uxDeadlineHeapSize );
+
+		pxDeadlineHeap[ uxDeadlineHeapLength ] = pxTCB;
+		uxDeadlineHeapLength++;
+		prvDeadlineHeapSift( uxDeadlineHeapLength - ( UBaseType_t ) 1U );
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvDeadlineHeapRemove( TCB_t * const pxTCB )
+	{
+	UBaseType_t uxPosition;
+
+		if( pxTCB->uxDeadlineHeapIndex != ( UBaseType_t ) 0U )
+		{
+			uxPosition = pxTCB->uxDeadlineHeapIndex - ( UBaseType_t ) 1U;
+			pxTCB->uxDeadlineHeapIndex = ( UBaseType_t ) 0U;
+			uxDeadlineHeapLength--;
+
+			/* The last task in the heap fills the gap, then is moved to its
+			position. */
+			if( uxPosition < uxDeadlineHeapLength )
+			{
+				pxDeadlineHeap[ uxPosition ] = pxDeadlineHeap[ uxDeadlineHeapLength ];
+				prvDeadlineHeapSift( uxPosition );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvDeadlineHeapSift( UBaseType_t uxPosition )
+	{
+	TCB_t * const pxTCB = pxDeadlineHeap[ uxPosition ];
+	UBaseType_t uxChild;
+
+		/* Move the task up while its deadline is before that of its parent. */
+		while( ( uxPosition > ( UBaseType_t ) 0U ) && ( taskDEADLINE_IS_BEFORE( pxTCB->xAbsoluteDeadline, pxDeadlineHeap[ taskDEADLINE_HEAP_PARENT( uxPosition ) ]->xAbsoluteDeadline ) ) )
+		{
+			pxDeadlineHeap[ uxPosition ] = pxDeadlineHeap[ taskDEADLINE_HEAP_PARENT( uxPosition ) ];
+			pxDeadlineHeap[ uxPosition ]->uxDeadlineHeapIndex = uxPosition + ( UBaseType_t ) 1U;
+			uxPosition = taskDEADLINE_HEAP_PARENT( uxPosition );
+		}
+
+		/* Then down while either child has an earlier deadline. */
+		uxChild = taskDEADLINE_HEAP_CHILD( uxPosition );
+
+		while( uxChild < uxDeadlineHeapLength )
+		{
+			if( ( ( uxChild + ( UBaseType_t ) 1U ) < uxDeadlineHeapLength ) && ( taskDEADLINE_IS_BEFORE( pxDeadlineHeap[ uxChild + ( UBaseType_t ) 1U ]->xAbsoluteDeadline, pxDeadlineHeap[ uxChild ]->xAbsoluteDeadline ) ) )
+			{
+				uxChild++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( taskDEADLINE_IS_BEFORE( pxDeadlineHeap[ uxChild ]->xAbsoluteDeadline, pxTCB->xAbsoluteDeadline ) )
+			{
+				pxDeadlineHeap[ uxPosition ] = pxDeadlineHeap[ uxChild ];
+				pxDeadlineHeap[ uxPosition ]->uxDeadlineHeapIndex = uxPosition + ( UBaseType_t ) 1U;
+				uxPosition = uxChild;
+				uxChild = taskDEADLINE_HEAP_CHILD( uxPosition );
+			}
+			else
+			{
+				/* The task is in order with both of its children. */
+				uxChild = uxDeadlineHeapLength;
+			}
+		}
+
+		pxDeadlineHeap[ uxPosition ] = pxTCB;
+		pxTCB->uxDeadlineHeapIndex = uxPosition + ( UBaseType_t ) 1U;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static TCB_t *prvSelectDeadlineTask( void )
+	{
+	TCB_t *pxTCB;
+
+		/* Every ready task of this priority that has a deadline is in the heap,
+		and tasks that leave the ready list are taken out of the heap as they
+		do so.  Any task that left the ready list by another route is taken out
+		here, once, when it reaches the top of the heap. */
+		while( ( uxDeadlineHeapLength > ( UBaseType_t ) 0U ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_TASK_PRIORITY ] ), &( pxDeadlineHeap[ 0 ]->xGenericListItem ) ) == pdFALSE ) )
+		{
+			prvDeadlineHeapRemove( pxDeadlineHeap[ 0 ] );
+		}
+
+		if( uxDeadlineHeapLength > ( UBaseType_t ) 0U )
+		{
+			pxTCB = pxDeadlineHeap[ 0 ];
+		}
+		else
+		{
+			/* None of the ready tasks has a deadline. */
+			listGET_OWNER_OF_NEXT_ENTRY( pxTCB, &( pxReadyTasksLists[ configEDF_TASK_PRIORITY ] ) );
+		}
+
+		return pxTCB;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	static BaseType_t prvBudgetCharge( void )
+	{
+	const uint32_t ulNow = portGET_CYCLE_COUNT();
+	const uint32_t ulUsed = ulNow - ulBudgetLastChargeCycles;
+	BaseType_t xExhausted = pdFALSE;
+
+		ulBudgetLastChargeCycles = ulNow;
+
+		/* A task whose budget is being enforced runs, if at all, at the
+		demoted priority or a priority it has inherited, so is not
+		charged. */
+		if( ( pxCurrentTCB->ulBudgetCycles != 0UL ) && ( pxCurrentTCB->xBudgetEnforced == pdFALSE ) )
+		{
+			/* A task that was still running when its budget was released is
+			in a new activation from now. */
+			if( pxCurrentTCB->xBudgetActive == pdFALSE )
+			{
+				pxCurrentTCB->xBudgetActive = pdTRUE;
+				pxCurrentTCB->xBudgetActivationTime = xTickCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxCurrentTCB->ulBudgetConsumed += ulUsed;
+
+			if( ulUsed < pxCurrentTCB->ulBudgetRemaining )
+			{
+				pxCurrentTCB->ulBudgetRemaining -= ulUsed;
+			}
+			else
+			{
+				pxCurrentTCB->ulBudgetRemaining = 0UL;
+				xExhausted = pdTRUE;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xExhausted;
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	static void prvBudgetEndActivation( TCB_t * const pxTCB )
+	{
+	TickType_t xReplenishTime;
+
+		if( pxTCB->ulBudgetConsumed != 0UL )
+		{
+			/* Each task holds at most one pending replenishment.  Activations
+			start in time order, so merging a new replenishment into a pending
+			one moves it later, which never returns budget earlier than the
+			sporadic server rules allow. */
+			if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+			{
+				( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->ulBudgetPendingReplenishment += pxTCB->ulBudgetConsumed;
+			pxTCB->ulBudgetConsumed = 0UL;
+
+			/* An activation that lasted a full replenishment period or more
+			is replenished on the next tick. */
+			if( ( TickType_t ) ( xTickCount - pxTCB->xBudgetActivationTime ) < pxTCB->xBudgetPeriod )
+			{
+				xReplenishTime = pxTCB->xBudgetActivationTime + pxTCB->xBudgetPeriod;
+			}
+			else
+			{
+				xReplenishTime = xTickCount + ( TickType_t ) 1U;
+			}
+
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xBudgetListItem ), xReplenishTime );
+
+			if( xReplenishTime < xTickCount )
+			{
+				/* The replenishment time has overflowed.  Place this item in
+				the overflow list. */
+				vListInsert( pxOverflowBudgetReplenishList, &( pxTCB->xBudgetListItem ) );
+			}
+			else
+			{
+				vListInsert( pxBudgetReplenishList, &( pxTCB->xBudgetListItem ) );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxTCB->xBudgetActive = pdFALSE;
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	static void prvBudgetEnforce( TCB_t * const pxTCB )
+	{
+	const UBaseType_t uxOldPriority = taskGET_UNINHERITED_PRIORITY( pxTCB );
+
+		( pxTCB->ulBudgetExhaustions )++;
+		prvBudgetEndActivation( pxTCB );
+		pxTCB->xBudgetEnforced = pdTRUE;
+
+		if( pxTCB->eExhaustedAction == eBudgetSuspend )
+		{
+			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xGenericListItem ) );
+		}
+		else
+		{
+			/* Setting xBudgetEnforced caps the base priority of the task.
+			As with vTaskPrioritySet(), the priority being used only changes
+			if the task is not using an inherited priority, otherwise the task
+			drops to the demoted priority when it gives back the mutex. */
+			if( ( pxTCB->uxPriority == uxOldPriority ) && ( taskGET_UNINHERITED_PRIORITY( pxTCB ) != uxOldPriority ) )
+			{
+				prvBudgetSetPriority( pxTCB, taskGET_UNINHERITED_PRIORITY( pxTCB ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	static BaseType_t prvBudgetRelease( TCB_t * const pxTCB )
+	{
+	const UBaseType_t uxOldPriority = taskGET_UNINHERITED_PRIORITY( pxTCB );
+	BaseType_t xReturn = pdFALSE;
+
+		pxTCB->xBudgetEnforced = pdFALSE;
+
+		if( pxTCB->eExhaustedAction == eBudgetSuspend )
+		{
+			/* The task may have been resumed by the application already. */
+			if( listIS_CONTAINED_WITHIN( &xSuspendedTaskList, &( pxTCB->xGenericListItem ) ) != pdFALSE )
+			{
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+				xReturn = taskTCB_PREEMPTS_CURRENT_TASK( pxTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* Clearing xBudgetEnforced lifts the cap on the base priority,
+			including any change made by vTaskPrioritySet() while the task
+			was demoted. */
+			if( ( pxTCB->uxPriority == uxOldPriority ) && ( taskGET_UNINHERITED_PRIORITY( pxTCB ) != uxOldPriority ) )
+			{
+				prvBudgetSetPriority( pxTCB, taskGET_UNINHERITED_PRIORITY( pxTCB ) );
+
+				if( ( pxTCB != pxCurrentTCB ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE ) )
+				{
+					xReturn = taskTCB_PREEMPTS_CURRENT_TASK( pxTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	static void prvBudgetSetPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority )
+	{
+		/* Only reset the event list item value if the value is not being
+		used for anything else. */
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* If the task is in a ready list it must be moved to the list for its
+		new priority. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+		{
+			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->uxPriority = uxNewPriority;
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			pxTCB->uxPriority = uxNewPriority;
+		}
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	void vTaskBudgetSet( TaskHandle_t xTask, const uint32_t ulBudgetCycles, const TickType_t xReplenishPeriod, const eBudgetAction eAction )
+	{
+	TCB_t *pxTCB;
+	BaseType_t xYieldRequired = pdFALSE;
+
+		configASSERT( ( ulBudgetCycles == 0UL ) || ( xReplenishPeriod > ( TickType_t ) 0U ) );
+
+		/* Budgets are measured with the cycle counter. */
+		portENABLE_CYCLE_COUNTER();
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the budget of the calling
+			task that is being set. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			#if ( configUSE_BASIC_TASKS == 1 )
+			{
+				/* Enforcing a budget would suspend or demote the task while
+				it holds the shared stack, so basic tasks cannot have one. */
+				configASSERT( ( pxTCB->pxBasicTaskCode == NULL ) || ( ulBudgetCycles == 0UL ) );
+			}
+			#endif /* configUSE_BASIC_TASKS */
+
+			/* Anything owed to the task under its old budget is discarded. */
+			if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+			{
+				( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( pxTCB->xBudgetEnforced != pdFALSE )
+			{
+				xYieldRequired = prvBudgetRelease( pxTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->ulBudgetCycles = ulBudgetCycles;
+			pxTCB->ulBudgetRemaining = ulBudgetCycles;
+			pxTCB->ulBudgetConsumed = 0UL;
+			pxTCB->ulBudgetPendingReplenishment = 0UL;
+			pxTCB->xBudgetPeriod = xReplenishPeriod;
+			pxTCB->eExhaustedAction = eAction;
+			pxTCB->xBudgetActive = pdFALSE;
+
+			/* The running task starts an activation now, and is charged from
+			now rather than from when it was switched in. */
+			if( pxTCB == pxCurrentTCB )
+			{
+				pxTCB->xBudgetActive = ( ulBudgetCycles != 0UL ) ? pdTRUE : pdFALSE;
+				pxTCB->xBudgetActivationTime = xTickCount;
+				ulBudgetLastChargeCycles = portGET_CYCLE_COUNT();
+
+				/* The budget may run out before the next tick interrupt that
+				is currently scheduled. */
+				taskDYNAMIC_TICK_UPDATE();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( ( xYieldRequired != pdFALSE ) && ( xSchedulerRunning != pdFALSE ) )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	void vTaskBudgetGetStatus( TaskHandle_t xTask, TaskBudgetStatus_t * const pxBudgetStatus )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( pxBudgetStatus );
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the budget of the calling
+			task that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			pxBudgetStatus->ulBudgetCycles = pxTCB->ulBudgetCycles;
+			pxBudgetStatus->ulRemainingCycles = pxTCB->ulBudgetRemaining;
+			pxBudgetStatus->ulExhaustions = pxTCB->ulBudgetExhaustions;
+			pxBudgetStatus->xEnforced = pxTCB->xBudgetEnforced;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMING_MONITOR == 1 )
+
+	static uint32_t prvTimingCyclesAtTick( const TickType_t xTick )
+	{
+	const TickType_t xTicksAgo = xTimingTickCount - xTick;
+
+		/* A tick that has not been reached yet, as happens if a task is
+		resumed before its release time, is treated as the most recent tick so
+		the task does not record a negative jitter. */
+		if( ( BaseType_t ) xTicksAgo > ( BaseType_t ) 0 )
+		{
+			return ulTimingTickCycles - ( ( uint32_t ) xTicksAgo * taskCYCLES_PER_TICK );
+		}
+		else
+		{
+			return ulTimingTickCycles;
+		}
+	}
+
+#endif /* configUSE_TIMING_MONITOR */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMING_MONITOR == 1 )
+
+	static void prvTimingRecordStart( TCB_t * const pxTCB, const uint32_t ulReleaseCycles, const uint32_t ulStartCycles )
+	{
+	const uint32_t ulJitter = ulStartCycles - ulReleaseCycles;
+
+		pxTCB->xTimingAwaitingStart = pdFALSE;
+		pxTCB->xTimingStatus.ulLastJitterCycles = ulJitter;
+
+		if( ulJitter > pxTCB->xTimingStatus.ulMaxJitterCycles )
+		{
+			pxTCB->xTimingStatus.ulMaxJitterCycles = ulJitter;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_TIMING_MONITOR */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMING_MONITOR == 1 )
+
+	static void prvTimingRecordCompletion( TCB_t * const pxTCB, const uint32_t ulReleaseCycles, const uint32_t ulCompletionCycles, const TickType_t xPeriod )
+	{
+	TaskTimingStatus_t * const pxStatus = &( pxTCB->xTimingStatus );
+	const uint32_t ulResponse = ulCompletionCycles - ulReleaseCycles;
+	const uint32_t ulExecution = pxTCB->ulTimingExecutionCycles + ( ulCompletionCycles - ulTimingSwitchedInCycles );
+	const uint32_t ulPeriodCycles = ( uint32_t ) xPeriod * taskCYCLES_PER_TICK;
+	const uint32_t ulBucketCycles = ulPeriodCycles / ( uint32_t ) ( configTIMING_HISTOGRAM_BUCKETS - 1 );
+	UBaseType_t uxBucket;
+
+		( pxStatus->ulCompletions )++;
+		pxStatus->ulPeriodCycles = ulPeriodCycles;
+		pxStatus->ulLastResponseCycles = ulResponse;
+		pxStatus->ulLastExecutionCycles = ulExecution;
+
+		/* pxTCB is the running task, so the next period is charged from
+		now. */
+		pxTCB->ulTimingExecutionCycles = 0UL;
+		ulTimingSwitchedInCycles = ulCompletionCycles;
+
+		if( ulExecution > pxStatus->ulMaxExecutionCycles )
+		{
+			pxStatus->ulMaxExecutionCycles = ulExecution;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ulResponse > pxStatus->ulMaxResponseCycles )
+		{
+			pxStatus->ulMaxResponseCycles = ulResponse;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* All but the last bucket divide the period evenly.  The last bucket
+		counts the periods that overran. */
+		if( ulResponse >= ulPeriodCycles )
+		{
+			( pxStatus->ulOverruns )++;
+			uxBucket = ( UBaseType_t ) ( configTIMING_HISTOGRAM_BUCKETS - 1 );
+		}
+		else if( ulBucketCycles != 0UL )
+		{
+			uxBucket = ( UBaseType_t ) ( ulResponse / ulBucketCycles );
+
+			/* Rounding down the bucket width can leave a sliver at the end of
+			the period that is not an overrun. */
+			if( uxBucket >= ( UBaseType_t ) ( configTIMING_HISTOGRAM_BUCKETS - 1 ) )
+			{
+				uxBucket = ( UBaseType_t ) ( configTIMING_HISTOGRAM_BUCKETS - 2 );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			uxBucket = ( UBaseType_t ) 0U;
+		}
+
+		( pxStatus->ulResponseHistogram[ uxBucket ] )++;
+	}
+
+#endif /* configUSE_TIMING_MONITOR */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMING_MONITOR == 1 )
+
+	void vTaskGetTimingStatus( TaskHandle_t xTask, TaskTimingStatus_t * const pxTimingStatus )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( pxTimingStatus );
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the calling task that is
+			being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			*pxTimingStatus = pxTCB->xTimingStatus;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TIMING_MONITOR */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMING_MONITOR == 1 )
+
+	void vTaskClearTimingStatus( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the statistics of the
+			calling task that are being cleared. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			( void ) memset( ( void * ) &( pxTCB->xTimingStatus ), 0x00, sizeof( pxTCB->xTimingStatus ) );
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TIMING_MONITOR */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) )
+
+	void vTaskSetEventData( void *pvEventData )
+	{
+		/* Only the running task can set its own event data, and the event data
+		is only read by other tasks once the task is referenced from an event
+		list, so no critical section is needed here. */
+		pxCurrentTCB->pvEventData = pvEventData;
+	}
+
+#endif /* ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) )
+
+	void *pvTaskGetEventData( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+
+		/* If null is passed in here then the event data of the calling task is
+		being queried. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		return pxTCB->pvEventData;
+	}
+
+#endif /* ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_IPC == 1 )
+
+	void vTaskHandoffTo( TaskHandle_t xTask )
+	{
+		/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  The hint
+		is consumed by the next call to vTaskSwitchContext(), which cannot occur
+		until the scheduler is resumed. */
+		pxHandoffTCB = ( TCB_t * ) xTask;
+	}
+
+#endif /* configUSE_IPC */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_IPC == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+	void vTaskPriorityDonate( TaskHandle_t xRecipient, ListItem_t * const pxDonationListItem, UBaseType_t uxDonatedPriority )
+	{
+	TCB_t * const pxTCB = prvGetTCBFromHandle( xRecipient );
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  The donation
+		is recorded until it is returned by xTaskPriorityRestore(), so a
+		recipient that is serving more than one call keeps the priority of the
+		highest priority client it still owes a reply. */
+		listSET_LIST_ITEM_VALUE( pxDonationListItem, ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxDonatedPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		vListInsert( &( pxTCB->xDonationList ), pxDonationListItem );
+
+		/* The donation works in the same way as priority inheritance, but the
+		priority is that of a task that is waiting on the recipient rather than
+		that of the calling task. */
+		if( pxTCB->uxPriority < uxDonatedPriority )
+		{
+			/* Only reset the event list item value if the value is not being
+			used for anything else. */
+			if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+			{
+				listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxDonatedPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* If the task being modified is in the ready state it will need to
+			be moved into a new list. */
+			if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+			{
+				if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxTCB->uxPriority = uxDonatedPriority;
+				prvAddTaskToReadyList( pxTCB );
+			}
+			else
+			{
+				pxTCB->uxPriority = uxDonatedPriority;
+			}
+
+			traceTASK_PRIORITY_INHERIT( pxTCB, uxDonatedPriority );
+
+			#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+			{
+				/* If the recipient is blocked on a mutex then the holder of
+				that mutex, and any holder it is blocked on in turn, must run
+				at the donated priority too. */
+				prvInheritAlongChain( pxTCB, uxDonatedPriority );
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( configUSE_IPC == 1 ) && ( configUSE_MUTEXES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_IPC == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+	BaseType_t xTaskPriorityRestore( ListItem_t * const pxDonationListItem )
+	{
+	TCB_t * const pxTCB = pxCurrentTCB;
+	BaseType_t xReturn = pdFALSE;
+	UBaseType_t uxNewPriority;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION. */
+		configASSERT( listIS_CONTAINED_WITHIN( &( pxTCB->xDonationList ), pxDonationListItem ) != pdFALSE );
+		( void ) uxListRemove( pxDonationListItem );
+
+		/* The task keeps the highest priority donated by any other client it
+		has still to reply to, and its base priority, which may have been
+		raised by a ceiling mutex.  A donated priority is returned in the same
+		way as an inherited one, and for the same reason it is left in place
+		while the task still holds a mutex - it is then returned by
+		xTaskPriorityDisinherit() when the last mutex is given back. */
+		uxNewPriority = prvGetUninheritedPriority( pxTCB );
+
+		if( ( pxTCB->uxPriority > uxNewPriority ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+		{
+			if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			traceTASK_PRIORITY_DISINHERIT( pxTCB, uxNewPriority );
+			pxTCB->uxPriority = uxNewPriority;
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			prvAddTaskToReadyList( pxTCB );
+
+			/* The calling task now has a lower priority, so a context switch
+			might be required. */
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( configUSE_IPC == 1 ) && ( configUSE_MUTEXES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( ( configUSE_IPC == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) ) && ( configUSE_MUTEXES == 1 ) )
+
+	static UBaseType_t prvGetUninheritedPriority( const TCB_t * const pxTCB )
+	{
+	UBaseType_t uxPriority = pxTCB->uxBasePriority;
+
+		#if ( configUSE_TASK_BUDGETS == 1 )
+		{
+			/* A demoted task runs no higher than the demoted priority until
+			its budget is replenished, unless it inherits a priority or is
+			donated one. */
+			if( ( pxTCB->xBudgetEnforced != pdFALSE ) && ( pxTCB->eExhaustedAction == eBudgetDemote ) && ( uxPriority > ( UBaseType_t ) configBUDGET_DEMOTED_PRIORITY ) )
+			{
+				uxPriority = ( UBaseType_t ) configBUDGET_DEMOTED_PRIORITY;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TASK_BUDGETS */
+
+		#if ( configUSE_IPC == 1 )
+		{
+		UBaseType_t uxDonatedPriority;
+
+			/* The donation list is ordered with the highest priority at its
+			head. */
+			if( listLIST_IS_EMPTY( &( pxTCB->xDonationList ) ) == pdFALSE )
+			{
+				uxDonatedPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxTCB->xDonationList ) );
+
+				if( uxDonatedPriority > uxPriority )
+				{
+					uxPriority = uxDonatedPriority;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_IPC */
+
+		return uxPriority;
+	}
+
+#endif /* ( ( configUSE_IPC == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) ) && ( configUSE_MUTEXES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	{
+	TickType_t xTimeToWake;
+	uint32_t ulReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if the notification count is not already non-zero. */
+			if( pxCurrentTCB->ulNotifiedValue == 0UL )
+			{
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->eNotifyState = eWaitingNotification;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					taskASSERT_CURRENT_TASK_CAN_BLOCK();
+
+					/* The task is going to block.  First it must be removed
+					from the ready list. */
+					if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+					{
+						/* The current task must be in a ready list, so there is
+						no need to check, and the port reset macro can be called
+						directly. */
+						portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					#if ( INCLUDE_vTaskSuspend == 1 )
 					{
 						if( xTicksToWait == portMAX_DELAY )
 						{
@@ -4031,6 +8265,8 @@ TickType_t uxReturn;
 
 				if( xTicksToWait > ( TickType_t ) 0 )
 				{
+					taskASSERT_CURRENT_TASK_CAN_BLOCK();
+
 					/* The task is going to block.  First it must be removed
 					from the	ready list. */
 					if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
@@ -4216,7 +8452,7 @@ TickType_t uxReturn;
 				}
 				#endif
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskTCB_PREEMPTS_CURRENT_TASK( pxTCB ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -4334,7 +8570,7 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskTCB_PREEMPTS_CURRENT_TASK( pxTCB ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -4417,7 +8653,7 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskTCB_PREEMPTS_CURRENT_TASK( pxTCB ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
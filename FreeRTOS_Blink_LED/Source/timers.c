@@ -79,6 +79,9 @@ task.h is included from an application file. */
 #include "task.h"
 #include "queue.h"
 #include "timers.h"
+#include "timers_ext.h"
+#include "task_ext.h"
+#include "list_ext.h"
 
 #if ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 0 )
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
@@ -100,6 +103,75 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+/* The message posted to wake the timer service task when a timer command has
+been left pending on a timer.  The value follows the commands in timers.h. */
+#define tmrCOMMAND_PROCESS_PENDING	( ( BaseType_t ) 10 )
+
+/* The timer service task works with TimerTime_t times.  With
+configUSE_64_BIT_TICK_COUNT these are 64-bit and never overflow, so a single
+active timer list is used, ordered by the expiry time held in each timer as the
+list item values cannot hold it.  Command times are sent as TickType_t values,
+and tmrTIME_OF_TICK() extends them using the current time, which is never
+more than a full tick count range after them. */
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+	typedef uint64_t TimerTime_t;
+	#define tmrTIME_OF_TICK( xTick, xTimeNow )	( ( xTimeNow ) - ( TimerTime_t ) ( TickType_t ) ( ( TickType_t ) ( xTimeNow ) - ( xTick ) ) )
+#else
+	typedef TickType_t TimerTime_t;
+	#define tmrTIME_OF_TICK( xTick, xTimeNow )	( xTick )
+#endif /* configUSE_64_BIT_TICK_COUNT */
+
+/* The active timer lists are only switched when the tick count overflows if
+the tick count is 32-bit and the timers are held in sorted lists.  The timing
+wheel indexes timers by the low bits of their expiry time, so is unaffected by
+the tick count wrapping. */
+#define tmrUSE_OVERFLOW_TIMER_LIST	( ( configUSE_TIMER_WHEEL == 0 ) && ( configUSE_64_BIT_TICK_COUNT == 0 ) )
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* The timing wheel has tmrWHEEL_LEVELS levels of tmrWHEEL_SLOTS slots.
+	Level 0 holds the timers that expire within tmrWHEEL_SLOTS ticks of the
+	time the wheel has reached, one slot per tick.  Each slot of level n holds
+	the timers that expire within the span of tmrWHEEL_SLOTS ticks of level
+	n - 1, and these are cascaded down to the lower levels when that span is
+	reached. */
+	#define tmrWHEEL_SLOTS			( ( UBaseType_t ) 1U << configTIMER_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK		( ( TickType_t ) tmrWHEEL_SLOTS - ( TickType_t ) 1U )
+	#define tmrWHEEL_LEVELS			( ( ( sizeof( TickType_t ) * ( size_t ) 8U ) + ( size_t ) configTIMER_WHEEL_SLOT_BITS - ( size_t ) 1U ) / ( size_t ) configTIMER_WHEEL_SLOT_BITS )
+
+	/* Set uxSlot to the lowest slot that has a bit set in uxOccupiedSlots,
+	which must not be 0.  The lowest set bit is isolated so the port's search
+	for the highest set bit can be used to find it. */
+	#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+		#define tmrGET_LOWEST_SLOT( uxSlot, uxOccupiedSlots ) portGET_HIGHEST_PRIORITY( uxSlot, ( uxOccupiedSlots ) & ( ~( uxOccupiedSlots ) + ( UBaseType_t ) 1U ) )
+	#else
+		#define tmrGET_LOWEST_SLOT( uxSlot, uxOccupiedSlots )							\
+		{																				\
+			uxSlot = ( UBaseType_t ) 0U;												\
+			while( ( ( uxOccupiedSlots ) & ( ( UBaseType_t ) 1U << uxSlot ) ) == 0U )	\
+			{																			\
+				++uxSlot;																\
+			}																			\
+		}
+	#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+	/* Expiry times are compared relative to the time the wheel of the timer
+	service has reached, which is never more than a full tick count range
+	behind them. */
+	#define tmrTIME_REACHED( pxService, xTime, xTimeNow )	( ( TickType_t ) ( ( xTime ) - ( pxService )->xTimerWheelTime ) <= ( TickType_t ) ( ( xTimeNow ) - ( pxService )->xTimerWheelTime ) )
+#else
+	#define tmrTIME_REACHED( pxService, xTime, xTimeNow )	( ( xTime ) <= ( xTimeNow ) )
+#endif /* configUSE_TIMER_WHEEL */
+
+/* The time an expired timer was due, from which an auto reload timer is
+reloaded.  With configUSE_TIMER_SLACK the time the timer expired can be later
+than that. */
+#if ( configUSE_TIMER_SLACK == 1 )
+	#define tmrDUE_TIME( pxTimer, xExpiryTime )	( ( pxTimer )->xDueTime )
+#else
+	#define tmrDUE_TIME( pxTimer, xExpiryTime )	( xExpiryTime )
+#endif /* configUSE_TIMER_SLACK */
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -109,9 +181,23 @@ typedef struct tmrTimerControl
 	UBaseType_t				uxAutoReload;		/*<< Set to pdTRUE if the timer should be automatically restarted once expired.  Set to pdFALSE if the timer is, in effect, a one-shot timer. */
 	void 					*pvTimerID;			/*<< An ID to identify the timer.  This allows the timer to be identified when the same callback is used for multiple timers. */
 	TimerCallbackFunction_t	pxCallbackFunction;	/*<< The function that will be called when the timer expires. */
+	struct tmrTimerService	*pxService;			/*<< The timer service task that processes the commands sent to the timer and calls its callback. */
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
 	#endif
+	#if( ( configUSE_64_BIT_TICK_COUNT == 1 ) && ( configUSE_TIMER_WHEEL == 0 ) )
+		TimerTime_t			xExpiryTime;		/*<< The time at which the timer expires while it is in the active timer list.  Only the lower half fits in the list item value. */
+	#endif
+	#if( configUSE_TIMER_COMMAND_COALESCING == 1 )
+		ListItem_t			xCommandListItem;	/*<< Used to reference the timer from the list of timers with a pending command. */
+		BaseType_t			xPendingCommandID;	/*<< The last command sent to the timer that the timer service task has not yet processed. */
+		TickType_t			xPendingCommandValue;/*<< The value sent with xPendingCommandID. */
+		TickType_t			xPendingPeriod;		/*<< A new period sent to the timer and not yet processed, or 0 if there is none. */
+	#endif
+	#if( configUSE_TIMER_SLACK == 1 )
+		TickType_t			xTimerSlack;		/*<< The number of ticks by which the expiry of the timer may be delayed. */
+		TimerTime_t			xDueTime;			/*<< The time at which the timer was last due, which can be before the time at which it is placed in the active timer list. */
+	#endif
 } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -157,22 +243,35 @@ typedef struct tmrTimerQueueMessage
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
-
-/* A queue that is used to send commands to the timer service task. */
-PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
-
-#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
-
-	PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+/* The state of a timer service task.  Each timer service task has its own
+command queue and its own active timers, which only that task is allowed to
+access. */
+typedef struct tmrTimerService
+{
+	#if ( configUSE_TIMER_WHEEL == 0 )
+		List_t				xActiveTimerList1;	/*<< The lists in which active timers are stored.  Timers are referenced in expire time order, with the nearest expiry time at the front of the list. */
+		List_t				*pxCurrentTimerList;
+		#if ( tmrUSE_OVERFLOW_TIMER_LIST == 1 )
+			List_t			xActiveTimerList2;
+			List_t			*pxOverflowTimerList;
+			TickType_t		xLastTime;			/*<< The tick count when the task last sampled it, used to detect the tick count overflowing. */
+		#endif
+	#else
+		List_t				xTimerWheel[ tmrWHEEL_LEVELS ][ tmrWHEEL_SLOTS ];	/*<< The slots of the timing wheel in which active timers are stored, in no particular order within a slot. */
+		UBaseType_t			uxOccupiedSlots[ tmrWHEEL_LEVELS ];	/*<< Bit n of the entry for a level is set while slot n of that level holds timers. */
+		TimerTime_t			xTimerWheelTime;	/*<< The time up to which the timers in the wheel have been processed. */
+		UBaseType_t			uxTimersInWheel;	/*<< The number of timers in the wheel.  The wheel is only moved on while it holds timers, so its time is brought up to date when a timer is placed in it while it is empty. */
+	#endif
+	QueueHandle_t			xTimerQueue;		/*<< A queue that is used to send commands to the timer service task. */
+	#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+		List_t				xPendingCommandList;/*<< The timers that have a command the timer service task has not yet processed. */
+	#endif
+	TaskHandle_t			xTimerTaskHandle;
+} TimerService_t;
 
-#endif
+/* The timer service tasks.  Timers created by xTimerCreate(), and functions
+pended by xTimerPendFunctionCall(), use the first. */
+PRIVILEGED_DATA static TimerService_t xTimerServices[ configTIMER_SERVICE_COUNT ];
 
 /*lint +e956 */
 
@@ -185,8 +284,9 @@ PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
 static void prvCheckForValidListAndQueue( void ) PRIVILEGED_FUNCTION;
 
 /*
- * The timer service task (daemon).  Timer functionality is controlled by this
- * task.  Other tasks communicate with the timer service task using the
+ * The timer service task (daemon).  Timer functionality is controlled by these
+ * tasks, one for each entry in xTimerServices[], which is passed in as the task
+ * parameter.  Other tasks communicate with a timer service task using its
  * xTimerQueue queue.
  */
 static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
@@ -195,31 +295,88 @@ static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
  * Called by the timer service task to interpret and process a command it
  * received on the timer queue.
  */
-static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
+static void prvProcessReceivedCommands( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
+
+/*
+ * Carry out a start, reset, stop, change period or delete command on a timer.
+ */
+static void prvProcessTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xCommandValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record a command as the pending command of a timer, waking the timer service
+ * task if necessary, and process the pending commands of all timers.
+ */
+#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+	static BaseType_t prvPendTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xCommandValue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+	static void prvProcessPendingCommands( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
  * depending on if the expire time causes a timer counter overflow.
  */
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TimerTime_t xNextExpiryTime, const TimerTime_t xTimeNow, const TimerTime_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto reload timer, then call its callback.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( TimerService_t * const pxService, const TimerTime_t xNextExpireTime, const TimerTime_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record xDueTime as the time at which the timer is due, and return the time
+ * within the slack of the timer at which it should be placed in the active
+ * timer list.
+ */
+#if ( configUSE_TIMER_SLACK == 1 )
+	static TimerTime_t prvApplyTimerSlack( Timer_t * const pxTimer, const TimerTime_t xDueTime ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
  * current timer list does not still reference some timers.
  */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+#if ( tmrUSE_OVERFLOW_TIMER_LIST == 1 )
+	static void prvSwitchTimerLists( TimerService_t * const pxService ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Place a timer in the slot of the timing wheel that covers its expiry time,
+ * which must not be before the time the wheel has reached.
+ */
+#if ( configUSE_TIMER_WHEEL == 1 )
+	static void prvTimerWheelInsert( Timer_t * const pxTimer, const TickType_t xExpiryTime ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Remove a timer from the slot of the timing wheel that holds it.
+ */
+#if ( configUSE_TIMER_WHEEL == 1 )
+	static void prvTimerWheelRemove( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Return the next time after the time the wheel has reached at which a timer
+ * in the wheel expires or must be cascaded to a lower level, setting
+ * *pxWheelWasEmpty to pdTRUE if there are no timers in the wheel.
+ */
+#if ( configUSE_TIMER_WHEEL == 1 )
+	static TimerTime_t prvTimerWheelNextEvent( TimerService_t * const pxService, BaseType_t * const pxWheelWasEmpty ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Move the timing wheel on to xTimeNow, cascading timers down the levels and
+ * processing the timers that expire on the way.
+ */
+#if ( configUSE_TIMER_WHEEL == 1 )
+	static void prvTimerWheelAdvance( TimerService_t * const pxService, const TimerTime_t xTimeNow ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
  * if a tick count overflow occurred since prvSampleTimeNow() was last called.
  */
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
+static TimerTime_t prvSampleTimeNow( TimerService_t * const pxService, BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
 /*
  * If the timer list contains any active timers then return the expire time of
@@ -227,44 +384,49 @@ static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
  * to pdTRUE.
  */
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+static TimerTime_t prvGetNextExpireTime( TimerService_t * const pxService, BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
  */
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+static void prvProcessTimerOrBlockTask( TimerService_t * const pxService, const TimerTime_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerCreateTimerTask( void )
 {
 BaseType_t xReturn = pdFAIL;
+UBaseType_t uxService;
 
 	/* This function is called when the scheduler is started if
 	configUSE_TIMERS is set to 1.  Check that the infrastructure used by the
-	timer service task has been created/initialised.  If timers have already
+	timer service tasks has been created/initialised.  If timers have already
 	been created then the initialisation will already have been performed. */
 	prvCheckForValidListAndQueue();
 
-	if( xTimerQueue != NULL )
+	/* Create a task for each timer service, storing its handle so it can be
+	recognised when it sends timer commands, and so the handle of the first
+	can be returned by the xTimerGetTimerDaemonTaskHandle() function. */
+	for( uxService = ( UBaseType_t ) 0U; uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT; uxService++ )
 	{
-		#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+		if( xTimerServices[ uxService ].xTimerQueue != NULL )
 		{
-			/* Create the timer task, storing its handle in xTimerTaskHandle so
-			it can be returned by the xTimerGetTimerDaemonTaskHandle() function. */
-			xReturn = xTaskCreate( prvTimerTask, "Tmr Svc", ( uint16_t ) configTIMER_TASK_STACK_DEPTH, NULL, ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT, &xTimerTaskHandle );
+			xReturn = xTaskCreate( prvTimerTask, "Tmr Svc", ( uint16_t ) configTIMER_TASK_STACK_DEPTH, ( void * ) &( xTimerServices[ uxService ] ), ( ( UBaseType_t ) configTIMER_SERVICE_PRIORITY( uxService ) ) | portPRIVILEGE_BIT, &( xTimerServices[ uxService ].xTimerTaskHandle ) );
 		}
-		#else
+		else
 		{
-			/* Create the timer task without storing its handle. */
-			xReturn = xTaskCreate( prvTimerTask, "Tmr Svc", ( uint16_t ) configTIMER_TASK_STACK_DEPTH, NULL, ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT, NULL);
+			xReturn = pdFAIL;
+		}
+
+		if( xReturn != pdPASS )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#endif
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
 	}
 
 	configASSERT( xReturn );
@@ -273,9 +435,17 @@ BaseType_t xReturn = pdFAIL;
 /*-----------------------------------------------------------*/
 
 TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+	return xTimerCreateForService( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, ( UBaseType_t ) 0U );
+}
+/*-----------------------------------------------------------*/
+
+TimerHandle_t xTimerCreateForService( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, const UBaseType_t uxService ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 {
 Timer_t *pxNewTimer;
 
+	configASSERT( uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT );
+
 	/* Allocate the timer structure. */
 	if( xTimerPeriodInTicks == ( TickType_t ) 0U )
 	{
@@ -296,8 +466,23 @@ Timer_t *pxNewTimer;
 			pxNewTimer->uxAutoReload = uxAutoReload;
 			pxNewTimer->pvTimerID = pvTimerID;
 			pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+			pxNewTimer->pxService = &( xTimerServices[ uxService ] );
 			vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 
+			#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+			{
+				vListInitialiseItem( &( pxNewTimer->xCommandListItem ) );
+				listSET_LIST_ITEM_OWNER( &( pxNewTimer->xCommandListItem ), pxNewTimer );
+				pxNewTimer->xPendingPeriod = ( TickType_t ) 0U;
+			}
+			#endif /* configUSE_TIMER_COMMAND_COALESCING */
+
+			#if ( configUSE_TIMER_SLACK == 1 )
+			{
+				pxNewTimer->xTimerSlack = ( TickType_t ) 0U;
+			}
+			#endif /* configUSE_TIMER_SLACK */
+
 			traceTIMER_CREATE( pxNewTimer );
 		}
 		else
@@ -316,34 +501,49 @@ Timer_t *pxNewTimer;
 BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait )
 {
 BaseType_t xReturn = pdFAIL;
-DaemonTaskMessage_t xMessage;
+TimerService_t *pxService;
+#if ( configUSE_TIMER_COMMAND_COALESCING == 0 )
+	DaemonTaskMessage_t xMessage;
+#endif
 
 	configASSERT( xTimer );
+	pxService = ( ( Timer_t * ) xTimer )->pxService;
 
-	/* Send a message to the timer service task to perform a particular action
-	on a particular timer definition. */
-	if( xTimerQueue != NULL )
+	/* Send a message to the timer service task of the timer to perform a
+	particular action on a particular timer definition. */
+	if( pxService->xTimerQueue != NULL )
 	{
-		/* Send a command to the timer service task to start the xTimer timer. */
-		xMessage.xMessageID = xCommandID;
-		xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
-		xMessage.u.xTimerParameters.pxTimer = ( Timer_t * ) xTimer;
-
-		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+		#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+		{
+			/* The command is left on the timer rather than queued, so cannot
+			fail and never blocks. */
+			( void ) xTicksToWait;
+			xReturn = prvPendTimerCommand( ( Timer_t * ) xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken );
+		}
+		#else
 		{
-			if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+			/* Send a command to the timer service task to start the xTimer timer. */
+			xMessage.xMessageID = xCommandID;
+			xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
+			xMessage.u.xTimerParameters.pxTimer = ( Timer_t * ) xTimer;
+
+			if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+				{
+					xReturn = xQueueSendToBack( pxService->xTimerQueue, &xMessage, xTicksToWait );
+				}
+				else
+				{
+					xReturn = xQueueSendToBack( pxService->xTimerQueue, &xMessage, tmrNO_DELAY );
+				}
 			}
 			else
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+				xReturn = xQueueSendToBackFromISR( pxService->xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
 			}
 		}
-		else
-		{
-			xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
-		}
+		#endif /* configUSE_TIMER_COMMAND_COALESCING */
 
 		traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
 	}
@@ -361,9 +561,10 @@ DaemonTaskMessage_t xMessage;
 	TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
 	{
 		/* If xTimerGetTimerDaemonTaskHandle() is called before the scheduler has been
-		started, then xTimerTaskHandle will be NULL. */
-		configASSERT( ( xTimerTaskHandle != NULL ) );
-		return xTimerTaskHandle;
+		started, then xTimerTaskHandle will be NULL.  The handle of the first
+		timer service task is returned. */
+		configASSERT( ( xTimerServices[ 0 ].xTimerTaskHandle != NULL ) );
+		return xTimerServices[ 0 ].xTimerTaskHandle;
 	}
 
 #endif
@@ -378,10 +579,13 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+#if ( configUSE_TIMER_WHEEL == 0 )
+
+static void prvProcessExpiredTimer( TimerService_t * const pxService, const TimerTime_t xNextExpireTime, const TimerTime_t xTimeNow )
 {
 BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+const TimerTime_t xDueTime = tmrDUE_TIME( pxTimer, xNextExpireTime );
 
 	/* Remove the timer from the list of active timers.  A check has already
 	been performed to ensure the list is not empty. */
@@ -395,11 +599,11 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 		/* The timer is inserted into a list using a time relative to anything
 		other than the current time.  It will therefore be inserted into the
 		correct list relative to the time this task thinks it is now. */
-		if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) == pdTRUE )
+		if( prvInsertTimerInActiveList( pxTimer, ( xDueTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xDueTime ) == pdTRUE )
 		{
 			/* The timer expired before it was added to the active timer
 			list.  Reload it now.  */
-			xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+			xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, ( TickType_t ) xDueTime, NULL, tmrNO_DELAY );
 			configASSERT( xResult );
 			( void ) xResult;
 		}
@@ -416,35 +620,62 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 	/* Call the timer callback. */
 	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
+
+#else /* configUSE_TIMER_WHEEL */
+
+static void prvProcessExpiredTimer( TimerService_t * const pxService, const TimerTime_t xNextExpireTime, const TimerTime_t xTimeNow )
+{
+	/* All the timers that expire up to the current time are processed in one
+	pass of the wheel. */
+	( void ) xNextExpireTime;
+	prvTimerWheelAdvance( pxService, xTimeNow );
+}
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvTimerTask( void *pvParameters )
 {
-TickType_t xNextExpireTime;
+TimerService_t * const pxService = ( TimerService_t * ) pvParameters;
+TimerTime_t xNextExpireTime;
 BaseType_t xListWasEmpty;
 
-	/* Just to avoid compiler warnings. */
-	( void ) pvParameters;
+	#if ( configUSE_TIMER_WHEEL == 1 )
+	{
+		/* Timers are only placed in the wheel by this task, so the wheel can
+		start from the time this task starts. */
+		pxService->xTimerWheelTime = prvSampleTimeNow( pxService, &xListWasEmpty );
+	}
+	#endif /* configUSE_TIMER_WHEEL */
+
+	#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+	{
+		/* Process the commands sent to timers before the scheduler was
+		started, which did not wake this task. */
+		prvProcessPendingCommands( pxService );
+	}
+	#endif /* configUSE_TIMER_COMMAND_COALESCING */
 
 	for( ;; )
 	{
 		/* Query the timers list to see if it contains any timers, and if so,
 		obtain the time at which the next timer will expire. */
-		xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+		xNextExpireTime = prvGetNextExpireTime( pxService, &xListWasEmpty );
 
 		/* If a timer has expired, process it.  Otherwise, block this task
 		until either a timer does expire, or a command is received. */
-		prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+		prvProcessTimerOrBlockTask( pxService, xNextExpireTime, xListWasEmpty );
 
 		/* Empty the command queue. */
-		prvProcessReceivedCommands();
+		prvProcessReceivedCommands( pxService );
 	}
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+static void prvProcessTimerOrBlockTask( TimerService_t * const pxService, const TimerTime_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
-TickType_t xTimeNow;
+TimerTime_t xTimeNow;
+TickType_t xTicksToWait;
 BaseType_t xTimerListsWereSwitched;
 
 	vTaskSuspendAll();
@@ -454,14 +685,14 @@ BaseType_t xTimerListsWereSwitched;
 		then don't process this timer as any timers that remained in the list
 		when the lists were switched will have been processed within the
 		prvSampleTimeNow() function. */
-		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+		xTimeNow = prvSampleTimeNow( pxService, &xTimerListsWereSwitched );
 		if( xTimerListsWereSwitched == pdFALSE )
 		{
 			/* The tick count has not overflowed, has the timer expired? */
-			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+			if( ( xListWasEmpty == pdFALSE ) && ( tmrTIME_REACHED( pxService, xNextExpireTime, xTimeNow ) ) )
 			{
 				( void ) xTaskResumeAll();
-				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+				prvProcessExpiredTimer( pxService, xNextExpireTime, xTimeNow );
 			}
 			else
 			{
@@ -471,14 +702,40 @@ BaseType_t xTimerListsWereSwitched;
 				received - whichever comes first.  The following line cannot
 				be reached unless xNextExpireTime > xTimeNow, except in the
 				case when the current timer list is empty. */
-				if( xListWasEmpty != pdFALSE )
+				#if ( tmrUSE_OVERFLOW_TIMER_LIST == 1 )
 				{
-					/* The current timer list is empty - is the overflow list
-					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					if( xListWasEmpty != pdFALSE )
+					{
+						/* The current timer list is empty - is the overflow list
+						also empty? */
+						xListWasEmpty = listLIST_IS_EMPTY( pxService->pxOverflowTimerList );
+					}
+
+					xTicksToWait = xNextExpireTime - xTimeNow;
+				}
+				#elif ( configUSE_TIMER_WHEEL == 1 )
+				{
+					/* The next event is within a tick count range of the time
+					now. */
+					xTicksToWait = ( TickType_t ) ( xNextExpireTime - xTimeNow );
 				}
+				#else
+				{
+					/* A block time is only TickType_t wide, so a timer that
+					expires further ahead than that is waited for in more than
+					one block. */
+					if( ( xNextExpireTime - xTimeNow ) < ( TimerTime_t ) portMAX_DELAY )
+					{
+						xTicksToWait = ( TickType_t ) ( xNextExpireTime - xTimeNow );
+					}
+					else
+					{
+						xTicksToWait = portMAX_DELAY;
+					}
+				}
+				#endif /* configUSE_64_BIT_TICK_COUNT */
 
-				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+				vQueueWaitForMessageRestricted( pxService->xTimerQueue, xTicksToWait, xListWasEmpty );
 
 				if( xTaskResumeAll() == pdFALSE )
 				{
@@ -502,10 +759,15 @@ BaseType_t xTimerListsWereSwitched;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+static TimerTime_t prvGetNextExpireTime( TimerService_t * const pxService, BaseType_t * const pxListWasEmpty )
 {
-TickType_t xNextExpireTime;
+TimerTime_t xNextExpireTime;
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+	/* The wheel does not know the next expiry time exactly, but does know the
+	next time at which it must be moved on. */
+	xNextExpireTime = prvTimerWheelNextEvent( pxService, pxListWasEmpty );
+#else
 	/* Timers are listed in expiry time order, with the head of the list
 	referencing the task that will expire first.  Obtain the time at which
 	the timer with the nearest expiry time will expire.  If there are no
@@ -513,51 +775,145 @@ TickType_t xNextExpireTime;
 	this task to unblock when the tick count overflows, at which point the
 	timer lists will be switched and the next expiry time can be
 	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+	*pxListWasEmpty = listLIST_IS_EMPTY( pxService->pxCurrentTimerList );
 	if( *pxListWasEmpty == pdFALSE )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		#if ( configUSE_64_BIT_TICK_COUNT == 0 )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+		}
+		#else
+		{
+			xNextExpireTime = ( ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxService->pxCurrentTimerList ) )->xExpiryTime;
+		}
+		#endif /* configUSE_64_BIT_TICK_COUNT */
 	}
 	else
 	{
 		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		xNextExpireTime = ( TimerTime_t ) 0U;
 	}
+#endif /* configUSE_TIMER_WHEEL */
 
 	return xNextExpireTime;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+static TimerTime_t prvSampleTimeNow( TimerService_t * const pxService, BaseType_t * const pxTimerListsWereSwitched )
 {
-TickType_t xTimeNow;
-PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
+TimerTime_t xTimeNow;
+
+	#if ( tmrUSE_OVERFLOW_TIMER_LIST == 1 )
+	{
+		xTimeNow = xTaskGetTickCount();
 
-	xTimeNow = xTaskGetTickCount();
+		if( xTimeNow < pxService->xLastTime )
+		{
+			prvSwitchTimerLists( pxService );
+			*pxTimerListsWereSwitched = pdTRUE;
+		}
+		else
+		{
+			*pxTimerListsWereSwitched = pdFALSE;
+		}
 
-	if( xTimeNow < xLastTime )
+		pxService->xLastTime = xTimeNow;
+	}
+	#elif ( configUSE_64_BIT_TICK_COUNT == 1 )
 	{
-		prvSwitchTimerLists();
-		*pxTimerListsWereSwitched = pdTRUE;
+		/* The 64-bit tick count does not overflow. */
+		( void ) pxService;
+		xTimeNow = ullTaskGetTickCount64();
+		*pxTimerListsWereSwitched = pdFALSE;
 	}
-	else
+	#else
 	{
+		/* The timing wheel does not need to know when the tick count
+		overflows. */
+		( void ) pxService;
+		xTimeNow = xTaskGetTickCount();
 		*pxTimerListsWereSwitched = pdFALSE;
 	}
-
-	xLastTime = xTimeNow;
+	#endif /* tmrUSE_OVERFLOW_TIMER_LIST */
 
 	return xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TimerTime_t xNextExpiryTime, const TimerTime_t xTimeNow, const TimerTime_t xCommandTime )
 {
 BaseType_t xProcessTimerNow = pdFALSE;
+TimerTime_t xListTime;
 
-	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+	/* Whether the timer has already expired is decided by the time it is
+	due, but it is placed in the list at the time it will be processed. */
+	#if ( configUSE_TIMER_SLACK == 1 )
+	{
+		xListTime = prvApplyTimerSlack( pxTimer, xNextExpiryTime );
+	}
+	#else
+	{
+		xListTime = xNextExpiryTime;
+	}
+	#endif /* configUSE_TIMER_SLACK */
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), ( TickType_t ) xListTime );
 	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+	{
+		/* Has the expiry time been reached since the command was issued?
+		Times are compared relative to the command time so the comparison is
+		unaffected by the tick count wrapping. */
+		if( ( TickType_t ) ( xTimeNow - xCommandTime ) >= ( TickType_t ) ( xNextExpiryTime - xCommandTime ) )
+		{
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			/* The time of an empty wheel is not moved on, so may be more than
+			a tick count range behind by now, which would make the expiry
+			time look as if it had already been reached. */
+			if( pxTimer->pxService->uxTimersInWheel == ( UBaseType_t ) 0U )
+			{
+				pxTimer->pxService->xTimerWheelTime = xTimeNow;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvTimerWheelInsert( pxTimer, ( TickType_t ) xListTime );
+		}
+	}
+#elif ( configUSE_64_BIT_TICK_COUNT == 1 )
+	{
+	ListItem_t *pxIterator;
+
+		/* The expiry time cannot have overflowed, so if it is not in the
+		future the timer has already expired. */
+		( void ) xCommandTime;
+
+		if( xNextExpiryTime <= xTimeNow )
+		{
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			pxTimer->xExpiryTime = xListTime;
+
+			for( pxIterator = listGET_HEAD_ENTRY( pxTimer->pxService->pxCurrentTimerList ); pxIterator != ( ListItem_t * ) listGET_END_MARKER( pxTimer->pxService->pxCurrentTimerList ); pxIterator = listGET_NEXT( pxIterator ) ) /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+			{
+				if( ( ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) )->xExpiryTime > xListTime )
+				{
+					break;
+				}
+			}
+
+			vListInsertBefore( pxTimer->pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ), pxIterator );
+		}
+	}
+#else
 	if( xNextExpiryTime <= xTimeNow )
 	{
 		/* Has the expiry time elapsed between the command to start/reset a
@@ -570,7 +926,7 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			vListInsert( pxTimer->pxService->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
 		}
 	}
 	else
@@ -584,22 +940,20 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			vListInsert( pxTimer->pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
 		}
 	}
+#endif /* configUSE_TIMER_WHEEL */
 
 	return xProcessTimerNow;
 }
 /*-----------------------------------------------------------*/
 
-static void	prvProcessReceivedCommands( void )
+static void	prvProcessReceivedCommands( TimerService_t * const pxService )
 {
 DaemonTaskMessage_t xMessage;
-Timer_t *pxTimer;
-BaseType_t xTimerListsWereSwitched, xResult;
-TickType_t xTimeNow;
 
-	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+	while( xQueueReceive( pxService->xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
 		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
 		{
@@ -627,98 +981,272 @@ TickType_t xTimeNow;
 		function calls. */
 		if( xMessage.xMessageID >= ( BaseType_t ) 0 )
 		{
-			/* The messages uses the xTimerParameters member to work on a
-			software timer. */
-			pxTimer = xMessage.u.xTimerParameters.pxTimer;
+			#if ( configUSE_TIMER_COMMAND_COALESCING == 0 )
+			{
+				/* The messages uses the xTimerParameters member to work on a
+				software timer. */
+				prvProcessTimerCommand( xMessage.u.xTimerParameters.pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+			}
+			#else
+			{
+				/* Timer commands are held in the timers themselves.  The
+				message only ensures this task runs to process them, which is
+				done below. */
+				configASSERT( xMessage.xMessageID == tmrCOMMAND_PROCESS_PENDING );
+			}
+			#endif /* configUSE_TIMER_COMMAND_COALESCING */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+	{
+		prvProcessPendingCommands( pxService );
+	}
+	#endif /* configUSE_TIMER_COMMAND_COALESCING */
+}
+/*-----------------------------------------------------------*/
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+static void prvProcessTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xCommandValue )
+{
+BaseType_t xTimerListsWereSwitched, xResult;
+TimerTime_t xTimeNow, xCommandTime;
+
+	if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+	{
+		/* The timer is in a list, remove it. */
+		#if ( configUSE_TIMER_WHEEL == 1 )
+		{
+			prvTimerWheelRemove( pxTimer );
+		}
+		#else
+		{
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		}
+		#endif /* configUSE_TIMER_WHEEL */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceTIMER_COMMAND_RECEIVED( pxTimer, xCommandID, xCommandValue );
+
+	/* In this case the xTimerListsWereSwitched parameter is not used, but
+	it must be present in the function call.  prvSampleTimeNow() must be
+	called after the message is received from xTimerQueue so there is no
+	possibility of a higher priority task adding a message to the message
+	queue with a time that is ahead of the timer daemon task (because it
+	pre-empted the timer daemon task after the xTimeNow value was set). */
+	xTimeNow = prvSampleTimeNow( pxTimer->pxService, &xTimerListsWereSwitched );
+
+	switch( xCommandID )
+	{
+		case tmrCOMMAND_START :
+	    case tmrCOMMAND_START_FROM_ISR :
+	    case tmrCOMMAND_RESET :
+	    case tmrCOMMAND_RESET_FROM_ISR :
+		case tmrCOMMAND_START_DONT_TRACE :
+			/* Start or restart a timer. */
+			xCommandTime = tmrTIME_OF_TICK( xCommandValue, xTimeNow );
+			if( prvInsertTimerInActiveList( pxTimer,  xCommandTime + pxTimer->xTimerPeriodInTicks, xTimeNow, xCommandTime ) == pdTRUE )
 			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				/* The timer expired before it was added to the active
+				timer list.  Process it now. */
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+				traceTIMER_EXPIRED( pxTimer );
+
+				if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+				{
+					xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xCommandValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
+					configASSERT( xResult );
+					( void ) xResult;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+			break;
+
+		case tmrCOMMAND_STOP :
+		case tmrCOMMAND_STOP_FROM_ISR :
+			/* The timer has already been removed from the active list.
+			There is nothing to do here. */
+			break;
+
+		case tmrCOMMAND_CHANGE_PERIOD :
+		case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+			pxTimer->xTimerPeriodInTicks = xCommandValue;
+			configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+			/* The new period does not really have a reference, and can be
+			longer or shorter than the old one.  The command time is
+			therefore set to the current time, and as the period cannot be
+			zero the next expiry time can only be in the future, meaning
+			(unlike for the xTimerStart() case above) there is no fail case
+			that needs to be handled here. */
+			( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+			break;
+
+		case tmrCOMMAND_DELETE :
+			/* The timer has already been removed from the active list,
+			just free up the memory. */
+			vPortFree( pxTimer );
+			break;
+
+		default	:
+			/* Don't expect to get here. */
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
 
-			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+	static BaseType_t prvPendTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xCommandValue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	TimerService_t * const pxService = pxTimer->pxService;
+	DaemonTaskMessage_t xMessage;
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xWakeTimerTask;
+
+		/* The command replaces any command already pending on the timer, so
+		however many commands are sent to the timer before the timer service
+		task runs only the last takes effect.  A new period is remembered
+		separately as it still applies if another command follows it.  The
+		timer is only added to the list of timers with a pending command, and
+		the timer service task only woken, if no command was pending.  This
+		function can be called from tasks and interrupts alike. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( ( xCommandID == tmrCOMMAND_CHANGE_PERIOD ) || ( xCommandID == tmrCOMMAND_CHANGE_PERIOD_FROM_ISR ) )
+			{
+				pxTimer->xPendingPeriod = xCommandValue;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-			/* In this case the xTimerListsWereSwitched parameter is not used, but
-			it must be present in the function call.  prvSampleTimeNow() must be
-			called after the message is received from xTimerQueue so there is no
-			possibility of a higher priority task adding a message to the message
-			queue with a time that is ahead of the timer daemon task (because it
-			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+			pxTimer->xPendingCommandID = xCommandID;
+			pxTimer->xPendingCommandValue = xCommandValue;
 
-			switch( xMessage.xMessageID )
+			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xCommandListItem ) ) != pdFALSE )
 			{
-				case tmrCOMMAND_START :
-			    case tmrCOMMAND_START_FROM_ISR :
-			    case tmrCOMMAND_RESET :
-			    case tmrCOMMAND_RESET_FROM_ISR :
-				case tmrCOMMAND_START_DONT_TRACE :
-					/* Start or restart a timer. */
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) == pdTRUE )
-					{
-						/* The timer expired before it was added to the active
-						timer list.  Process it now. */
-						pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-						traceTIMER_EXPIRED( pxTimer );
+				xWakeTimerTask = listLIST_IS_EMPTY( &( pxService->xPendingCommandList ) );
+				vListInsertEnd( &( pxService->xPendingCommandList ), &( pxTimer->xCommandListItem ) );
+			}
+			else
+			{
+				xWakeTimerTask = pdFALSE;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		/* The timer service task processes the pending commands before it
+		blocks, so it need not be woken by a command sent before the scheduler
+		is started or by the timer service task itself (from a timer callback,
+		for example).  Otherwise a message is posted to unblock it.  If the
+		queue is full the timer service task has messages to process anyway,
+		so the command still succeeds. */
+		if( xWakeTimerTask != pdFALSE )
+		{
+			xMessage.xMessageID = tmrCOMMAND_PROCESS_PENDING;
+			xMessage.u.xTimerParameters.xMessageValue = ( TickType_t ) 0U;
+			xMessage.u.xTimerParameters.pxTimer = NULL;
 
-						if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
-						{
-							xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
-							configASSERT( xResult );
-							( void ) xResult;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-					break;
+			if( xCommandID >= tmrFIRST_FROM_ISR_COMMAND )
+			{
+				( void ) xQueueSendToBackFromISR( pxService->xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			}
+			else if( ( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED ) && ( xTaskGetCurrentTaskHandle() != pxService->xTimerTaskHandle ) )
+			{
+				( void ) xQueueSendToBack( pxService->xTimerQueue, &xMessage, tmrNO_DELAY );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-				case tmrCOMMAND_STOP :
-				case tmrCOMMAND_STOP_FROM_ISR :
-					/* The timer has already been removed from the active list.
-					There is nothing to do here. */
-					break;
+		return pdPASS;
+	}
 
-				case tmrCOMMAND_CHANGE_PERIOD :
-				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
-					pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-					/* The new period does not really have a reference, and can be
-					longer or shorter than the old one.  The command time is
-					therefore set to the current time, and as the period cannot be
-					zero the next expiry time can only be in the future, meaning
-					(unlike for the xTimerStart() case above) there is no fail case
-					that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-					break;
+#endif /* configUSE_TIMER_COMMAND_COALESCING */
+/*-----------------------------------------------------------*/
 
-				case tmrCOMMAND_DELETE :
-					/* The timer has already been removed from the active list,
-					just free up the memory. */
-					vPortFree( pxTimer );
-					break;
+#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
 
-				default	:
-					/* Don't expect to get here. */
-					break;
+	static void prvProcessPendingCommands( TimerService_t * const pxService )
+	{
+	Timer_t *pxTimer;
+	BaseType_t xCommandID = tmrCOMMAND_STOP;
+	TickType_t xCommandValue = ( TickType_t ) 0U, xNewPeriod = ( TickType_t ) 0U;
+
+		/* Commands can be pended while this loop runs, including by the timer
+		callbacks it executes, so the list is checked until it is empty. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( listLIST_IS_EMPTY( &( pxService->xPendingCommandList ) ) != pdFALSE )
+				{
+					pxTimer = NULL;
+				}
+				else
+				{
+					pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxService->xPendingCommandList ) );
+					( void ) uxListRemove( &( pxTimer->xCommandListItem ) );
+
+					xCommandID = pxTimer->xPendingCommandID;
+					xCommandValue = pxTimer->xPendingCommandValue;
+					xNewPeriod = pxTimer->xPendingPeriod;
+					pxTimer->xPendingPeriod = ( TickType_t ) 0U;
+				}
 			}
+			taskEXIT_CRITICAL();
+
+			if( pxTimer == NULL )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* A change of period that was followed by another command. */
+			if( xNewPeriod != ( TickType_t ) 0U )
+			{
+				pxTimer->xTimerPeriodInTicks = xNewPeriod;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvProcessTimerCommand( pxTimer, xCommandID, xCommandValue );
 		}
 	}
-}
+
+#endif /* configUSE_TIMER_COMMAND_COALESCING */
 /*-----------------------------------------------------------*/
 
-static void prvSwitchTimerLists( void )
+#if ( tmrUSE_OVERFLOW_TIMER_LIST == 1 )
+
+static void prvSwitchTimerLists( TimerService_t * const pxService )
 {
 TickType_t xNextExpireTime, xReloadTime;
 List_t *pxTemp;
@@ -729,12 +1257,11 @@ BaseType_t xResult;
 	If there are any timers still referenced from the current timer list
 	then they must have expired and should be processed before the lists
 	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	while( listLIST_IS_EMPTY( pxService->pxCurrentTimerList ) == pdFALSE )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-
 		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxService->pxCurrentTimerList );
+		xNextExpireTime = tmrDUE_TIME( pxTimer, listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxService->pxCurrentTimerList ) );
 		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 		traceTIMER_EXPIRED( pxTimer );
 
@@ -754,9 +1281,15 @@ BaseType_t xResult;
 			xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
 			if( xReloadTime > xNextExpireTime )
 			{
+				#if ( configUSE_TIMER_SLACK == 1 )
+				{
+					xReloadTime = prvApplyTimerSlack( pxTimer, xReloadTime );
+				}
+				#endif /* configUSE_TIMER_SLACK */
+
 				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
 				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				vListInsert( pxService->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
 			}
 			else
 			{
@@ -771,40 +1304,349 @@ BaseType_t xResult;
 		}
 	}
 
-	pxTemp = pxCurrentTimerList;
-	pxCurrentTimerList = pxOverflowTimerList;
-	pxOverflowTimerList = pxTemp;
+	pxTemp = pxService->pxCurrentTimerList;
+	pxService->pxCurrentTimerList = pxService->pxOverflowTimerList;
+	pxService->pxOverflowTimerList = pxTemp;
 }
+
+#endif /* tmrUSE_OVERFLOW_TIMER_LIST */
 /*-----------------------------------------------------------*/
 
-static void prvCheckForValidListAndQueue( void )
-{
-	/* Check that the list from which active timers are referenced, and the
-	queue used to communicate with the timer service, have been
-	initialised. */
-	taskENTER_CRITICAL();
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvTimerWheelInsert( Timer_t * const pxTimer, const TickType_t xExpiryTime )
 	{
-		if( xTimerQueue == NULL )
+	TimerService_t * const pxService = pxTimer->pxService;
+	const TickType_t xTicksToExpiry = xExpiryTime - ( TickType_t ) pxService->xTimerWheelTime;
+	UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxShift = ( UBaseType_t ) 0U, uxSlot;
+
+		/* Find the lowest level whose span covers the expiry time.  The top
+		level covers whatever remains of the tick count range. */
+		while( ( uxLevel < ( UBaseType_t ) ( tmrWHEEL_LEVELS - 1U ) ) && ( ( xTicksToExpiry >> ( uxShift + ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS ) ) != ( TickType_t ) 0U ) )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
-			xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
-			configASSERT( xTimerQueue );
+			uxLevel++;
+			uxShift += ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS;
+		}
+
+		uxSlot = ( UBaseType_t ) ( ( xExpiryTime >> uxShift ) & tmrWHEEL_SLOT_MASK );
+		listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+		vListInsertEnd( &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+		pxService->uxOccupiedSlots[ uxLevel ] |= ( UBaseType_t ) 1U << uxSlot;
+		( pxService->uxTimersInWheel )++;
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvTimerWheelRemove( Timer_t * const pxTimer )
+	{
+	TimerService_t * const pxService = pxTimer->pxService;
+	List_t * const pxSlot = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+	const UBaseType_t uxIndex = ( UBaseType_t ) ( pxSlot - &( pxService->xTimerWheel[ 0 ][ 0 ] ) );
+
+		/* The slots are held in one array, so the level and slot follow from
+		the position of the list that holds the timer. */
+		if( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0 )
+		{
+			pxService->uxOccupiedSlots[ uxIndex / tmrWHEEL_SLOTS ] &= ~( ( UBaseType_t ) 1U << ( uxIndex % tmrWHEEL_SLOTS ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		( pxService->uxTimersInWheel )--;
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	static TimerTime_t prvTimerWheelNextEvent( TimerService_t * const pxService, BaseType_t * const pxWheelWasEmpty )
+	{
+	const TickType_t xWheelTime = ( TickType_t ) pxService->xTimerWheelTime;
+	TickType_t xSpan, xTicksToEvent, xTicksToNextEvent = portMAX_DELAY;
+	UBaseType_t uxLevel, uxShift, uxPosition, uxSlot, uxLaterSlots;
+
+		*pxWheelWasEmpty = pdTRUE;
+
+		/* Find the first occupied slot after the current position on each
+		level.  On level 0 that is the expiry time of the timers in the slot.
+		On higher levels it is the time at which the timers in the slot will be
+		cascaded, which is at the start of the span of the slot.  The slots
+		after the current position come first.  The slots up to and including
+		the current position are only reached once the level wraps, so they
+		are only searched if the later slots are all empty. */
+		for( uxLevel = ( UBaseType_t ) 0U, uxShift = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) tmrWHEEL_LEVELS; uxLevel++, uxShift += ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS )
+		{
+			if( pxService->uxOccupiedSlots[ uxLevel ] != ( UBaseType_t ) 0U )
+			{
+				*pxWheelWasEmpty = pdFALSE;
+				uxPosition = ( UBaseType_t ) ( ( xWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK );
+
+				/* The shift wraps to 0 when the current position is the last
+				bit, which leaves no later slots. */
+				uxLaterSlots = pxService->uxOccupiedSlots[ uxLevel ] & ~( ( ( UBaseType_t ) 2U << uxPosition ) - ( UBaseType_t ) 1U );
+
+				if( uxLaterSlots != ( UBaseType_t ) 0U )
+				{
+					tmrGET_LOWEST_SLOT( uxSlot, uxLaterSlots );
+				}
+				else
+				{
+					tmrGET_LOWEST_SLOT( uxSlot, pxService->uxOccupiedSlots[ uxLevel ] );
+					uxSlot += tmrWHEEL_SLOTS;
+				}
+
+				xSpan = ( xWheelTime >> uxShift ) + ( TickType_t ) ( uxSlot - uxPosition );
+				xTicksToEvent = ( TickType_t ) ( xSpan << uxShift ) - xWheelTime;
+
+				if( xTicksToEvent < xTicksToNextEvent )
+				{
+					xTicksToNextEvent = xTicksToEvent;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return pxService->xTimerWheelTime + ( TimerTime_t ) xTicksToNextEvent;
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvTimerWheelAdvance( TimerService_t * const pxService, const TimerTime_t xTimeNow )
+	{
+	TimerTime_t xNextEvent;
+	TickType_t xWheelTime;
+	BaseType_t xWheelWasEmpty;
+	UBaseType_t uxLevel, uxShift;
+	List_t *pxSlot;
+	Timer_t *pxTimer;
+
+		for( ;; )
+		{
+			/* Nothing happens between the time the wheel has reached and its
+			next event, so the wheel can be moved straight to the event. */
+			xNextEvent = prvTimerWheelNextEvent( pxService, &xWheelWasEmpty );
+
+			if( ( xWheelWasEmpty != pdFALSE ) || ( tmrTIME_REACHED( pxService, xNextEvent, xTimeNow ) == pdFALSE ) )
+			{
+				pxService->xTimerWheelTime = xTimeNow;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxService->xTimerWheelTime = xNextEvent;
+			xWheelTime = ( TickType_t ) pxService->xTimerWheelTime;
+
+			/* Each level whose span starts at this time has the timers in its
+			current slot cascaded down.  A timer can only move to a lower level,
+			and one that expires now moves to the current slot of level 0. */
+			for( uxLevel = ( UBaseType_t ) 1U, uxShift = ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS; uxLevel < ( UBaseType_t ) tmrWHEEL_LEVELS; uxLevel++, uxShift += ( UBaseType_t ) configTIMER_WHEEL_SLOT_BITS )
+			{
+				if( ( xWheelTime & ( ( ( TickType_t ) 1U << uxShift ) - ( TickType_t ) 1U ) ) != ( TickType_t ) 0U )
+				{
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxSlot = &( pxService->xTimerWheel[ uxLevel ][ ( xWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK ] );
 
-			#if ( configQUEUE_REGISTRY_SIZE > 0 )
+				while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+				{
+					pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+					prvTimerWheelRemove( pxTimer );
+					prvTimerWheelInsert( pxTimer, listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) );
+				}
+			}
+
+			/* Process the timers that expire now.  An auto reload timer is
+			placed straight back in the wheel relative to the time it should
+			have expired, so it is processed again within this loop if it has
+			missed further expiry times. */
+			pxSlot = &( pxService->xTimerWheel[ 0 ][ xWheelTime & tmrWHEEL_SLOT_MASK ] );
+
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
 			{
-				if( xTimerQueue != NULL )
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+				prvTimerWheelRemove( pxTimer );
+				traceTIMER_EXPIRED( pxTimer );
+
+				if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
 				{
-					vQueueAddToRegistry( xTimerQueue, "TmrQ" );
+					#if ( configUSE_TIMER_SLACK == 1 )
+					{
+						/* The slack is less than the period, so the time the
+						timer is next due is after the time it expired. */
+						prvTimerWheelInsert( pxTimer, ( TickType_t ) prvApplyTimerSlack( pxTimer, pxTimer->xDueTime + ( TimerTime_t ) pxTimer->xTimerPeriodInTicks ) );
+					}
+					#else
+					{
+						prvTimerWheelInsert( pxTimer, xWheelTime + pxTimer->xTimerPeriodInTicks );
+					}
+					#endif /* configUSE_TIMER_SLACK */
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+			}
+		}
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_SLACK == 1 )
+
+	static TimerTime_t prvApplyTimerSlack( Timer_t * const pxTimer, const TimerTime_t xDueTime )
+	{
+	TickType_t xSlack = pxTimer->xTimerSlack;
+	TimerTime_t xLatestTime, xMask, xReturn = xDueTime;
+	UBaseType_t uxShift;
+
+		pxTimer->xDueTime = xDueTime;
+
+		/* A timer must be placed before it is next due, so its slack is kept
+		below its period. */
+		if( xSlack >= pxTimer->xTimerPeriodInTicks )
+		{
+			xSlack = pxTimer->xTimerPeriodInTicks - ( TickType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xSlack != ( TickType_t ) 0U )
+		{
+			/* The latest time is not allowed to wrap past the earliest, so
+			both stay in the same timer list when the lists are switched on
+			overflow. */
+			xLatestTime = xDueTime + ( TimerTime_t ) xSlack;
+
+			if( xLatestTime < xDueTime )
+			{
+				xLatestTime = ~( ( TimerTime_t ) 0U );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Clear the bits of the latest time below the most significant bit
+			in which it differs from the due time.  That gives the time within
+			the slack with the most low order bits clear, which timers whose
+			slack overlaps are likely to share. */
+			xMask = xDueTime ^ xLatestTime;
+
+			for( uxShift = ( UBaseType_t ) 1U; uxShift < ( UBaseType_t ) ( sizeof( TimerTime_t ) * ( size_t ) 8U ); uxShift <<= 1U )
+			{
+				xMask |= xMask >> uxShift;
+			}
+
+			xReturn = xLatestTime & ~( xMask >> 1U );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+static void prvCheckForValidListAndQueue( void )
+{
+TimerService_t *pxService;
+UBaseType_t uxService;
+
+	/* Check that the lists from which active timers are referenced, and the
+	queues used to communicate with the timer services, have been
+	initialised.  All the timer services are initialised together. */
+	taskENTER_CRITICAL();
+	{
+		if( xTimerServices[ 0 ].xTimerQueue == NULL )
+		{
+			for( uxService = ( UBaseType_t ) 0U; uxService < ( UBaseType_t ) configTIMER_SERVICE_COUNT; uxService++ )
+			{
+				pxService = &( xTimerServices[ uxService ] );
+
+				#if ( configUSE_TIMER_WHEEL == 0 )
+				{
+					vListInitialise( &( pxService->xActiveTimerList1 ) );
+					pxService->pxCurrentTimerList = &( pxService->xActiveTimerList1 );
+
+					#if ( tmrUSE_OVERFLOW_TIMER_LIST == 1 )
+					{
+						vListInitialise( &( pxService->xActiveTimerList2 ) );
+						pxService->pxOverflowTimerList = &( pxService->xActiveTimerList2 );
+					}
+					#endif /* tmrUSE_OVERFLOW_TIMER_LIST */
+				}
+				#else
+				{
+				UBaseType_t uxLevel, uxSlot;
+
+					for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) tmrWHEEL_LEVELS; uxLevel++ )
+					{
+						for( uxSlot = ( UBaseType_t ) 0U; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+						{
+							vListInitialise( &( pxService->xTimerWheel[ uxLevel ][ uxSlot ] ) );
+						}
+
+						pxService->uxOccupiedSlots[ uxLevel ] = ( UBaseType_t ) 0U;
+					}
+
+					pxService->uxTimersInWheel = ( UBaseType_t ) 0U;
+				}
+				#endif /* configUSE_TIMER_WHEEL */
+
+				#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+				{
+					vListInitialise( &( pxService->xPendingCommandList ) );
+				}
+				#endif /* configUSE_TIMER_COMMAND_COALESCING */
+
+				pxService->xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+				configASSERT( pxService->xTimerQueue );
+
+				#if ( configQUEUE_REGISTRY_SIZE > 0 )
+				{
+					if( pxService->xTimerQueue != NULL )
+					{
+						vQueueAddToRegistry( pxService->xTimerQueue, "TmrQ" );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configQUEUE_REGISTRY_SIZE */
 			}
-			#endif /* configQUEUE_REGISTRY_SIZE */
 		}
 		else
 		{
@@ -867,6 +1709,47 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_SLACK == 1 )
+
+	void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlack )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+
+		/* The slack is only read by the timer service task when it places
+		the timer in the active timer list. */
+		taskENTER_CRITICAL();
+		{
+			pxTimer->xTimerSlack = xSlack;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_SLACK == 1 )
+
+	TickType_t xTimerGetSlack( TimerHandle_t xTimer )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+	TickType_t xReturn;
+
+		configASSERT( xTimer );
+
+		taskENTER_CRITICAL();
+		{
+			xReturn = pxTimer->xTimerSlack;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
 #if( INCLUDE_xTimerPendFunctionCall == 1 )
 
 	BaseType_t xTimerPendFunctionCallFromISR( PendedFunction_t xFunctionToPend, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken )
@@ -875,13 +1758,13 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 	BaseType_t xReturn;
 
 		/* Complete the message with the function parameters and post it to the
-		daemon task. */
+		first daemon task. */
 		xMessage.xMessageID = tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR;
 		xMessage.u.xCallbackParameters.pxCallbackFunction = xFunctionToPend;
 		xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
 		xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-		xReturn = xQueueSendFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+		xReturn = xQueueSendFromISR( xTimerServices[ 0 ].xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
 
 		tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
@@ -901,16 +1784,16 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 		/* This function can only be called after a timer has been created or
 		after the scheduler has been started because, until then, the timer
 		queue does not exist. */
-		configASSERT( xTimerQueue );
+		configASSERT( xTimerServices[ 0 ].xTimerQueue );
 
 		/* Complete the message with the function parameters and post it to the
-		daemon task. */
+		first daemon task. */
 		xMessage.xMessageID = tmrCOMMAND_EXECUTE_CALLBACK;
 		xMessage.u.xCallbackParameters.pxCallbackFunction = xFunctionToPend;
 		xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
 		xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-		xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+		xReturn = xQueueSendToBack( xTimerServices[ 0 ].xTimerQueue, &xMessage, xTicksToWait );
 
 		tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
@@ -0,0 +1,471 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef ACTIVE_H
+#define ACTIVE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include active.h"
+#endif
+
+#include "task.h"
+
+/******************************************************************************
+ *
+ * Active objects.
+ *
+ * An active object is an event driven hierarchical state machine with its
+ * own event queue.  Active objects do not have their own task or stack.
+ * Instead each is assigned to an active object thread, which is a task that
+ * takes events from the queues of its active objects and dispatches them one
+ * at a time to completion.  An application of many small reactive components
+ * therefore needs a few threads - one for each task priority at which the
+ * components need to run - rather than a task and a stack for each component.
+ *
+ * Each active object has a priority, which no other active object in any
+ * thread shares.  A thread holds a bitmap of the priorities of its active
+ * objects that have events waiting, and always dispatches the next event of
+ * the highest priority of them.  A thread whose
+ * active objects have no events waiting blocks on its task notification.
+ * Active objects in threads of higher task priority preempt those in threads
+ * of lower task priority as usual.
+ *
+ * Events are passed by reference, so posting an event copies one pointer into
+ * the queue of the receiving active object.  Events that are not constant are
+ * allocated from fixed block event pools and carry a reference count.  The
+ * count is incremented each time the event is posted and decremented each
+ * time a dispatch of the event completes, and the event is returned to its
+ * pool when the count reaches zero.  An event can also be published to every
+ * active object that has subscribed to its signal.  Each signal that can be
+ * published has a bitmap of the priorities of its subscribers, so
+ * subscribing needs no memory, and publishing costs one post per subscriber,
+ * highest priority first.
+ *
+ * State handlers have the prototype:
+ * <pre>
+ BaseType_t xStateHandler( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+ </pre>
+ * and return one of the macros activeHANDLED(), activeIGNORED(),
+ * activeTRAN() or activeSUPER().  Every state handler must return
+ * activeSUPER() for the signals it does not handle, naming its parent state,
+ * or xActiveTop for a state with no parent.  Entry and exit actions are run
+ * when a state handler is sent activeSIG_ENTRY and activeSIG_EXIT, and a
+ * composite state takes its initial transition to a substate with
+ * activeTRAN() when it is sent activeSIG_INIT.  A transition to a substate
+ * of the source state, or to one of its parent states, is local, so does not
+ * exit and re-enter the source state.  A transition from a state to itself
+ * exits and re-enters the state.
+ *
+ * Active objects do not wait for time to pass.  Use a software timer whose
+ * callback posts an event to the active object instead.
+ *
+ * Set configUSE_ACTIVE_OBJECTS to 1 in FreeRTOSConfig.h to include active
+ * objects.  configUSE_TASK_NOTIFICATIONS must also be 1.
+ *
+ *****************************************************************************/
+
+#ifndef configUSE_ACTIVE_OBJECTS
+	#define configUSE_ACTIVE_OBJECTS 0
+#endif
+
+/* The number of active object priorities, which is also the number of active
+objects that can be started across all the threads. */
+#ifndef configACTIVE_MAX_PRIORITIES
+	#define configACTIVE_MAX_PRIORITIES 8
+#endif
+
+/* The number of event pools that can be created. */
+#ifndef configACTIVE_MAX_EVENT_POOLS
+	#define configACTIVE_MAX_EVENT_POOLS 3
+#endif
+
+/* Signals below this value can be published. */
+#ifndef configACTIVE_MAX_PUBLISHED_SIGNALS
+	#define configACTIVE_MAX_PUBLISHED_SIGNALS 16
+#endif
+
+/* The maximum depth to which states can be nested, not including xActiveTop. */
+#ifndef configACTIVE_MAX_NEST_DEPTH
+	#define configACTIVE_MAX_NEST_DEPTH 6
+#endif
+
+#if ( ( configUSE_ACTIVE_OBJECTS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 in FreeRTOSConfig.h to use active objects.
+#endif
+
+#if ( ( configUSE_ACTIVE_OBJECTS == 1 ) && ( configACTIVE_MAX_PRIORITIES > 32 ) )
+	#error configACTIVE_MAX_PRIORITIES must not be above 32.
+#endif
+
+/* Signals used by the state machine itself.  Application signals start at
+activeSIG_USER. */
+#define activeSIG_EMPTY		( ( ActiveSignal_t ) 0 )	/*< Asks a state handler for its parent state. */
+#define activeSIG_ENTRY		( ( ActiveSignal_t ) 1 )
+#define activeSIG_EXIT		( ( ActiveSignal_t ) 2 )
+#define activeSIG_INIT		( ( ActiveSignal_t ) 3 )
+#define activeSIG_USER		( ( ActiveSignal_t ) 4 )
+
+/* Values returned by state handlers.  Use the macros that follow rather than
+these values directly. */
+#define activeRET_HANDLED	( ( BaseType_t ) 0 )
+#define activeRET_IGNORED	( ( BaseType_t ) 1 )
+#define activeRET_TRAN		( ( BaseType_t ) 2 )
+#define activeRET_SUPER		( ( BaseType_t ) 3 )
+
+#define activeHANDLED()					( activeRET_HANDLED )
+#define activeIGNORED()					( activeRET_IGNORED )
+#define activeTRAN( pxAO, pxTarget )	( ( ( ActiveObject_t * ) ( pxAO ) )->pxTemp = ( pxTarget ), activeRET_TRAN )
+#define activeSUPER( pxAO, pxParent )	( ( ( ActiveObject_t * ) ( pxAO ) )->pxTemp = ( pxParent ), activeRET_SUPER )
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint16_t ActiveSignal_t;
+
+/**
+ * The header of every event.  Events that carry parameters declare this as
+ * their first member.  Constant events are declared with a pool of 0 and a
+ * reference count of 0, for example:
+ * <pre>
+ static const ActiveEvent_t xButtonEvent = { SIG_BUTTON, 0, 0 };
+ </pre>
+ * Events with parameters that change are allocated with pxActiveEventNew().
+ */
+typedef struct xACTIVE_EVENT
+{
+	ActiveSignal_t xSignal;			/*< The signal of the event. */
+	uint8_t ucPool;					/*< One more than the index of the pool the event was allocated from, or 0 for a constant event. */
+	volatile uint8_t ucReferences;	/*< The number of queues that hold the event, plus the number of dispatches of it in progress. */
+} ActiveEvent_t;
+
+struct xACTIVE_OBJECT;
+
+/**
+ * The prototype of a state handler.
+ */
+typedef BaseType_t ( *ActiveStateHandler_t )( struct xACTIVE_OBJECT * const pxAO, const ActiveEvent_t * const pxEvent );
+
+/**
+ * The header of every active object.  The structure of an active object
+ * declares this as its first member, so a state handler can cast the pxAO
+ * parameter to the type of its own active object.  The members are only to
+ * be accessed through the API functions and macros.
+ */
+typedef struct xACTIVE_OBJECT
+{
+	ActiveStateHandler_t pxState;		/*< The innermost active state. */
+	ActiveStateHandler_t pxTemp;		/*< The state named by the last activeTRAN() or activeSUPER(). */
+	void *pvThread;						/*< The thread that dispatches events to the active object. */
+	UBaseType_t uxPriority;				/*< The priority of the active object. */
+	const ActiveEvent_t **ppxQueue;		/*< The storage of the event queue, which holds pointers to events. */
+	UBaseType_t uxQueueLength;			/*< The number of events the queue can hold. */
+	UBaseType_t uxHead;					/*< The index at which the next event posted is stored. */
+	UBaseType_t uxTail;					/*< The index of the next event to dispatch. */
+	volatile UBaseType_t uxWaiting;		/*< The number of events in the queue. */
+} ActiveObject_t;
+
+/**
+ * Type by which active object threads are referenced.
+ */
+typedef void * ActiveThreadHandle_t;
+
+/**
+ * active. h
+ * <pre>
+ BaseType_t xActiveTop( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+ * </pre>
+ *
+ * The state that contains every other state.  States that have no other
+ * parent return activeSUPER( pxAO, xActiveTop ).
+ */
+BaseType_t xActiveTop( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ ActiveThreadHandle_t xActiveThreadCreate( const char * const pcName, uint16_t usStackDepth, UBaseType_t uxPriority );
+ * </pre>
+ *
+ * Create a thread to dispatch events to active objects.  The thread is a task
+ * that runs every active object assigned to it, so its stack must be large
+ * enough for the deepest state handler of any of them.
+ *
+ * @param pcName A descriptive name for the task of the thread.
+ *
+ * @param usStackDepth The size of the stack of the task, in words.
+ *
+ * @param uxPriority The priority of the task.
+ *
+ * @return A handle to the thread, or NULL if the thread could not be created.
+ */
+ActiveThreadHandle_t xActiveThreadCreate( const char * const pcName, const uint16_t usStackDepth, const UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ BaseType_t xActiveObjectStart( ActiveObject_t * const pxAO, ActiveThreadHandle_t xThread, UBaseType_t uxPriority, const ActiveEvent_t **ppxQueueStorage, UBaseType_t uxQueueLength, ActiveStateHandler_t pxInitial );
+ * </pre>
+ *
+ * Take the initial transition of an active object, then assign it to a thread
+ * so events can be posted to it.  The initial transition, and the entry
+ * actions it runs, are run by the calling task, and must not post events to
+ * the active object as it has not been assigned to the thread yet.
+ *
+ * @param pxAO The active object.
+ *
+ * @param xThread The thread that is to dispatch events to the active object.
+ *
+ * @param uxPriority The priority of the active object.  Each active object
+ * must have a different priority, whichever thread it is assigned to, and
+ * the priority must be less than configACTIVE_MAX_PRIORITIES.
+ *
+ * @param ppxQueueStorage An array of uxQueueLength event pointers to use as
+ * the event queue of the active object.
+ *
+ * @param uxQueueLength The number of events the queue can hold.
+ *
+ * @param pxInitial The initial pseudo state.  pxInitial is called with a NULL
+ * event and must return activeTRAN() to the first state.
+ *
+ * @return pdPASS if the active object was started, or pdFAIL if the priority
+ * is already used by another active object.  The initial
+ * transition has been taken even if pdFAIL is returned.
+ */
+BaseType_t xActiveObjectStart( ActiveObject_t * const pxAO, ActiveThreadHandle_t xThread, const UBaseType_t uxPriority, const ActiveEvent_t ** const ppxQueueStorage, const UBaseType_t uxQueueLength, ActiveStateHandler_t pxInitial ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ BaseType_t xActiveObjectPost( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+ * </pre>
+ *
+ * Post an event to the back of the queue of an active object.  Only a pointer
+ * to the event is queued, so the event must not be changed until it has been
+ * dispatched.  Never blocks.
+ *
+ * @param pxAO The active object.
+ *
+ * @param pxEvent The event to post.
+ *
+ * @return pdPASS if the event was posted, or errQUEUE_FULL if the queue of
+ * the active object was full.
+ */
+BaseType_t xActiveObjectPost( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ BaseType_t xActiveObjectPostFromISR( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent, BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * A version of xActiveObjectPost() that can be called from an interrupt
+ * service routine.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the event
+ * unblocked a thread of a priority above the interrupted task, in which case
+ * a context switch should be requested before the interrupt is exited.
+ */
+BaseType_t xActiveObjectPostFromISR( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ void vActiveObjectSubscribe( ActiveObject_t * const pxAO, ActiveSignal_t xSignal );
+ * </pre>
+ *
+ * Subscribe an active object to the events of a signal that are published
+ * with uxActivePublish().  This sets the bit of the priority of the active
+ * object in the subscribers of the signal, so the active object must have
+ * been started.  Subscribing again has no effect.
+ *
+ * @param pxAO The active object.
+ *
+ * @param xSignal The signal, which must be below
+ * configACTIVE_MAX_PUBLISHED_SIGNALS.
+ */
+void vActiveObjectSubscribe( ActiveObject_t * const pxAO, const ActiveSignal_t xSignal ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ void vActiveObjectUnsubscribe( ActiveObject_t * const pxAO, ActiveSignal_t xSignal );
+ * </pre>
+ *
+ * Remove a subscription made with vActiveObjectSubscribe().  Events of the
+ * signal already in the queue of the active object are still dispatched.
+ */
+void vActiveObjectUnsubscribe( ActiveObject_t * const pxAO, const ActiveSignal_t xSignal ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ UBaseType_t uxActivePublish( const ActiveEvent_t * const pxEvent );
+ * </pre>
+ *
+ * Post an event to every active object that has subscribed to its signal.
+ * The scheduler is suspended while the event is posted, so no subscriber
+ * starts to process the event until all the subscribers have been sent it.
+ * Must not be called from an interrupt.  Subscribers are posted the event in
+ * order of priority, highest first.  A subscriber whose queue is full
+ * does not receive the event, and holds no reference to it.
+ *
+ * @param pxEvent The event to publish.  An event from a pool is returned to
+ * the pool if no subscriber received it.
+ *
+ * @return The number of subscribers that did not receive the event because
+ * their queue was full.  0 if every subscriber received it.
+ */
+UBaseType_t uxActivePublish( const ActiveEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ BaseType_t xActiveEventPoolCreate( void * const pvStorage, UBaseType_t uxStorageSize, UBaseType_t uxEventSize );
+ * </pre>
+ *
+ * Create a pool of fixed size events in a buffer provided by the
+ * application.  Pools must be created in order of increasing event size.
+ * pxActiveEventNew() takes an event from the first pool whose events are
+ * large enough.
+ *
+ * @param pvStorage The buffer from which the events are taken.  Must be
+ * aligned to portBYTE_ALIGNMENT.
+ *
+ * @param uxStorageSize The size of pvStorage in bytes.
+ *
+ * @param uxEventSize The size of the largest event to take from the pool.
+ *
+ * @return pdPASS if the pool was created, or pdFAIL if
+ * configACTIVE_MAX_EVENT_POOLS pools already exist.
+ */
+BaseType_t xActiveEventPoolCreate( void * const pvStorage, const UBaseType_t uxStorageSize, const UBaseType_t uxEventSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ ActiveEvent_t *pxActiveEventNew( UBaseType_t uxEventSize, ActiveSignal_t xSignal );
+ * </pre>
+ *
+ * Take an event from a pool.  The event is returned with a reference count of
+ * zero, and is returned to its pool once it has been dispatched to every
+ * active object it was posted or published to.  An event that is taken but
+ * never posted must be released with vActiveEventGarbageCollect().
+ *
+ * @param uxEventSize The size of the event, including its header.
+ *
+ * @param xSignal The signal of the event.
+ *
+ * @return A pointer to the event, or NULL if the pool that holds events of
+ * that size is empty.
+ */
+ActiveEvent_t *pxActiveEventNew( const UBaseType_t uxEventSize, const ActiveSignal_t xSignal ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ ActiveEvent_t *pxActiveEventNewFromISR( UBaseType_t uxEventSize, ActiveSignal_t xSignal );
+ * </pre>
+ *
+ * A version of pxActiveEventNew() that can be called from an interrupt
+ * service routine.
+ */
+ActiveEvent_t *pxActiveEventNewFromISR( const UBaseType_t uxEventSize, const ActiveSignal_t xSignal ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ void vActiveEventGarbageCollect( const ActiveEvent_t * const pxEvent );
+ * </pre>
+ *
+ * Drop one reference to an event, and return the event to its pool if that
+ * was the last reference.  Threads call this once each dispatch is complete,
+ * so the application only needs to call it for an event that it took from a
+ * pool but did not post.  Has no effect on constant events.
+ */
+void vActiveEventGarbageCollect( const ActiveEvent_t * const pxEvent ) PRIVILEGED_FUNCTION;
+
+/**
+ * active. h
+ * <pre>
+ UBaseType_t uxActiveEventPoolGetMinimumFree( UBaseType_t uxPool );
+ * </pre>
+ *
+ * Return the smallest number of free events a pool has held since it was
+ * created, which can be used to size the pool.
+ *
+ * @param uxPool The index of the pool, in the order the pools were created.
+ */
+UBaseType_t uxActiveEventPoolGetMinimumFree( const UBaseType_t uxPool ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACTIVE_H */
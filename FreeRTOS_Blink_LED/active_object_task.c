@@ -0,0 +1,378 @@
+/*
+ * active_object_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks that events published to active objects reach every
+ * subscriber in priority order, run the hierarchical state machines as
+ * expected, and go back to their pool.
+ *
+ * vActiveObjectTask() creates one active object thread and starts two active
+ * objects in it, both subscribed to mainAO_SIG_COUNT:
+ *
+ * The high priority active object has a composite state with two substates,
+ * and moves between them on every event.  The moves are local to the
+ * composite state, so its entry action runs once while the substates are
+ * entered once per event.
+ *
+ * The low priority active object records each event it receives, and checks
+ * the high priority active object has already received it.
+ *
+ * A check task publishes a numbered event from a pool of mainAO_POOL_EVENTS
+ * events every mainAO_CHECK_PERIOD, then checks both active objects have
+ * received it.  The pool is only large enough if each event goes back to it
+ * once both dispatches are complete.
+ *
+ * A check that fails sets a bit in g_ui32ActiveErrors, and
+ * g_ui32ActiveChecks counts the completed checks.  Both can be read with the
+ * debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "active.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when active objects are included. */
+#if ( configUSE_ACTIVE_OBJECTS == 1 )
+
+/*
+ * The priorities of the check task and the active object thread, and the
+ * rate at which the check task runs.
+ */
+#define mainAO_CHECK_PRIORITY               ( tskIDLE_PRIORITY + 5 )
+#define mainAO_THREAD_PRIORITY              ( tskIDLE_PRIORITY + 5 )
+#define mainAO_CHECK_PERIOD                 ( pdMS_TO_TICKS( 100UL ) )
+#define mainAO_SETTLE_TICKS                 ( ( TickType_t ) 2 )
+
+/*
+ * The priorities of the active objects, the length of their queues, and the
+ * number of events in the pool.
+ */
+#define mainAO_LOW_PRIORITY                 ( ( UBaseType_t ) 1U )
+#define mainAO_HIGH_PRIORITY                ( ( UBaseType_t ) 2U )
+#define mainAO_QUEUE_LENGTH                 ( 2U )
+#define mainAO_POOL_EVENTS                  ( 2U )
+
+/*
+ * The published signal.
+ */
+#define mainAO_SIG_COUNT                    ( activeSIG_USER )
+
+/*
+ * Bits set in g_ui32ActiveErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_POOL_EMPTY                ( 1UL << 1UL )
+#define mainERROR_DROPPED                   ( 1UL << 2UL )
+#define mainERROR_ORDER                     ( 1UL << 3UL )
+#define mainERROR_MISSED                    ( 1UL << 4UL )
+#define mainERROR_WRONG_STATE               ( 1UL << 5UL )
+
+/*
+ * Results of the checks, written by the task and the active objects.
+ */
+volatile uint32_t g_ui32ActiveErrors = 0;
+volatile uint32_t g_ui32ActiveChecks = 0;
+
+/*
+ * An event that carries the number it was published with.
+ */
+typedef struct
+{
+    ActiveEvent_t xSuper;
+    uint32_t ui32Sequence;
+} CountEvent_t;
+
+/*
+ * The active objects.  Each declares ActiveObject_t as its first member.
+ */
+typedef struct
+{
+    ActiveObject_t xSuper;
+    volatile uint32_t ui32LastSequence;
+    volatile uint32_t ui32CompositeEntries;
+    volatile uint32_t ui32SubstateEntries;
+} CountObject_t;
+
+static CountObject_t xHighObject;
+static CountObject_t xLowObject;
+
+/*
+ * The storage of the event queues and the event pool.  The pool storage is
+ * declared as uint64_t to give it the alignment of portBYTE_ALIGNMENT.
+ */
+static const ActiveEvent_t *pxHighQueue[ mainAO_QUEUE_LENGTH ];
+static const ActiveEvent_t *pxLowQueue[ mainAO_QUEUE_LENGTH ];
+static uint64_t ui64PoolStorage[ ( ( mainAO_POOL_EVENTS * sizeof( CountEvent_t ) ) + sizeof( uint64_t ) - 1U ) / sizeof( uint64_t ) ];
+
+/*
+ * The check task and the states of the active objects, as described in the
+ * comments at the top of this file.
+ */
+static void prvActiveObjectCheckTask( void *pvParameters );
+static BaseType_t prvHighInitial( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+static BaseType_t prvHighCounting( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+static BaseType_t prvHighEven( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+static BaseType_t prvHighOdd( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+static BaseType_t prvLowInitial( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+static BaseType_t prvLowCounting( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent );
+
+/*
+ * Called by main() to create the task, the thread and the active objects.
+ */
+void vActiveObjectTask( void );
+/*-----------------------------------------------------------*/
+
+void vActiveObjectTask( void )
+{
+ActiveThreadHandle_t xThread;
+
+    xThread = xActiveThreadCreate( "AOThr", configMINIMAL_STACK_SIZE, mainAO_THREAD_PRIORITY );
+
+    if( ( xThread == NULL ) ||
+        ( xActiveEventPoolCreate( ui64PoolStorage, sizeof( ui64PoolStorage ), sizeof( CountEvent_t ) ) != pdPASS ) ||
+        ( xActiveObjectStart( &( xHighObject.xSuper ), xThread, mainAO_HIGH_PRIORITY, pxHighQueue, mainAO_QUEUE_LENGTH, prvHighInitial ) != pdPASS ) ||
+        ( xActiveObjectStart( &( xLowObject.xSuper ), xThread, mainAO_LOW_PRIORITY, pxLowQueue, mainAO_QUEUE_LENGTH, prvLowInitial ) != pdPASS ) )
+    {
+        g_ui32ActiveErrors |= mainERROR_CREATE;
+    }
+    else
+    {
+        vActiveObjectSubscribe( &( xHighObject.xSuper ), mainAO_SIG_COUNT );
+        vActiveObjectSubscribe( &( xLowObject.xSuper ), mainAO_SIG_COUNT );
+    }
+
+    if( xTaskCreate( prvActiveObjectCheckTask,
+                     "AOChk",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainAO_CHECK_PRIORITY,
+                     NULL ) != pdPASS )
+    {
+        g_ui32ActiveErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvActiveObjectCheckTask( void *pvParameters )
+{
+TickType_t xLastWakeTime;
+CountEvent_t *pxEvent;
+uint32_t ui32Sequence = 0;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainAO_CHECK_PERIOD );
+
+        pxEvent = ( CountEvent_t * ) pxActiveEventNew( sizeof( CountEvent_t ), mainAO_SIG_COUNT );
+
+        if( pxEvent == NULL )
+        {
+            g_ui32ActiveErrors |= mainERROR_POOL_EMPTY;
+            continue;
+        }
+
+        ui32Sequence++;
+        pxEvent->ui32Sequence = ui32Sequence;
+
+        if( uxActivePublish( &( pxEvent->xSuper ) ) != ( UBaseType_t ) 0U )
+        {
+            g_ui32ActiveErrors |= mainERROR_DROPPED;
+        }
+
+        vTaskDelay( mainAO_SETTLE_TICKS );
+
+        if( ( xHighObject.ui32LastSequence != ui32Sequence ) ||
+            ( xLowObject.ui32LastSequence != ui32Sequence ) )
+        {
+            g_ui32ActiveErrors |= mainERROR_MISSED;
+        }
+
+        /* The composite state is only entered by the initial transition. */
+        if( ( xHighObject.ui32CompositeEntries != 1UL ) ||
+            ( xHighObject.ui32SubstateEntries != ( ui32Sequence + 1UL ) ) )
+        {
+            g_ui32ActiveErrors |= mainERROR_WRONG_STATE;
+        }
+
+        g_ui32ActiveChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvHighInitial( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+    ( void ) pxEvent;
+
+    return activeTRAN( pxAO, prvHighCounting );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvHighCounting( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+CountObject_t * const pxCounter = ( CountObject_t * ) pxAO;
+BaseType_t xReturn;
+
+    switch( pxEvent->xSignal )
+    {
+        case activeSIG_ENTRY:
+            pxCounter->ui32CompositeEntries++;
+            xReturn = activeHANDLED();
+            break;
+
+        case activeSIG_INIT:
+            xReturn = activeTRAN( pxAO, prvHighEven );
+            break;
+
+
+        default:
+            xReturn = activeSUPER( pxAO, xActiveTop );
+            break;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvHighEven( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+CountObject_t * const pxCounter = ( CountObject_t * ) pxAO;
+BaseType_t xReturn;
+
+    switch( pxEvent->xSignal )
+    {
+        case activeSIG_ENTRY:
+            pxCounter->ui32SubstateEntries++;
+            xReturn = activeHANDLED();
+            break;
+
+        case mainAO_SIG_COUNT:
+            /* An even number of events have been received, so this one is
+            odd numbered. */
+            if( ( ( ( const CountEvent_t * ) pxEvent )->ui32Sequence & 1UL ) == 0UL )
+            {
+                g_ui32ActiveErrors |= mainERROR_WRONG_STATE;
+            }
+
+            pxCounter->ui32LastSequence = ( ( const CountEvent_t * ) pxEvent )->ui32Sequence;
+            xReturn = activeTRAN( pxAO, prvHighOdd );
+            break;
+
+        default:
+            xReturn = activeSUPER( pxAO, prvHighCounting );
+            break;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvHighOdd( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+CountObject_t * const pxCounter = ( CountObject_t * ) pxAO;
+BaseType_t xReturn;
+
+    switch( pxEvent->xSignal )
+    {
+        case activeSIG_ENTRY:
+            pxCounter->ui32SubstateEntries++;
+            xReturn = activeHANDLED();
+            break;
+
+        case mainAO_SIG_COUNT:
+            if( ( ( ( const CountEvent_t * ) pxEvent )->ui32Sequence & 1UL ) != 0UL )
+            {
+                g_ui32ActiveErrors |= mainERROR_WRONG_STATE;
+            }
+
+            pxCounter->ui32LastSequence = ( ( const CountEvent_t * ) pxEvent )->ui32Sequence;
+            xReturn = activeTRAN( pxAO, prvHighEven );
+            break;
+
+        default:
+            xReturn = activeSUPER( pxAO, prvHighCounting );
+            break;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvLowInitial( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+    ( void ) pxEvent;
+
+    return activeTRAN( pxAO, prvLowCounting );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvLowCounting( ActiveObject_t * const pxAO, const ActiveEvent_t * const pxEvent )
+{
+CountObject_t * const pxCounter = ( CountObject_t * ) pxAO;
+BaseType_t xReturn;
+
+    switch( pxEvent->xSignal )
+    {
+        case mainAO_SIG_COUNT:
+            if( xHighObject.ui32LastSequence != ( ( const CountEvent_t * ) pxEvent )->ui32Sequence )
+            {
+                g_ui32ActiveErrors |= mainERROR_ORDER;
+            }
+
+            pxCounter->ui32LastSequence = ( ( const CountEvent_t * ) pxEvent )->ui32Sequence;
+            xReturn = activeHANDLED();
+            break;
+
+        default:
+            xReturn = activeSUPER( pxAO, xActiveTop );
+            break;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_ACTIVE_OBJECTS */
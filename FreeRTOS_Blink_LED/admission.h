@@ -0,0 +1,208 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include admission.h"
+#endif
+
+/******************************************************************************
+ *
+ * Admission control for periodic tasks.
+ *
+ * Periodic tasks created with xAdmissionTaskCreate() declare a period, a
+ * worst case execution time (WCET) and a relative deadline.  Before the task
+ * is created the whole set of admitted tasks, including the new one, is
+ * analysed, and the task is only created if every task in the set will still
+ * meet its deadline.  This lets tasks that are added by configuration in the
+ * field be checked when they are added rather than when they first miss a
+ * deadline.
+ *
+ * Fixed priority tasks are checked with exact response time analysis.  Each
+ * task is assumed to be interfered with by every admitted task of the same or
+ * a higher priority, which is exact for distinct priorities and conservative
+ * for tasks that share a priority by time slicing.  When
+ * configUSE_EDF_SCHEDULING is 1 the tasks of priority configEDF_TASK_PRIORITY
+ * are checked together with a density bound - the sum of C / min( D, T ) over
+ * the deadline scheduled tasks, plus the utilisation of the admitted tasks of
+ * a higher priority, must not exceed one.
+ *
+ * When configUSE_TIMING_MONITOR is 1 the execution times measured by the
+ * kernel are fed back into the analysis.  Each time the analysis runs, the
+ * WCET of every admitted task is raised to the largest execution time that
+ * has been measured for it, so the analysis tracks the real behaviour of the
+ * tasks.  xAdmissionCheck() repeats the analysis on demand.
+ *
+ * Only tasks created through this interface are analysed.  Interrupts, and
+ * tasks that are not periodic, must be allowed for in the WCET figures.
+ *
+ * Set configUSE_ADMISSION_CONTROL to 1 in FreeRTOSConfig.h to include
+ * admission control.  configADMISSION_MAX_TASKS sets the number of periodic
+ * tasks that can be admitted.
+ *
+ *****************************************************************************/
+
+#ifndef configUSE_ADMISSION_CONTROL
+	#define configUSE_ADMISSION_CONTROL 0
+#endif
+
+#ifndef configADMISSION_MAX_TASKS
+	#define configADMISSION_MAX_TASKS 8
+#endif
+
+/* Returned by xAdmissionTaskCreate() if the task would make the set of
+admitted tasks unschedulable, and by xAdmissionCheck() if the set is no longer
+schedulable. */
+#define errADMISSION_REJECTED	( -6 )
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * admission. h
+ * <pre>
+ BaseType_t xAdmissionTaskCreate(
+								TaskFunction_t pvTaskCode,
+								const char * const pcName,
+								uint16_t usStackDepth,
+								void *pvParameters,
+								UBaseType_t uxPriority,
+								TickType_t xPeriod,
+								uint32_t ulWcetCycles,
+								TickType_t xRelativeDeadline,
+								TaskHandle_t *pvCreatedTask
+							);
+ * </pre>
+ *
+ * Create a periodic task if the set of admitted tasks remains schedulable
+ * with it added.  The first six parameters are as for xTaskCreate().  The task
+ * itself must call vTaskDelayUntil() with a time increment of xPeriod at the
+ * end of each period.
+ *
+ * If the task is created at configEDF_TASK_PRIORITY it is given the relative
+ * deadline xRelativeDeadline, as if by xTaskDeadlineSet().
+ *
+ * @param xPeriod The period of the task in ticks.
+ *
+ * @param ulWcetCycles An estimate of the worst case execution time of each
+ * period, in CPU cycles.
+ *
+ * @param xRelativeDeadline The deadline of each period, relative to its
+ * release, in ticks.  Passing 0 sets the deadline equal to the period.  The
+ * deadline must not be longer than the period.
+ *
+ * @param pvCreatedTask Used to pass back a handle by which the created task
+ * can be referenced.
+ *
+ * @return pdPASS if the task was admitted and created, errADMISSION_REJECTED
+ * if it would make the task set unschedulable, configADMISSION_MAX_TASKS
+ * tasks have already been admitted or the task could not be given its
+ * deadline, or errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY if the task could not
+ * be created.
+ */
+BaseType_t xAdmissionTaskCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, const TickType_t xPeriod, const uint32_t ulWcetCycles, const TickType_t xRelativeDeadline, TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/**
+ * admission. h
+ * <pre>
+ void vAdmissionTaskRemove( TaskHandle_t xTask );
+ * </pre>
+ *
+ * Remove a task from the set of admitted tasks, releasing the capacity it
+ * was given.  Must be called before a task created by xAdmissionTaskCreate()
+ * is deleted.
+ *
+ * @param xTask The handle of the task to remove.
+ */
+void vAdmissionTaskRemove( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * admission. h
+ * <pre>
+ BaseType_t xAdmissionCheck( void );
+ * </pre>
+ *
+ * Repeat the analysis of the admitted tasks using the latest measured
+ * execution times.  Can be called periodically, for example from a low
+ * priority monitoring task, to detect a task set that no longer meets its
+ * deadlines because the execution times have grown beyond the estimates.
+ *
+ * @return pdPASS if every admitted task still meets its deadline, otherwise
+ * errADMISSION_REJECTED.
+ */
+BaseType_t xAdmissionCheck( void ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADMISSION_H */
@@ -0,0 +1,234 @@
+/*
+ * basic_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks that basic tasks run to completion on the shared stack,
+ * nest when a higher priority basic task is activated, and wait for a basic
+ * task of the same priority to complete rather than sharing the processor.
+ *
+ * vBasicTask() creates three basic tasks.  A check task activates the outer
+ * basic task every mainBASIC_CHECK_PERIOD.  The outer basic task activates
+ * the inner basic task, which has a higher priority so must run to
+ * completion before vTaskActivate() returns, on the shared stack below the
+ * outer basic task.  The outer basic task then activates the equal basic
+ * task, which has the same priority, mainBASIC_EQUAL_ACTIVATIONS times.  The
+ * equal basic task must not start until the outer basic task has completed,
+ * and must then run once for each activation.
+ *
+ * A check that fails sets a bit in g_ui32BasicErrors, and g_ui32BasicChecks
+ * counts the completed checks.  Both can be read with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when basic tasks are included. */
+#if ( configUSE_BASIC_TASKS == 1 )
+
+/*
+ * The priorities of the check task and the basic tasks, and the rate at which
+ * the check task runs.
+ */
+#define mainBASIC_CHECK_PRIORITY            ( tskIDLE_PRIORITY + 5 )
+#define mainBASIC_OUTER_PRIORITY            ( tskIDLE_PRIORITY + 6 )
+#define mainBASIC_INNER_PRIORITY            ( tskIDLE_PRIORITY + 7 )
+#define mainBASIC_CHECK_PERIOD              ( pdMS_TO_TICKS( 100UL ) )
+
+/*
+ * The number of times the outer basic task activates the equal basic task.
+ */
+#define mainBASIC_EQUAL_ACTIVATIONS         ( 2UL )
+
+/*
+ * Bits set in g_ui32BasicErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_NOT_NESTED                ( 1UL << 1UL )
+#define mainERROR_WRONG_STACK               ( 1UL << 2UL )
+#define mainERROR_EQUAL_STARTED             ( 1UL << 3UL )
+#define mainERROR_MISSED                    ( 1UL << 4UL )
+
+/*
+ * Results of the checks, written by the task and the basic tasks.
+ */
+volatile uint32_t g_ui32BasicErrors = 0;
+volatile uint32_t g_ui32BasicChecks = 0;
+volatile uint32_t g_ui32BasicOuterRuns = 0;
+volatile uint32_t g_ui32BasicInnerRuns = 0;
+volatile uint32_t g_ui32BasicEqualRuns = 0;
+
+/*
+ * The basic tasks, and the address of a local variable of the outer basic
+ * task, which shows where it is on the shared stack.
+ */
+static TaskHandle_t xOuterTask = NULL;
+static TaskHandle_t xInnerTask = NULL;
+static TaskHandle_t xEqualTask = NULL;
+static volatile uintptr_t uxOuterStackAddress = 0;
+
+/*
+ * The check task and the basic tasks as described in the comments at the top
+ * of this file.
+ */
+static void prvBasicCheckTask( void *pvParameters );
+static void prvOuterBasicTask( void *pvParameters );
+static void prvInnerBasicTask( void *pvParameters );
+static void prvEqualBasicTask( void *pvParameters );
+
+/*
+ * Called by main() to create the tasks.
+ */
+void vBasicTask( void );
+/*-----------------------------------------------------------*/
+
+void vBasicTask( void )
+{
+    if( ( xTaskCreateBasic( prvOuterBasicTask, "BasOut", NULL, mainBASIC_OUTER_PRIORITY, &xOuterTask ) != pdPASS ) ||
+        ( xTaskCreateBasic( prvInnerBasicTask, "BasIn", NULL, mainBASIC_INNER_PRIORITY, &xInnerTask ) != pdPASS ) ||
+        ( xTaskCreateBasic( prvEqualBasicTask, "BasEq", NULL, mainBASIC_OUTER_PRIORITY, &xEqualTask ) != pdPASS ) ||
+        ( xTaskCreate( prvBasicCheckTask,
+                       "BasChk",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainBASIC_CHECK_PRIORITY,
+                       NULL ) != pdPASS ) )
+    {
+        g_ui32BasicErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvBasicCheckTask( void *pvParameters )
+{
+TickType_t xLastWakeTime;
+uint32_t ui32Activations = 0;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainBASIC_CHECK_PERIOD );
+
+        /* Every basic task has a priority above this task, so all of them
+        have completed by the time vTaskActivate() returns. */
+        vTaskActivate( xOuterTask );
+        ui32Activations++;
+
+        if( ( g_ui32BasicOuterRuns != ui32Activations ) ||
+            ( g_ui32BasicInnerRuns != ui32Activations ) ||
+            ( g_ui32BasicEqualRuns != ( ui32Activations * mainBASIC_EQUAL_ACTIVATIONS ) ) )
+        {
+            g_ui32BasicErrors |= mainERROR_MISSED;
+        }
+
+        g_ui32BasicChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvOuterBasicTask( void *pvParameters )
+{
+uint32_t ui32Runs, ui32Activation;
+
+    ( void ) pvParameters;
+
+    uxOuterStackAddress = ( uintptr_t ) &ui32Runs;
+
+    /* The inner basic task preempts this one, so has run by the time
+    vTaskActivate() returns. */
+    ui32Runs = g_ui32BasicInnerRuns;
+    vTaskActivate( xInnerTask );
+
+    if( g_ui32BasicInnerRuns != ( ui32Runs + 1UL ) )
+    {
+        g_ui32BasicErrors |= mainERROR_NOT_NESTED;
+    }
+
+    /* The equal basic task cannot start on top of this one, so does not run
+    until this one has returned, then runs once for each activation. */
+    ui32Runs = g_ui32BasicEqualRuns;
+
+    for( ui32Activation = 0; ui32Activation < mainBASIC_EQUAL_ACTIVATIONS; ui32Activation++ )
+    {
+        vTaskActivate( xEqualTask );
+        taskYIELD();
+    }
+
+    if( g_ui32BasicEqualRuns != ui32Runs )
+    {
+        g_ui32BasicErrors |= mainERROR_EQUAL_STARTED;
+    }
+
+    g_ui32BasicOuterRuns++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInnerBasicTask( void *pvParameters )
+{
+uint32_t ui32Local;
+
+    ( void ) pvParameters;
+
+    /* The stack grows down, and this task starts below the saved context of
+    the outer basic task it preempted. */
+    if( ( uintptr_t ) &ui32Local >= uxOuterStackAddress )
+    {
+        g_ui32BasicErrors |= mainERROR_WRONG_STACK;
+    }
+
+    g_ui32BasicInnerRuns++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEqualBasicTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    g_ui32BasicEqualRuns++;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_BASIC_TASKS */
@@ -0,0 +1,219 @@
+/*
+ * budget_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the execution budgets set with vTaskBudgetSet().
+ *
+ * vBudgetTask() creates two tasks that never block, each with a budget of
+ * mainBUDGET_CYCLES in every mainBUDGET_PERIOD.  One is demoted when its
+ * budget is exhausted and the other is suspended.  Without the budgets they
+ * would use all the processor time left by the tasks above them.  A task of a
+ * lower priority counts the times it runs, and a check task above all of them
+ * checks that both budgets keep being exhausted and that the lower priority
+ * task keeps running.
+ *
+ * A check that fails sets a bit in g_ui32BudgetErrors, and g_ui32BudgetChecks
+ * counts the completed checks.  Both can be read with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when task budgets are included. */
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+/*
+ * Priorities at which the tasks are created.  The tasks with a budget are
+ * below the deadline scheduled tasks so they cannot delay them.
+ */
+#define mainBUDGET_LOW_PRIORITY             ( tskIDLE_PRIORITY + 2 )
+#define mainBUDGET_BUSY_PRIORITY            ( tskIDLE_PRIORITY + 3 )
+#define mainBUDGET_CHECK_PRIORITY           ( tskIDLE_PRIORITY + 5 )
+
+/*
+ * The budget of each busy task, 2ms of processor time in every 20ms.
+ */
+#define mainBUDGET_CYCLES                   ( configCPU_CLOCK_HZ / 500UL )
+#define mainBUDGET_PERIOD                   ( pdMS_TO_TICKS( 20UL ) )
+
+/*
+ * The rate at which the check task runs.
+ */
+#define mainBUDGET_CHECK_PERIOD             ( pdMS_TO_TICKS( 100UL ) )
+
+/*
+ * Bits set in g_ui32BudgetErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_NOT_ENFORCED              ( 1UL << 1UL )
+#define mainERROR_LOW_STARVED               ( 1UL << 2UL )
+
+/*
+ * Results of the checks, written by the tasks.
+ */
+volatile uint32_t g_ui32BudgetErrors = 0;
+volatile uint32_t g_ui32BudgetChecks = 0;
+volatile uint32_t g_ui32BudgetLowRuns = 0;
+
+/*
+ * The tasks that have a budget.
+ */
+static TaskHandle_t xDemotedTask = NULL;
+static TaskHandle_t xSuspendedTask = NULL;
+
+/*
+ * The tasks as described in the comments at the top of this file.
+ */
+static void prvBudgetCheckTask( void *pvParameters );
+static void prvBusyTask( void *pvParameters );
+static void prvLowTask( void *pvParameters );
+
+/*
+ * Called by main() to create the tasks.
+ */
+void vBudgetTask( void );
+/*-----------------------------------------------------------*/
+
+void vBudgetTask( void )
+{
+    if( ( xTaskCreate( prvBusyTask,
+                       "BudDem",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainBUDGET_BUSY_PRIORITY,
+                       &xDemotedTask ) != pdPASS ) ||
+        ( xTaskCreate( prvBusyTask,
+                       "BudSus",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainBUDGET_BUSY_PRIORITY,
+                       &xSuspendedTask ) != pdPASS ) ||
+        ( xTaskCreate( prvLowTask,
+                       "BudLow",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainBUDGET_LOW_PRIORITY,
+                       NULL ) != pdPASS ) ||
+        ( xTaskCreate( prvBudgetCheckTask,
+                       "BudChk",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainBUDGET_CHECK_PRIORITY,
+                       NULL ) != pdPASS ) )
+    {
+        g_ui32BudgetErrors |= mainERROR_CREATE;
+    }
+    else
+    {
+        vTaskBudgetSet( xDemotedTask, mainBUDGET_CYCLES, mainBUDGET_PERIOD, eBudgetDemote );
+        vTaskBudgetSet( xSuspendedTask, mainBUDGET_CYCLES, mainBUDGET_PERIOD, eBudgetSuspend );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvBudgetCheckTask( void *pvParameters )
+{
+TaskBudgetStatus_t xDemotedStatus, xSuspendedStatus;
+uint32_t ui32LastDemoted = 0, ui32LastSuspended = 0, ui32LastLowRuns = 0;
+TickType_t xLastWakeTime;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainBUDGET_CHECK_PERIOD );
+
+        /* Both busy tasks use up their budget in every replenishment
+        period. */
+        vTaskBudgetGetStatus( xDemotedTask, &xDemotedStatus );
+        vTaskBudgetGetStatus( xSuspendedTask, &xSuspendedStatus );
+
+        if( ( xDemotedStatus.ulExhaustions == ui32LastDemoted ) ||
+            ( xSuspendedStatus.ulExhaustions == ui32LastSuspended ) )
+        {
+            g_ui32BudgetErrors |= mainERROR_NOT_ENFORCED;
+        }
+
+        /* The lower priority task only runs because the busy tasks are held
+        to their budgets. */
+        if( g_ui32BudgetLowRuns == ui32LastLowRuns )
+        {
+            g_ui32BudgetErrors |= mainERROR_LOW_STARVED;
+        }
+
+        ui32LastDemoted = xDemotedStatus.ulExhaustions;
+        ui32LastSuspended = xSuspendedStatus.ulExhaustions;
+        ui32LastLowRuns = g_ui32BudgetLowRuns;
+
+        g_ui32BudgetChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvBusyTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        /* Never block, so the task always uses all of its budget. */
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvLowTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        vTaskDelay( pdMS_TO_TICKS( 5UL ) );
+        g_ui32BudgetLowRuns++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TASK_BUDGETS == 1 */
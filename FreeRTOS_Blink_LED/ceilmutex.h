@@ -0,0 +1,203 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef CEILMUTEX_H
+#define CEILMUTEX_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include ceilmutex.h"
+#endif
+
+#include "task_ext.h"
+
+#if ( configUSE_CEILING_MUTEXES == 1 )
+	#if ( configUSE_MUTEXES != 1 )
+		#error configUSE_MUTEXES must be set to 1 in FreeRTOSConfig.h to use priority ceiling mutexes, as the ceiling is held as the base priority of the holder.
+	#endif
+
+	#if ( INCLUDE_uxTaskPriorityGet != 1 )
+		#error INCLUDE_uxTaskPriorityGet must be set to 1 in FreeRTOSConfig.h to use priority ceiling mutexes.
+	#endif
+#endif
+
+/******************************************************************************
+ *
+ * Priority ceiling mutexes.
+ *
+ * A priority ceiling mutex is created with a fixed ceiling priority, which
+ * must be at least the priority of every task that uses the mutex.  A task
+ * that takes the mutex has its priority raised to the ceiling immediately,
+ * rather than only when another task blocks on the mutex as happens with
+ * priority inheritance.  No other task that uses the mutex can then run until
+ * the mutex is given back and the priority restored, so the mutex is never
+ * found held and a take never blocks, and the context switches and list
+ * operations of priority inheritance are avoided entirely.
+ *
+ * This only holds if the following rules are kept:
+ *
+ * + A task must not block while it holds a ceiling mutex.
+ *
+ * + The ceiling must be at least the priority of every task that uses the
+ *   mutex.  Passing the tasks to xCeilingMutexCreate() checks this when the
+ *   mutex is created, and every take checks it again for the calling task.
+ *
+ * Ceiling mutexes can be nested, including a mutex with a lower ceiling
+ * inside one with a higher ceiling, and can be given back in any order.  The
+ * holder runs at the highest ceiling of the mutexes it still holds.
+ *
+ * If tasks that use the mutex share the ceiling priority, time slicing can
+ * switch between them while the mutex is held.  A task that finds the mutex
+ * held in that case, or because the first rule was broken, blocks until the
+ * holder has given it back.
+ *
+ * Ceiling mutexes cannot be used from interrupts.
+ *
+ * Set configUSE_CEILING_MUTEXES to 1 in FreeRTOSConfig.h to use priority
+ * ceiling mutexes.
+ *
+ *****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which priority ceiling mutexes are referenced.
+ */
+typedef void * CeilingMutexHandle_t;
+
+/**
+ * ceilmutex. h
+ * <pre>
+ CeilingMutexHandle_t xCeilingMutexCreate( UBaseType_t uxCeilingPriority, const TaskHandle_t *pxUserTasks, UBaseType_t uxNumberOfUserTasks );
+ * </pre>
+ *
+ * Creates a new priority ceiling mutex.
+ *
+ * @param uxCeilingPriority The priority a task runs at while it holds the
+ * mutex.  Must be less than configMAX_PRIORITIES.
+ *
+ * @param pxUserTasks An array holding the handles of the tasks that will use
+ * the mutex.  The mutex is not created if any of the tasks has a base
+ * priority, as returned by uxTaskBasePriorityGet(), above uxCeilingPriority.
+ * Can be NULL if the tasks have not been created yet, in which case the
+ * ceiling is only checked by each take.
+ *
+ * @param uxNumberOfUserTasks The number of handles in pxUserTasks.
+ *
+ * @return A handle to the created mutex, or NULL if the ceiling is not valid
+ * or the mutex could not be created.
+ */
+CeilingMutexHandle_t xCeilingMutexCreate( UBaseType_t uxCeilingPriority, const TaskHandle_t * const pxUserTasks, UBaseType_t uxNumberOfUserTasks ) PRIVILEGED_FUNCTION;
+
+/**
+ * ceilmutex. h
+ * <pre>
+ void vCeilingMutexTake( CeilingMutexHandle_t xMutex );
+ * </pre>
+ *
+ * Take a priority ceiling mutex, raising the priority of the calling task to
+ * the ceiling of the mutex.  There is no block time as the mutex is only
+ * found held by another task that shares the ceiling priority.
+ *
+ * @param xMutex The handle of the mutex to take.
+ */
+void vCeilingMutexTake( CeilingMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * ceilmutex. h
+ * <pre>
+ void vCeilingMutexGive( CeilingMutexHandle_t xMutex );
+ * </pre>
+ *
+ * Give a priority ceiling mutex back, lowering the priority of the calling
+ * task to the highest ceiling of the mutexes it still holds, or to the
+ * priority it had before it took any.  If a task of higher priority became
+ * ready while the mutex was held the calling task yields to it here.
+ *
+ * @param xMutex The handle of the mutex to give.
+ */
+void vCeilingMutexGive( CeilingMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * ceilmutex. h
+ * <pre>
+ void vCeilingMutexDelete( CeilingMutexHandle_t xMutex );
+ * </pre>
+ *
+ * Delete a priority ceiling mutex.  The mutex must not be held when it is
+ * deleted.
+ */
+void vCeilingMutexDelete( CeilingMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CEILMUTEX_H */
@@ -0,0 +1,197 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef CHANNEL_H
+#define CHANNEL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include channel.h"
+#endif
+
+#include "task_ext.h"
+
+/******************************************************************************
+ *
+ * Unbuffered (rendezvous) channels.
+ *
+ * A channel passes items of a fixed size from one task to another without
+ * holding any storage of its own.  A task that sends to a channel blocks until
+ * a receiving task takes the item, and a task that receives from a channel
+ * blocks until a sending task provides one.  When the second party arrives
+ * the item is copied once, directly between the buffers of the two tasks,
+ * rather than once into and once out of a queue storage area.
+ *
+ * Tasks blocked on a channel are held in priority order, so the highest
+ * priority waiting sender or receiver is always the one that completes the
+ * transfer.  Channels can only be used from tasks - there is no interrupt
+ * safe API as an interrupt cannot wait for the other party to arrive.
+ *
+ * Set configUSE_CHANNELS to 1 in FreeRTOSConfig.h to use channels.
+ *
+ *****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which channels are referenced.  For example, a call to
+ * xChannelCreate() returns a ChannelHandle_t variable that can then be used
+ * as a parameter to xChannelSend(), xChannelReceive(), etc.
+ */
+typedef void * ChannelHandle_t;
+
+/**
+ * channel. h
+ * <pre>
+ ChannelHandle_t xChannelCreate( UBaseType_t uxItemSize );
+ * </pre>
+ *
+ * Creates a new channel instance.  Only the channel control structure is
+ * allocated - a channel has no storage area.
+ *
+ * @param uxItemSize The number of bytes each item passed through the channel
+ * requires.  An item size of 0 creates a pure synchronisation channel, in
+ * which case NULL can be passed as the item pointer to xChannelSend() and
+ * xChannelReceive().
+ *
+ * @return If the channel is successfully created then a handle to the newly
+ * created channel is returned.  If the channel cannot be created then NULL is
+ * returned.
+ */
+ChannelHandle_t xChannelCreate( const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * channel. h
+ * <pre>
+ BaseType_t xChannelSend( ChannelHandle_t xChannel, const void *pvItemToSend, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Pass an item to a task that is receiving from the channel.  If a task is
+ * already blocked in xChannelReceive() the item is copied straight into that
+ * task's buffer and the receiving task is unblocked.  Otherwise the calling
+ * task blocks, for up to xTicksToWait ticks, until a receiving task arrives
+ * and copies the item straight out of pvItemToSend.
+ *
+ * @param xChannel The handle of the channel to send to.
+ *
+ * @param pvItemToSend A pointer to the item to send.  The item must remain
+ * valid until the function returns.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a receiver.  The call will return immediately if this is set to
+ * 0 and no task is already waiting to receive.
+ *
+ * @return pdPASS if the item was taken by a receiver, otherwise pdFAIL.
+ */
+BaseType_t xChannelSend( ChannelHandle_t xChannel, const void * const pvItemToSend, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * channel. h
+ * <pre>
+ BaseType_t xChannelReceive( ChannelHandle_t xChannel, void *pvBuffer, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Receive an item from a task that is sending to the channel.  If a task is
+ * already blocked in xChannelSend() its item is copied straight into pvBuffer
+ * and the sending task is unblocked.  Otherwise the calling task blocks, for
+ * up to xTicksToWait ticks, until a sending task arrives and copies its item
+ * straight into pvBuffer.
+ *
+ * @param xChannel The handle of the channel to receive from.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received item will be
+ * copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a sender.  The call will return immediately if this is set to 0
+ * and no task is already waiting to send.
+ *
+ * @return pdPASS if an item was received, otherwise pdFAIL.
+ */
+BaseType_t xChannelReceive( ChannelHandle_t xChannel, void * const pvBuffer, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * channel. h
+ * <pre>
+ void vChannelDelete( ChannelHandle_t xChannel );
+ * </pre>
+ *
+ * Delete a channel, freeing the memory allocated to it.  No task may be
+ * blocked on the channel when it is deleted.
+ *
+ * @param xChannel The handle of the channel to delete.
+ */
+void vChannelDelete( ChannelHandle_t xChannel ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHANNEL_H */
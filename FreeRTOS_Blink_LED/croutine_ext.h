@@ -0,0 +1,221 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef CROUTINE_EXT_H
+#define CROUTINE_EXT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include croutine_ext.h"
+#endif
+
+#include "croutine.h"
+
+/******************************************************************************
+ *
+ * Extensions to the co-routine API that are built into the copy of croutine.c
+ * held in this project.  The croutine.h header used by the build comes from
+ * the TivaWare installation, so the configuration of the additional features
+ * is kept here rather than in croutine.h.
+ *
+ *****************************************************************************/
+
+/* Set configUSE_EVENT_DRIVEN_CO_ROUTINES to 1 in FreeRTOSConfig.h to run the
+co-routines from a task that only runs while a co-routine is ready, rather
+than by calling vCoRoutineSchedule() from the idle hook, and to make the cost
+of scheduling independent of the number of co-routines.
+
+The task is created by xCoRoutineCreateSchedulerTask().  Whenever an event,
+a notification or a timeout readies a co-routine the task is notified, and it
+otherwise blocks until the wake time of the first delayed co-routine.  The
+ready priorities are held in a bitmap, and the delayed co-routines in a binary
+heap ordered by wake time, so finding the next co-routine to run and adding or
+removing a delayed co-routine are bounded by the number of priorities and the
+depth of the heap.  The heap is sized by configMAX_CO_ROUTINES, which is the
+most co-routines that can be created.
+
+Co-routines can also wait on the same queues and semaphores as tasks.  The
+event list items of co-routines are marked with corEVENT_LIST_ITEM_FLAG, which
+orders them after any waiting task, and xTaskRemoveFromEventList() and
+xCoRoutineRemoveFromEventList() each hand an event on to the other when the
+first waiter is not of their own kind.  Co-routines must not wait on mutexes,
+as priority inheritance only applies to tasks.
+
+Each co-routine also has a notification count, which it can wait on with
+crNOTIFY_TAKE() and which tasks, interrupts and other co-routines increment
+with vCoRoutineNotifyGive() or vCoRoutineNotifyGiveFromISR(). */
+#ifndef configUSE_EVENT_DRIVEN_CO_ROUTINES
+	#define configUSE_EVENT_DRIVEN_CO_ROUTINES 0
+#endif
+
+#ifndef configMAX_CO_ROUTINES
+	#define configMAX_CO_ROUTINES 8
+#endif
+
+#if ( ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 ) && ( configMAX_CO_ROUTINE_PRIORITIES > 32 ) )
+	#error configMAX_CO_ROUTINE_PRIORITIES must not be above 32 when configUSE_EVENT_DRIVEN_CO_ROUTINES is 1.
+#endif
+
+#if ( ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TASK_NOTIFICATIONS must be 1 when configUSE_EVENT_DRIVEN_CO_ROUTINES is 1.
+#endif
+
+/* Set in the event list item value of every co-routine.  The top bit is left
+for taskEVENT_LIST_ITEM_VALUE_IN_USE. */
+#define corEVENT_LIST_ITEM_FLAG		( ( TickType_t ) 1U << ( ( sizeof( TickType_t ) * ( size_t ) 8U ) - ( size_t ) 2U ) )
+
+#if ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 )
+
+	/**
+	 * croutine_ext. h
+	 * <pre>BaseType_t xCoRoutineCreateSchedulerTask( UBaseType_t uxPriority, uint16_t usStackDepth );</pre>
+	 *
+	 * Create the task that runs the co-routines.  Call once, before or after
+	 * the co-routines are created, and do not also call vCoRoutineSchedule()
+	 * from the idle hook.  All the co-routines run at uxPriority, and share
+	 * the stack of this task.
+	 *
+	 * @param uxPriority The priority of the task that runs the co-routines.
+	 *
+	 * @param usStackDepth The size of its stack, in words.
+	 *
+	 * @return pdPASS if the task was created, otherwise an error code as
+	 * returned by xTaskCreate().
+	 */
+	BaseType_t xCoRoutineCreateSchedulerTask( UBaseType_t uxPriority, uint16_t usStackDepth );
+
+	/**
+	 * croutine_ext. h
+	 * <pre>crNOTIFY_TAKE( CoRoutineHandle_t xHandle, BaseType_t xClearCountOnExit, TickType_t xTicksToWait, uint32_t *pulNotificationValue, BaseType_t *pxResult )</pre>
+	 *
+	 * The co-routine version of ulTaskNotifyTake().  Like the other crXXX
+	 * macros it can only be called from the co-routine function itself, not
+	 * from a function it calls.
+	 *
+	 * If the notification count of the calling co-routine is 0 it blocks for
+	 * up to xTicksToWait ticks for it to be incremented.  Then, if the count is
+	 * not 0, it is either cleared or decremented depending on
+	 * xClearCountOnExit.
+	 *
+	 * @param xHandle The handle of the calling co-routine.  This is the xHandle
+	 * parameter of the co-routine function.
+	 *
+	 * @param xClearCountOnExit pdTRUE to clear the count to 0, pdFALSE to
+	 * decrement it.
+	 *
+	 * @param xTicksToWait The most ticks to block for.
+	 *
+	 * @param pulNotificationValue Set to the count before it was cleared or
+	 * decremented.
+	 *
+	 * @param pxResult Set to pdPASS if the count was not 0, otherwise pdFAIL.
+	 */
+	#define crNOTIFY_TAKE( xHandle, xClearCountOnExit, xTicksToWait, pulNotificationValue, pxResult )			\
+	{																											\
+		*( pxResult ) = xCoRoutineNotifyTake( ( xClearCountOnExit ), ( xTicksToWait ), ( pulNotificationValue ) );	\
+		if( *( pxResult ) == errQUEUE_BLOCKED )																	\
+		{																										\
+			crSET_STATE0( ( xHandle ) );																		\
+			*( pxResult ) = xCoRoutineNotifyTake( ( xClearCountOnExit ), 0, ( pulNotificationValue ) );		\
+		}																										\
+	}
+
+	/**
+	 * croutine_ext. h
+	 * <pre>void vCoRoutineNotifyGive( CoRoutineHandle_t xCoRoutine );</pre>
+	 *
+	 * Increment the notification count of a co-routine, readying it if it is
+	 * blocked in crNOTIFY_TAKE().  Can be called from a task or a co-routine.
+	 *
+	 * @param xCoRoutine The handle of the co-routine to notify.
+	 */
+	void vCoRoutineNotifyGive( CoRoutineHandle_t xCoRoutine );
+
+	/**
+	 * croutine_ext. h
+	 * <pre>void vCoRoutineNotifyGiveFromISR( CoRoutineHandle_t xCoRoutine, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+	 *
+	 * A version of vCoRoutineNotifyGive() that can be called from an
+	 * interrupt.
+	 *
+	 * @param xCoRoutine The handle of the co-routine to notify.
+	 *
+	 * @param pxHigherPriorityTaskWoken Set to pdTRUE if the task that runs the
+	 * co-routines has a priority above the interrupted task, in which case a
+	 * context switch should be requested before the interrupt exits.
+	 */
+	void vCoRoutineNotifyGiveFromISR( CoRoutineHandle_t xCoRoutine, BaseType_t *pxHigherPriorityTaskWoken );
+
+	/*
+	 * Used by crNOTIFY_TAKE().  Not to be called directly.
+	 */
+	BaseType_t xCoRoutineNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait, uint32_t *pulNotificationValue );
+
+#endif /* configUSE_EVENT_DRIVEN_CO_ROUTINES */
+
+#endif /* CROUTINE_EXT_H */
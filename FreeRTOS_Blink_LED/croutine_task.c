@@ -0,0 +1,338 @@
+/*
+ * croutine_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks that co-routines run from the co-routine scheduler task
+ * are woken by timeouts, notifications and queues shared with tasks.
+ *
+ * vCoRoutineTask() creates three co-routines and the task that runs them:
+ *
+ * The delay co-routine repeatedly delays for mainCR_DELAY_TICKS ticks, and
+ * checks it never wakes early and runs in the co-routine scheduler task.
+ *
+ * The notify co-routine repeatedly waits up to mainCR_NOTIFY_TIMEOUT ticks
+ * for a notification, counting both the notifications it receives and the
+ * waits that time out.
+ *
+ * The queue co-routine receives the numbers a task sends to xCoRoutineQueue,
+ * and checks they arrive in order.
+ *
+ * A check task periodically gives mainCR_NOTIFY_COUNT notifications and sends
+ * mainCR_QUEUE_COUNT numbers, then checks that they have all been received
+ * mainCR_SETTLE_TICKS ticks later.  Between the checks no notification is
+ * given, so the notify co-routine must also have timed out, and the delay
+ * co-routine must have kept running.
+ *
+ * A check that fails sets a bit in g_ui32CoRoutineErrors, and
+ * g_ui32CoRoutineChecks counts the completed checks.  Both can be read with
+ * the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "croutine.h"
+#include "croutine_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when the co-routines have their own task. */
+#if ( ( configUSE_CO_ROUTINES != 0 ) && ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 ) )
+
+/*
+ * The priorities of the check task and the co-routine scheduler task, and the
+ * rate at which the check task runs.
+ */
+#define mainCR_CHECK_PRIORITY               ( tskIDLE_PRIORITY + 5 )
+#define mainCR_SCHEDULER_PRIORITY           ( tskIDLE_PRIORITY + 5 )
+#define mainCR_CHECK_PERIOD                 ( pdMS_TO_TICKS( 200UL ) )
+
+/*
+ * The co-routine priorities, and the index passed to each co-routine.
+ */
+#define mainCR_LOW_PRIORITY                 ( ( UBaseType_t ) 0U )
+#define mainCR_HIGH_PRIORITY                ( ( UBaseType_t ) 1U )
+#define mainCR_DELAY_INDEX                  ( ( UBaseType_t ) 0U )
+#define mainCR_NOTIFY_INDEX                 ( ( UBaseType_t ) 1U )
+#define mainCR_QUEUE_INDEX                  ( ( UBaseType_t ) 2U )
+
+/*
+ * The timing of the co-routines, the number of notifications and numbers
+ * given on each check, and the ticks allowed for them all to be received.
+ */
+#define mainCR_DELAY_TICKS                  ( ( TickType_t ) 7 )
+#define mainCR_NOTIFY_TIMEOUT               ( pdMS_TO_TICKS( 30UL ) )
+#define mainCR_QUEUE_TIMEOUT                ( pdMS_TO_TICKS( 1000UL ) )
+#define mainCR_NOTIFY_COUNT                 ( 3UL )
+#define mainCR_QUEUE_COUNT                  ( 3UL )
+#define mainCR_QUEUE_LENGTH                 ( 2UL )
+#define mainCR_SETTLE_TICKS                 ( ( TickType_t ) 5 )
+
+/*
+ * Bits set in g_ui32CoRoutineErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_EARLY                     ( 1UL << 1UL )
+#define mainERROR_WRONG_TASK                ( 1UL << 2UL )
+#define mainERROR_NOTIFY_MISSED             ( 1UL << 3UL )
+#define mainERROR_NO_TIMEOUT                ( 1UL << 4UL )
+#define mainERROR_QUEUE_ORDER               ( 1UL << 5UL )
+#define mainERROR_QUEUE_MISSED              ( 1UL << 6UL )
+#define mainERROR_STALLED                   ( 1UL << 7UL )
+
+/*
+ * Results of the checks, written by the task and the co-routines.
+ */
+volatile uint32_t g_ui32CoRoutineErrors = 0;
+volatile uint32_t g_ui32CoRoutineChecks = 0;
+volatile uint32_t g_ui32CoRoutineDelays = 0;
+volatile uint32_t g_ui32CoRoutineNotifications = 0;
+volatile uint32_t g_ui32CoRoutineTimeouts = 0;
+volatile uint32_t g_ui32CoRoutineReceived = 0;
+
+/*
+ * The queue shared by the check task and the queue co-routine, and the handle
+ * of the notify co-routine, which is only known once it has run.
+ */
+static QueueHandle_t xCoRoutineQueue = NULL;
+static volatile CoRoutineHandle_t xNotifyCoRoutine = NULL;
+
+/*
+ * The check task and the co-routines as described in the comments at the top
+ * of this file.
+ */
+static void prvCoRoutineCheckTask( void *pvParameters );
+static void prvDelayCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+static void prvNotifyCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+static void prvQueueCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+
+/*
+ * Called by main() to create the task, the co-routines and the co-routine
+ * scheduler task.
+ */
+void vCoRoutineTask( void );
+/*-----------------------------------------------------------*/
+
+void vCoRoutineTask( void )
+{
+    xCoRoutineQueue = xQueueCreate( mainCR_QUEUE_LENGTH, sizeof( uint32_t ) );
+
+    if( ( xCoRoutineQueue == NULL ) ||
+        ( xCoRoutineCreate( prvDelayCoRoutine, mainCR_LOW_PRIORITY, mainCR_DELAY_INDEX ) != pdPASS ) ||
+        ( xCoRoutineCreate( prvNotifyCoRoutine, mainCR_HIGH_PRIORITY, mainCR_NOTIFY_INDEX ) != pdPASS ) ||
+        ( xCoRoutineCreate( prvQueueCoRoutine, mainCR_LOW_PRIORITY, mainCR_QUEUE_INDEX ) != pdPASS ) )
+    {
+        g_ui32CoRoutineErrors |= mainERROR_CREATE;
+    }
+
+    if( ( xCoRoutineCreateSchedulerTask( mainCR_SCHEDULER_PRIORITY, configMINIMAL_STACK_SIZE ) != pdPASS ) ||
+        ( xTaskCreate( prvCoRoutineCheckTask,
+                       "CoRtnChk",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainCR_CHECK_PRIORITY,
+                       NULL ) != pdPASS ) )
+    {
+        g_ui32CoRoutineErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvCoRoutineCheckTask( void *pvParameters )
+{
+TickType_t xLastWakeTime;
+uint32_t ui32Value, ui32Sent = 0, ui32Notifications = 0, ui32Timeouts = 0, ui32Delays = 0;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainCR_CHECK_PERIOD );
+
+        /* Nothing was given since the last check, so the notify co-routine
+        has had time to time out. */
+        if( g_ui32CoRoutineTimeouts == ui32Timeouts )
+        {
+            g_ui32CoRoutineErrors |= mainERROR_NO_TIMEOUT;
+        }
+
+        ui32Timeouts = g_ui32CoRoutineTimeouts;
+
+        if( xNotifyCoRoutine != NULL )
+        {
+            for( ui32Value = 0; ui32Value < mainCR_NOTIFY_COUNT; ui32Value++ )
+            {
+                vCoRoutineNotifyGive( xNotifyCoRoutine );
+            }
+
+            ui32Notifications += mainCR_NOTIFY_COUNT;
+        }
+
+        /* More numbers are sent than the queue can hold, so the later sends
+        block until the co-routine has been woken and made room. */
+        for( ui32Value = 0; ui32Value < mainCR_QUEUE_COUNT; ui32Value++ )
+        {
+            if( xQueueSend( xCoRoutineQueue, &ui32Sent, mainCR_CHECK_PERIOD ) == pdPASS )
+            {
+                ui32Sent++;
+            }
+        }
+
+        vTaskDelay( mainCR_SETTLE_TICKS );
+
+        if( g_ui32CoRoutineNotifications != ui32Notifications )
+        {
+            g_ui32CoRoutineErrors |= mainERROR_NOTIFY_MISSED;
+        }
+
+        if( g_ui32CoRoutineReceived != ui32Sent )
+        {
+            g_ui32CoRoutineErrors |= mainERROR_QUEUE_MISSED;
+        }
+
+        if( g_ui32CoRoutineDelays == ui32Delays )
+        {
+            g_ui32CoRoutineErrors |= mainERROR_STALLED;
+        }
+
+        ui32Delays = g_ui32CoRoutineDelays;
+
+        g_ui32CoRoutineChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+/* Co-routines do not keep their stack when they block, so anything used
+across a block is static. */
+static TickType_t xLastWake;
+
+    ( void ) uxIndex;
+
+    crSTART( xHandle );
+
+    xLastWake = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        crDELAY( xHandle, mainCR_DELAY_TICKS );
+
+        /* The delay counts from the tick count the scheduler last read,
+        which can be one tick behind xLastWake. */
+        if( ( xTaskGetTickCount() - xLastWake ) < ( mainCR_DELAY_TICKS - ( TickType_t ) 1 ) )
+        {
+            g_ui32CoRoutineErrors |= mainERROR_EARLY;
+        }
+
+        if( uxTaskPriorityGet( NULL ) != mainCR_SCHEDULER_PRIORITY )
+        {
+            g_ui32CoRoutineErrors |= mainERROR_WRONG_TASK;
+        }
+
+        xLastWake = xTaskGetTickCount();
+        g_ui32CoRoutineDelays++;
+    }
+
+    crEND();
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+static uint32_t ulValue;
+static BaseType_t xResult;
+
+    ( void ) uxIndex;
+
+    crSTART( xHandle );
+
+    xNotifyCoRoutine = xHandle;
+
+    for( ;; )
+    {
+        crNOTIFY_TAKE( xHandle, pdTRUE, mainCR_NOTIFY_TIMEOUT, &ulValue, &xResult );
+
+        if( xResult == pdPASS )
+        {
+            g_ui32CoRoutineNotifications += ulValue;
+        }
+        else
+        {
+            g_ui32CoRoutineTimeouts++;
+        }
+    }
+
+    crEND();
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+static uint32_t ulReceived;
+static BaseType_t xResult;
+
+    ( void ) uxIndex;
+
+    crSTART( xHandle );
+
+    for( ;; )
+    {
+        crQUEUE_RECEIVE( xHandle, xCoRoutineQueue, &ulReceived, mainCR_QUEUE_TIMEOUT, &xResult );
+
+        if( xResult == pdPASS )
+        {
+            if( ulReceived != g_ui32CoRoutineReceived )
+            {
+                g_ui32CoRoutineErrors |= mainERROR_QUEUE_ORDER;
+            }
+
+            g_ui32CoRoutineReceived++;
+        }
+    }
+
+    crEND();
+}
+/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_CO_ROUTINES != 0 ) && ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 ) */
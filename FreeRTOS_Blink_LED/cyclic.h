@@ -0,0 +1,257 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef CYCLIC_H
+#define CYCLIC_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include cyclic.h"
+#endif
+
+/******************************************************************************
+ *
+ * Time triggered cyclic executive.
+ *
+ * A cyclic executive runs tasks from a static schedule table rather than
+ * making priority based decisions.  The table divides a major frame of a
+ * fixed number of ticks into slots.  Each slot gives the tick offset within
+ * the frame at which the slot starts, the task that is run in the slot, and
+ * the number of processor cycles the task may use.  The frame repeats for as
+ * long as the executive runs.
+ *
+ * Each tick the executive compares the position within the frame against the
+ * offset of the next slot, so dispatching a slot costs a single table lookup.
+ * When a slot starts its task is released with a task notification, and the
+ * scheduler then runs that task in preference to every other ready task,
+ * whatever their priorities, until the task calls vCyclicWaitForSlot() to end
+ * the slot.  A task of a higher priority that becomes ready during the slot
+ * waits for it to end, so a slot task can be created at any priority, and the
+ * release jitter is limited to the tick interrupt latency.  If the slot task
+ * blocks for any other reason the other tasks run until it is ready again.
+ * Tasks are scheduled as normal in the time that is not used by the slots.
+ *
+ * The time from the start of a slot is measured with the DWT cycle counter,
+ * which is checked on every tick while the slot runs.  When the budget of a
+ * slot expires it is counted as an overrun at the next tick, and its task
+ * loses its precedence and carries on at its own priority.  A budget shorter
+ * than a tick is also checked when the slot task calls vCyclicWaitForSlot().
+ * A slot that has not finished when the next slot starts is counted as a slot
+ * overrun, as well as a budget overrun if its budget has expired.  Use
+ * vCyclicExecutiveGetStats() to read the counts.
+ *
+ * Set configUSE_CYCLIC_EXECUTIVE to 1 in FreeRTOSConfig.h to include the
+ * cyclic executive.  configUSE_TASK_NOTIFICATIONS and configUSE_PREEMPTION
+ * must also be 1.
+ *
+ *****************************************************************************/
+
+#ifndef configUSE_CYCLIC_EXECUTIVE
+	#define configUSE_CYCLIC_EXECUTIVE 0
+#endif
+
+#if ( ( configUSE_CYCLIC_EXECUTIVE == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 in FreeRTOSConfig.h to use the cyclic executive.
+#endif
+
+#if ( ( configUSE_CYCLIC_EXECUTIVE == 1 ) && ( configUSE_PREEMPTION != 1 ) )
+	#error configUSE_PREEMPTION must be set to 1 in FreeRTOSConfig.h to use the cyclic executive.
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * One slot of a schedule table.  The table can be declared const, as the
+ * handles of the slot tasks are reached through pointers to the variables
+ * that hold them:
+ * <pre>
+ static TaskHandle_t xControlTask, xFilterTask;
+
+ static const CyclicSlot_t xSchedule[] =
+ {
+	{ 0, &xControlTask, 20000UL },
+	{ 2, &xFilterTask, 40000UL },
+	{ 5, &xControlTask, 20000UL }
+ };
+ </pre>
+ */
+typedef struct xCYCLIC_SLOT
+{
+	TickType_t xOffset;				/*< The tick within the major frame at which the slot starts.  Slots must be listed in increasing order of offset. */
+	TaskHandle_t *pxTask;			/*< Points to the handle of the task run in the slot. */
+	uint32_t ulBudgetCycles;		/*< The number of processor cycles the slot may use, measured from the start of the slot.  0 if the slot is not checked. */
+} CyclicSlot_t;
+
+/**
+ * Statistics kept by the cyclic executive.
+ */
+typedef struct xCYCLIC_STATS
+{
+	uint32_t ulFramesCompleted;		/*< The number of major frames that have completed since the executive was started. */
+	uint32_t ulBudgetOverruns;		/*< The number of slots that used more cycles than their budget. */
+	uint32_t ulSlotOverruns;		/*< The number of slots that had not finished when the next slot started. */
+	UBaseType_t uxLastOverrunSlot;	/*< The index in the schedule table of the slot that last overran. */
+	uint32_t ulWorstSlotCycles;		/*< The largest number of cycles used by any slot. */
+} CyclicStats_t;
+
+/**
+ * cyclic. h
+ * <pre>
+ BaseType_t xCyclicExecutiveStart( const CyclicSlot_t * const pxSchedule, UBaseType_t uxNumberOfSlots, TickType_t xMajorFrameTicks );
+ * </pre>
+ *
+ * Start dispatching slots from a schedule table.  The first frame starts on
+ * the next tick.  The tasks referenced from the table must already have been
+ * created, and must each call vCyclicWaitForSlot() before doing the work of
+ * their first slot.
+ *
+ * @param pxSchedule The schedule table.  The table is used in place, so must
+ * remain valid for as long as the executive runs.
+ *
+ * @param uxNumberOfSlots The number of slots in pxSchedule.
+ *
+ * @param xMajorFrameTicks The length of the major frame in ticks.  The offset
+ * of every slot must be less than this value.
+ *
+ * @return pdPASS if the executive was started, or pdFAIL if the table is not
+ * valid or the executive is already running.
+ */
+BaseType_t xCyclicExecutiveStart( const CyclicSlot_t * const pxSchedule, UBaseType_t uxNumberOfSlots, TickType_t xMajorFrameTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * cyclic. h
+ * <pre>
+ void vCyclicWaitForSlot( void );
+ * </pre>
+ *
+ * Called by a slot task to end the slot it is running in, if any, and to
+ * block until the next slot in which it is to run starts.
+ */
+void vCyclicWaitForSlot( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * cyclic. h
+ * <pre>
+ void vCyclicExecutiveGetStats( CyclicStats_t *pxStats );
+ * </pre>
+ *
+ * Take a copy of the statistics kept by the cyclic executive.
+ *
+ * @param pxStats The structure into which the statistics are copied.
+ */
+void vCyclicExecutiveGetStats( CyclicStats_t * const pxStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Called by xTaskIncrementTick() on each tick to start the next slot when its
+ * offset is reached, and to end the precedence of the slot task when the
+ * budget of the slot has expired.  Returns pdTRUE if a context switch is
+ * required.
+ */
+BaseType_t xCyclicExecutiveTick( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Called by vTaskSwitchContext() to get the task of the current slot while the
+ * slot is within its budget.  The scheduler runs that task in preference to
+ * any other if it is ready.  Returns NULL if there is no such task.
+ */
+TaskHandle_t xCyclicExecutiveGetDispatchTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Used with the dynamic tick.  Returns the number of ticks until the tick at
+ * which the executive next has work to do: the next slot starts, or the
+ * budget of the running slot is found to have expired.  Returns portMAX_DELAY
+ * if the executive is not running.
+ */
+TickType_t xCyclicExecutiveTicksToNextEvent( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Used with the dynamic tick.  Advances the position within the major frame
+ * over xTicks ticks for which xCyclicExecutiveTick() was not called.  No slot
+ * can start, and no budget can be found to have expired, during those ticks.
+ */
+void vCyclicExecutiveStepTicks( TickType_t xTicks ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYCLIC_H */
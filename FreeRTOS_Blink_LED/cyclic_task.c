@@ -0,0 +1,268 @@
+/*
+ * cyclic_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the table driven dispatch and the budget checks of the
+ * cyclic executive.
+ *
+ * vCyclicTask() creates two slot tasks and a task of a higher priority than
+ * both, then starts the executive with a schedule table that runs each slot
+ * task once per major frame.  In its slot, the first slot task notifies the
+ * higher priority task, which must not run until the slot ends.  The second
+ * slot task overruns its budget every mainCYCLIC_OVERRUN_RATE slots, and
+ * checks that the overrun has already been counted before it finishes the
+ * slot.  No slot may still be running when the next one starts.
+ *
+ * A check that fails sets a bit in g_ui32CyclicErrors, and g_ui32CyclicChecks
+ * counts the completed checks.  Both can be read with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cyclic.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when the cyclic executive is included. */
+#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+
+/*
+ * Priorities at which the tasks are created.  The slot tasks are above the
+ * other checks so an overrunning slot still finishes before the next slot,
+ * and the waiting task is above the slot tasks.
+ */
+#define mainCYCLIC_SLOT_PRIORITY            ( tskIDLE_PRIORITY + 8 )
+#define mainCYCLIC_WAITING_PRIORITY         ( tskIDLE_PRIORITY + 9 )
+
+/*
+ * The major frame, and the offset of the slot of each slot task within it.
+ */
+#define mainCYCLIC_FRAME_TICKS              ( pdMS_TO_TICKS( 10UL ) )
+#define mainCYCLIC_SLOT_A_OFFSET            ( pdMS_TO_TICKS( 0UL ) )
+#define mainCYCLIC_SLOT_B_OFFSET            ( pdMS_TO_TICKS( 5UL ) )
+
+/*
+ * The budget of each slot, which is half a tick.
+ */
+#define mainCYCLIC_BUDGET_CYCLES            ( configCPU_CLOCK_HZ / ( 2UL * configTICK_RATE_HZ ) )
+
+/*
+ * The second slot task overruns once in this many of its slots, by using the
+ * processor for mainCYCLIC_OVERRUN_TICKS ticks.
+ */
+#define mainCYCLIC_OVERRUN_RATE             ( 10UL )
+#define mainCYCLIC_OVERRUN_TICKS            ( ( TickType_t ) 2 )
+
+/*
+ * Bits set in g_ui32CyclicErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_SLOT_STOLEN               ( 1UL << 1UL )
+#define mainERROR_WAITING_NOT_RUN           ( 1UL << 2UL )
+#define mainERROR_OVERRUN_NOT_DETECTED      ( 1UL << 3UL )
+#define mainERROR_SLOT_OVERRUN              ( 1UL << 4UL )
+#define mainERROR_FRAME_STALLED             ( 1UL << 5UL )
+
+/*
+ * Results of the checks, written by the tasks.
+ */
+volatile uint32_t g_ui32CyclicErrors = 0;
+volatile uint32_t g_ui32CyclicChecks = 0;
+volatile uint32_t g_ui32CyclicWaitingRuns = 0;
+
+/*
+ * The tasks referenced from the schedule table, and the task notified by the
+ * first slot task.
+ */
+static TaskHandle_t xSlotTaskA = NULL;
+static TaskHandle_t xSlotTaskB = NULL;
+static TaskHandle_t xWaitingTask = NULL;
+
+/*
+ * The schedule table.
+ */
+static const CyclicSlot_t xCyclicSchedule[] =
+{
+    { mainCYCLIC_SLOT_A_OFFSET, &xSlotTaskA, mainCYCLIC_BUDGET_CYCLES },
+    { mainCYCLIC_SLOT_B_OFFSET, &xSlotTaskB, mainCYCLIC_BUDGET_CYCLES }
+};
+
+/*
+ * The tasks as described in the comments at the top of this file.
+ */
+static void prvSlotTaskA( void *pvParameters );
+static void prvSlotTaskB( void *pvParameters );
+static void prvWaitingTask( void *pvParameters );
+
+/*
+ * Called by main() to create the tasks and start the executive.
+ */
+void vCyclicTask( void );
+/*-----------------------------------------------------------*/
+
+void vCyclicTask( void )
+{
+    if( ( xTaskCreate( prvSlotTaskA,
+                       "SlotA",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainCYCLIC_SLOT_PRIORITY,
+                       &xSlotTaskA ) != pdPASS ) ||
+        ( xTaskCreate( prvSlotTaskB,
+                       "SlotB",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainCYCLIC_SLOT_PRIORITY,
+                       &xSlotTaskB ) != pdPASS ) ||
+        ( xTaskCreate( prvWaitingTask,
+                       "CycWait",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainCYCLIC_WAITING_PRIORITY,
+                       &xWaitingTask ) != pdPASS ) ||
+        ( xCyclicExecutiveStart( xCyclicSchedule,
+                                 sizeof( xCyclicSchedule ) / sizeof( xCyclicSchedule[ 0 ] ),
+                                 mainCYCLIC_FRAME_TICKS ) != pdPASS ) )
+    {
+        g_ui32CyclicErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSlotTaskA( void *pvParameters )
+{
+uint32_t ui32WaitingRuns;
+
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        vCyclicWaitForSlot();
+
+        ui32WaitingRuns = g_ui32CyclicWaitingRuns;
+
+        /* The waiting task is of a higher priority, but must not run until
+        this slot ends. */
+        xTaskNotifyGive( xWaitingTask );
+
+        if( g_ui32CyclicWaitingRuns != ui32WaitingRuns )
+        {
+            g_ui32CyclicErrors |= mainERROR_SLOT_STOLEN;
+        }
+
+        /* Ending the slot lets the waiting task run.  That is checked by the
+        slot task B. */
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSlotTaskB( void *pvParameters )
+{
+CyclicStats_t xStats;
+uint32_t ui32Slots = 0, ui32Overruns = 0, ui32LastFrames = 0, ui32LastWaitingRuns = 0;
+TickType_t xWorkStart;
+
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        vCyclicWaitForSlot();
+        ui32Slots++;
+
+        if( ( ui32Slots % mainCYCLIC_OVERRUN_RATE ) == 0UL )
+        {
+            /* Use the processor for longer than the budget of the slot.  The
+            overrun is counted at the first tick after the budget expires. */
+            xWorkStart = xTaskGetTickCount();
+
+            while( ( xTaskGetTickCount() - xWorkStart ) < mainCYCLIC_OVERRUN_TICKS )
+            {
+            }
+
+            ui32Overruns++;
+        }
+
+        vCyclicExecutiveGetStats( &xStats );
+
+        if( xStats.ulBudgetOverruns != ui32Overruns )
+        {
+            g_ui32CyclicErrors |= mainERROR_OVERRUN_NOT_DETECTED;
+        }
+
+        if( xStats.ulSlotOverruns != 0UL )
+        {
+            g_ui32CyclicErrors |= mainERROR_SLOT_OVERRUN;
+        }
+
+        /* A frame has completed since the last slot of this task. */
+        if( ( ui32Slots > 1UL ) && ( xStats.ulFramesCompleted == ui32LastFrames ) )
+        {
+            g_ui32CyclicErrors |= mainERROR_FRAME_STALLED;
+        }
+
+        /* The slot task A has ended its slot since the last slot of this task,
+        which let the waiting task run. */
+        if( g_ui32CyclicWaitingRuns == ui32LastWaitingRuns )
+        {
+            g_ui32CyclicErrors |= mainERROR_WAITING_NOT_RUN;
+        }
+
+        ui32LastFrames = xStats.ulFramesCompleted;
+        ui32LastWaitingRuns = g_ui32CyclicWaitingRuns;
+
+        g_ui32CyclicChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitingTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ;; )
+    {
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        g_ui32CyclicWaitingRuns++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_CYCLIC_EXECUTIVE == 1 */
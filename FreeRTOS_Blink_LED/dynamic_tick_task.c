@@ -0,0 +1,208 @@
+/*
+ * dynamic_tick_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks that the tick count kept with the dynamic tick agrees with
+ * the DWT cycle counter.
+ *
+ * With configUSE_DYNAMIC_TICK the SysTick interrupt only occurs when the
+ * kernel has work to do, and the ticks between are accounted for when the
+ * tick count is read.  vDynamicTickTask() creates a task that repeatedly
+ * delays, then uses the processor without blocking for mainDYNTICK_BUSY_TICKS
+ * measured by the cycle counter.  Each time, the ticks that have passed, both
+ * while it was delayed and while it was running, must agree with the cycles
+ * that have passed to within mainDYNTICK_TOLERANCE_CYCLES.
+ *
+ * A check that fails sets a bit in g_ui32DynamicTickErrors, and
+ * g_ui32DynamicTickChecks counts the completed checks.  The largest difference
+ * seen, in cycles, is kept in g_ui32DynamicTickWorstCycles.  All can be read
+ * with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+#include "port_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when the dynamic tick is included. */
+#if ( configUSE_DYNAMIC_TICK == 1 )
+
+/*
+ * The priority of the check task.
+ */
+#define mainDYNTICK_PRIORITY                ( tskIDLE_PRIORITY + 5 )
+
+/*
+ * The rate at which the check is repeated, and the time the check task uses
+ * the processor each time.
+ */
+#define mainDYNTICK_PERIOD                  ( pdMS_TO_TICKS( 100UL ) )
+#define mainDYNTICK_BUSY_TICKS              ( 3UL )
+
+/*
+ * The number of cycles in a tick, and the largest difference allowed between
+ * the tick count and the cycle counter.  A tick count read just before a tick
+ * is due can be a tick behind.
+ */
+#define mainDYNTICK_CYCLES_PER_TICK         ( configCPU_CLOCK_HZ / configTICK_RATE_HZ )
+#define mainDYNTICK_TOLERANCE_CYCLES        ( mainDYNTICK_CYCLES_PER_TICK + ( mainDYNTICK_CYCLES_PER_TICK / 10UL ) )
+
+/*
+ * Bits set in g_ui32DynamicTickErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_DRIFT                     ( 1UL << 1UL )
+
+/*
+ * Results of the checks, written by the task.
+ */
+volatile uint32_t g_ui32DynamicTickErrors = 0;
+volatile uint32_t g_ui32DynamicTickChecks = 0;
+volatile uint32_t g_ui32DynamicTickWorstCycles = 0;
+
+/*
+ * The task as described in the comments at the top of this file.
+ */
+static void prvDynamicTickTask( void *pvParameters );
+
+/*
+ * Compares the ticks and cycles that have passed since the last call, and
+ * records the difference.
+ */
+static void prvCompare( TickType_t *pxLastTicks, uint32_t *pui32LastCycles );
+
+/*
+ * Called by main() to create the task.
+ */
+void vDynamicTickTask( void );
+/*-----------------------------------------------------------*/
+
+void vDynamicTickTask( void )
+{
+    portENABLE_CYCLE_COUNTER();
+
+    if( xTaskCreate( prvDynamicTickTask,
+                     "DynTick",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainDYNTICK_PRIORITY,
+                     NULL ) != pdPASS )
+    {
+        g_ui32DynamicTickErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvDynamicTickTask( void *pvParameters )
+{
+TickType_t xLastWakeTime, xLastTicks;
+uint32_t ui32LastCycles, ui32BusyStart;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+    xLastTicks = xLastWakeTime;
+    ui32LastCycles = portGET_CYCLE_COUNT();
+
+    for( ;; )
+    {
+        /* Most of the ticks of the delay pass without a tick interrupt. */
+        vTaskDelayUntil( &xLastWakeTime, mainDYNTICK_PERIOD );
+        prvCompare( &xLastTicks, &ui32LastCycles );
+
+        /* Ticks also pass while this task runs without another task to time
+        slice with. */
+        ui32BusyStart = portGET_CYCLE_COUNT();
+
+        while( ( portGET_CYCLE_COUNT() - ui32BusyStart ) < ( mainDYNTICK_BUSY_TICKS * mainDYNTICK_CYCLES_PER_TICK ) )
+        {
+        }
+
+        prvCompare( &xLastTicks, &ui32LastCycles );
+
+        g_ui32DynamicTickChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvCompare( TickType_t *pxLastTicks, uint32_t *pui32LastCycles )
+{
+TickType_t xTicks;
+uint32_t ui32Cycles, ui32TickCycles, ui32Difference;
+
+    /* The two are read together so no tick can be announced between
+    them. */
+    taskENTER_CRITICAL();
+    {
+        xTicks = xTaskGetTickCount();
+        ui32Cycles = portGET_CYCLE_COUNT();
+    }
+    taskEXIT_CRITICAL();
+
+    ui32TickCycles = ( uint32_t ) ( xTicks - *pxLastTicks ) * mainDYNTICK_CYCLES_PER_TICK;
+
+    if( ui32TickCycles > ( ui32Cycles - *pui32LastCycles ) )
+    {
+        ui32Difference = ui32TickCycles - ( ui32Cycles - *pui32LastCycles );
+    }
+    else
+    {
+        ui32Difference = ( ui32Cycles - *pui32LastCycles ) - ui32TickCycles;
+    }
+
+    if( ui32Difference > g_ui32DynamicTickWorstCycles )
+    {
+        g_ui32DynamicTickWorstCycles = ui32Difference;
+    }
+
+    if( ui32Difference > mainDYNTICK_TOLERANCE_CYCLES )
+    {
+        g_ui32DynamicTickErrors |= mainERROR_DRIFT;
+    }
+
+    *pxLastTicks = xTicks;
+    *pui32LastCycles = ui32Cycles;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_DYNAMIC_TICK == 1 */
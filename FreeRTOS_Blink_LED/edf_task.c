@@ -0,0 +1,259 @@
+/*
+ * edf_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the earliest deadline first scheduling of the tasks of
+ * priority configEDF_TASK_PRIORITY.
+ *
+ * vEdfTask() creates mainEDF_TASKS periodic tasks at that priority, each with
+ * its own period and relative deadline, and a check task above them.  Each
+ * periodic task uses the processor for a few ticks of each period, then checks
+ * that the release completed before its deadline.  The set of tasks can only
+ * meet all of its deadlines if the task with the earliest deadline is always
+ * the one that runs.
+ *
+ * The check task makes sure every periodic task keeps completing releases,
+ * and sets and clears a deadline of its own so the deadline heap has to grow
+ * past its initial size.
+ *
+ * A check that fails sets a bit in g_ui32EdfErrors, and g_ui32EdfChecks counts
+ * the completed checks.  Both can be read with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when earliest deadline first scheduling is
+included. */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/*
+ * The check task runs above the deadline scheduled tasks.
+ */
+#define mainEDF_CHECK_PRIORITY              ( configEDF_TASK_PRIORITY + 1 )
+
+/*
+ * The rate at which the check task runs.
+ */
+#define mainEDF_CHECK_PERIOD                ( pdMS_TO_TICKS( 100UL ) )
+
+/*
+ * The number of deadline scheduled tasks.  The check task declares a deadline
+ * as well, so one more task than the initial size of the deadline heap has a
+ * deadline.
+ */
+#define mainEDF_TASKS                       ( 4 )
+
+/*
+ * Bits set in g_ui32EdfErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_DEADLINE_MISSED           ( 1UL << 1UL )
+#define mainERROR_STALLED                   ( 1UL << 2UL )
+#define mainERROR_DEADLINE_SET              ( 1UL << 3UL )
+
+/*
+ * Results of the checks, written by the tasks.
+ */
+volatile uint32_t g_ui32EdfErrors = 0;
+volatile uint32_t g_ui32EdfChecks = 0;
+volatile uint32_t g_ui32EdfReleases[ mainEDF_TASKS ] = { 0 };
+
+/*
+ * The period, relative deadline and execution time of each deadline scheduled
+ * task, in ticks.  The third task has a deadline shorter than its period, so
+ * it has to run ahead of tasks that became ready before it.
+ */
+static const TickType_t xEdfPeriods[ mainEDF_TASKS ] =
+{
+    pdMS_TO_TICKS( 10UL ), pdMS_TO_TICKS( 15UL ), pdMS_TO_TICKS( 20UL ), pdMS_TO_TICKS( 25UL )
+};
+
+static const TickType_t xEdfDeadlines[ mainEDF_TASKS ] =
+{
+    pdMS_TO_TICKS( 10UL ), pdMS_TO_TICKS( 15UL ), pdMS_TO_TICKS( 6UL ), pdMS_TO_TICKS( 25UL )
+};
+
+static const TickType_t xEdfExecutionTimes[ mainEDF_TASKS ] =
+{
+    pdMS_TO_TICKS( 1UL ), pdMS_TO_TICKS( 2UL ), pdMS_TO_TICKS( 2UL ), pdMS_TO_TICKS( 2UL )
+};
+
+/*
+ * The tasks as described in the comments at the top of this file.  The
+ * deadline scheduled tasks share an implementation, and are passed their
+ * index into the arrays above.
+ */
+static void prvEdfCheckTask( void *pvParameters );
+static void prvEdfTask( void *pvParameters );
+
+/*
+ * Called by main() to create the tasks.
+ */
+void vEdfTask( void );
+/*-----------------------------------------------------------*/
+
+void vEdfTask( void )
+{
+TaskHandle_t xTask;
+uint32_t ui32Task;
+
+    /* Each task is given the deadline of its first release as it is
+    created. */
+    for( ui32Task = 0; ui32Task < mainEDF_TASKS; ui32Task++ )
+    {
+        if( ( xTaskCreate( prvEdfTask,
+                           "EDF",
+                           configMINIMAL_STACK_SIZE,
+                           ( void * ) ui32Task,
+                           configEDF_TASK_PRIORITY,
+                           &xTask ) != pdPASS ) ||
+            ( xTaskDeadlineSet( xTask, xEdfDeadlines[ ui32Task ] ) != pdPASS ) )
+        {
+            g_ui32EdfErrors |= mainERROR_CREATE;
+        }
+    }
+
+    if( xTaskCreate( prvEdfCheckTask,
+                     "EDFChk",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainEDF_CHECK_PRIORITY,
+                     NULL ) != pdPASS )
+    {
+        g_ui32EdfErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvEdfCheckTask( void *pvParameters )
+{
+uint32_t ui32LastReleases[ mainEDF_TASKS ] = { 0 };
+TickType_t xLastWakeTime, xTicksBefore, xTicksAfter, xDeadline;
+BaseType_t xReturn;
+uint32_t ui32Task;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainEDF_CHECK_PERIOD );
+
+        /* Each deadline scheduled task must have completed releases since the
+        last check. */
+        for( ui32Task = 0; ui32Task < mainEDF_TASKS; ui32Task++ )
+        {
+            if( g_ui32EdfReleases[ ui32Task ] == ui32LastReleases[ ui32Task ] )
+            {
+                g_ui32EdfErrors |= mainERROR_STALLED;
+            }
+
+            ui32LastReleases[ ui32Task ] = g_ui32EdfReleases[ ui32Task ];
+        }
+
+        /* This task is not of the deadline scheduled priority, so a deadline
+        does not change when it runs, but still needs room in the deadline
+        heap.  The deadline is measured from the tick count when it is set. */
+        xTicksBefore = xTaskGetTickCount();
+        xReturn = xTaskDeadlineSet( NULL, mainEDF_CHECK_PERIOD );
+        xDeadline = xTaskDeadlineGet( NULL );
+        xTicksAfter = xTaskGetTickCount();
+
+        if( ( xReturn != pdPASS ) ||
+            ( ( TickType_t ) ( xDeadline - mainEDF_CHECK_PERIOD - xTicksBefore ) > ( TickType_t ) ( xTicksAfter - xTicksBefore ) ) )
+        {
+            g_ui32EdfErrors |= mainERROR_DEADLINE_SET;
+        }
+
+        ( void ) xTaskDeadlineSet( NULL, 0 );
+
+        if( xTaskDeadlineGet( NULL ) != portMAX_DELAY )
+        {
+            g_ui32EdfErrors |= mainERROR_DEADLINE_SET;
+        }
+
+        g_ui32EdfChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvEdfTask( void *pvParameters )
+{
+const uint32_t ui32Task = ( uint32_t ) pvParameters;
+TickType_t xLastWakeTime, xWorkStart;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        /* Use the processor for the execution time of the task.  The tick
+        count is used to measure the work, so a release that is preempted does
+        less of it. */
+        xWorkStart = xTaskGetTickCount();
+
+        while( ( xTaskGetTickCount() - xWorkStart ) < xEdfExecutionTimes[ ui32Task ] )
+        {
+        }
+
+        /* The release is complete, so its deadline must not have passed. */
+        if( ( BaseType_t ) ( xTaskGetTickCount() - xTaskDeadlineGet( NULL ) ) > 0 )
+        {
+            g_ui32EdfErrors |= mainERROR_DEADLINE_MISSED;
+        }
+
+        g_ui32EdfReleases[ ui32Task ]++;
+
+        /* Wait for the next period, and give the next release its deadline. */
+        if( xTaskDelayUntilWithDeadline( &xLastWakeTime, xEdfPeriods[ ui32Task ], xEdfDeadlines[ ui32Task ] ) != pdPASS )
+        {
+            g_ui32EdfErrors |= mainERROR_DEADLINE_SET;
+            vTaskDelayUntil( &xLastWakeTime, xEdfPeriods[ ui32Task ] );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_SCHEDULING == 1 */
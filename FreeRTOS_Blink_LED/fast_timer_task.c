@@ -0,0 +1,283 @@
+/*
+ * fast_timer_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the fast timers run from the compare interrupt of the
+ * microsecond timebase.
+ *
+ * vFastTimerTask() sets up three fast timers and creates a check task.
+ *
+ * - An auto reload timer with a period of mainFAST_PERIOD microseconds.  Its
+ *   callback checks it never runs before its expiry time, and records how
+ *   late it runs.
+ * - A one-shot timer the check task starts a short time ahead, then waits
+ *   for the notification the callback gives it.  The task must be notified,
+ *   and not before the expiry time.
+ * - A one-shot timer the check task starts and then stops before it expires.
+ *   Its callback must never run.
+ *
+ * The check task also makes sure the auto reload timer keeps expiring.
+ *
+ * A check that fails sets a bit in g_ui32FastTimerErrors, and
+ * g_ui32FastTimerChecks counts the completed checks.  The latest any callback
+ * has run, in microseconds, is kept in g_ui32FastTimerWorstLateness.  All can
+ * be read with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+#include "fasttimer.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when fast timers are included. */
+#if ( configUSE_FAST_TIMERS == 1 )
+
+/*
+ * The priority of the check task.
+ */
+#define mainFAST_PRIORITY                   ( tskIDLE_PRIORITY + 5 )
+
+/*
+ * The rate at which the check task runs.
+ */
+#define mainFAST_CHECK_PERIOD               ( pdMS_TO_TICKS( 100UL ) )
+
+/*
+ * The period of the auto reload timer, and how far ahead the check task
+ * starts the one-shot timers, in microseconds.
+ */
+#define mainFAST_PERIOD                     ( 200UL )
+#define mainFAST_ONE_SHOT_DELAY             ( 300ULL )
+
+/*
+ * The number of times the check task waits for the one-shot timer each time
+ * it runs, and the longest it waits.
+ */
+#define mainFAST_ONE_SHOTS                  ( 10UL )
+#define mainFAST_ONE_SHOT_TIMEOUT           ( pdMS_TO_TICKS( 2UL ) )
+
+/*
+ * Bits set in g_ui32FastTimerErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_EARLY                     ( 1UL << 1UL )
+#define mainERROR_STALLED                   ( 1UL << 2UL )
+#define mainERROR_NOT_NOTIFIED              ( 1UL << 3UL )
+#define mainERROR_STOP_IGNORED              ( 1UL << 4UL )
+
+/*
+ * Results of the checks, written by the task and the callbacks.
+ */
+volatile uint32_t g_ui32FastTimerErrors = 0;
+volatile uint32_t g_ui32FastTimerChecks = 0;
+volatile uint32_t g_ui32FastTimerExpiries = 0;
+volatile uint32_t g_ui32FastTimerWorstLateness = 0;
+
+/*
+ * The fast timers, and the time at which the one-shot timer that notifies
+ * the check task expires.
+ */
+static FastTimer_t xPeriodicTimer;
+static FastTimer_t xNotifyTimer;
+static FastTimer_t xStoppedTimer;
+static volatile uint64_t ullNotifyExpiryTime;
+
+/*
+ * The check task and the timer callbacks as described in the comments at the
+ * top of this file.
+ */
+static void prvFastTimerTask( void *pvParameters );
+static void prvPeriodicCallback( FastTimer_t *pxTimer, BaseType_t *pxHigherPriorityTaskWoken );
+static void prvNotifyCallback( FastTimer_t *pxTimer, BaseType_t *pxHigherPriorityTaskWoken );
+static void prvStoppedCallback( FastTimer_t *pxTimer, BaseType_t *pxHigherPriorityTaskWoken );
+
+/*
+ * Records how late a callback ran, and an error if it ran early.
+ */
+static void prvCheckExpiry( const uint64_t ullExpiryTime );
+
+/*
+ * Called by main() to create the task and set up the timers.
+ */
+void vFastTimerTask( void );
+/*-----------------------------------------------------------*/
+
+void vFastTimerTask( void )
+{
+TaskHandle_t xTask;
+
+    if( xTaskCreate( prvFastTimerTask,
+                     "Fast",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainFAST_PRIORITY,
+                     &xTask ) != pdPASS )
+    {
+        g_ui32FastTimerErrors |= mainERROR_CREATE;
+    }
+    else
+    {
+        /* The notifying timer is passed the task it notifies. */
+        vFastTimerInitialise( &xPeriodicTimer, prvPeriodicCallback, NULL );
+        vFastTimerInitialise( &xNotifyTimer, prvNotifyCallback, ( void * ) xTask );
+        vFastTimerInitialise( &xStoppedTimer, prvStoppedCallback, NULL );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvFastTimerTask( void *pvParameters )
+{
+TickType_t xLastWakeTime;
+uint32_t ui32LastExpiries = 0, ui32OneShot;
+
+    ( void ) pvParameters;
+
+    /* The timebase starts with the scheduler, so the periodic timer is
+    started from here. */
+    if( xFastTimerStart( &xPeriodicTimer, ullTaskGetMicroseconds() + ( uint64_t ) mainFAST_PERIOD, mainFAST_PERIOD ) != pdPASS )
+    {
+        g_ui32FastTimerErrors |= mainERROR_CREATE;
+    }
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainFAST_CHECK_PERIOD );
+
+        /* The auto reload timer must have expired since the last check. */
+        if( g_ui32FastTimerExpiries == ui32LastExpiries )
+        {
+            g_ui32FastTimerErrors |= mainERROR_STALLED;
+        }
+
+        ui32LastExpiries = g_ui32FastTimerExpiries;
+
+        /* A timer that is stopped before it expires never runs its callback.
+        The critical section makes sure a higher priority task cannot hold
+        this one off until the timer has expired. */
+        taskENTER_CRITICAL();
+        {
+            if( xFastTimerStart( &xStoppedTimer, ullTaskGetMicroseconds() + mainFAST_ONE_SHOT_DELAY, 0UL ) != pdPASS )
+            {
+                g_ui32FastTimerErrors |= mainERROR_CREATE;
+            }
+
+            vFastTimerStop( &xStoppedTimer );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xFastTimerIsActive( &xStoppedTimer ) != pdFALSE )
+        {
+            g_ui32FastTimerErrors |= mainERROR_STOP_IGNORED;
+        }
+
+        /* The one-shot timer wakes this task from its callback. */
+        for( ui32OneShot = 0; ui32OneShot < mainFAST_ONE_SHOTS; ui32OneShot++ )
+        {
+            ullNotifyExpiryTime = ullTaskGetMicroseconds() + mainFAST_ONE_SHOT_DELAY;
+
+            if( xFastTimerStart( &xNotifyTimer, ullNotifyExpiryTime, 0UL ) != pdPASS )
+            {
+                g_ui32FastTimerErrors |= mainERROR_CREATE;
+            }
+
+            if( ulTaskNotifyTake( pdTRUE, mainFAST_ONE_SHOT_TIMEOUT ) == 0UL )
+            {
+                g_ui32FastTimerErrors |= mainERROR_NOT_NOTIFIED;
+                vFastTimerStop( &xNotifyTimer );
+            }
+            else if( ullTaskGetMicroseconds() < ullNotifyExpiryTime )
+            {
+                g_ui32FastTimerErrors |= mainERROR_EARLY;
+            }
+        }
+
+        g_ui32FastTimerChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckExpiry( const uint64_t ullExpiryTime )
+{
+const uint64_t ullNow = ullTaskGetMicroseconds();
+
+    if( ullNow < ullExpiryTime )
+    {
+        g_ui32FastTimerErrors |= mainERROR_EARLY;
+    }
+    else if( ( ullNow - ullExpiryTime ) > ( uint64_t ) g_ui32FastTimerWorstLateness )
+    {
+        g_ui32FastTimerWorstLateness = ( uint32_t ) ( ullNow - ullExpiryTime );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicCallback( FastTimer_t *pxTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+    ( void ) pxHigherPriorityTaskWoken;
+
+    /* An auto reload timer has already been reloaded when its callback
+    runs. */
+    prvCheckExpiry( pxTimer->ullExpiryTime - ( uint64_t ) pxTimer->ulPeriod );
+    g_ui32FastTimerExpiries++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyCallback( FastTimer_t *pxTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+    prvCheckExpiry( pxTimer->ullExpiryTime );
+    vTaskNotifyGiveFromISR( ( TaskHandle_t ) pxTimer->pvParameter, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStoppedCallback( FastTimer_t *pxTimer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+    ( void ) pxTimer;
+    ( void ) pxHigherPriorityTaskWoken;
+
+    g_ui32FastTimerErrors |= mainERROR_STOP_IGNORED;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_FAST_TIMERS == 1 */
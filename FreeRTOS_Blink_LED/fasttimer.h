@@ -0,0 +1,257 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef FAST_TIMER_H
+#define FAST_TIMER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include fasttimer.h"
+#endif
+
+/******************************************************************************
+ *
+ * Fast timers.
+ *
+ * Software timers run their callbacks in the timer service task, so every
+ * expiry waits for that task to be scheduled, and is only resolved to a tick.
+ * Fast timers instead run their callbacks directly from the compare interrupt
+ * of the microsecond timebase (Wide Timer 5), and are timed in microseconds.
+ * They are intended for short actions that must happen at a precise time,
+ * such as toggling an output or kicking a watchdog.
+ *
+ * Up to configFAST_TIMER_MAX_ACTIVE fast timers can be active at once, and
+ * share the one compare.  Active fast timers are kept in a binary heap
+ * ordered by expiry time, and the compare is set to the expiry time of the
+ * first, alongside the wake time of any task blocked in
+ * xTaskDelayUntilMicroseconds().  Starting, stopping or expiring a fast timer
+ * therefore masks interrupts for a time that grows only with the logarithm of
+ * the number of active fast timers.
+ *
+ * Interrupt masking: fast timer callbacks always run with interrupts masked
+ * up to configMAX_SYSCALL_INTERRUPT_PRIORITY, the priority of the compare
+ * interrupt itself, and the mask is held from the first callback of an
+ * interrupt to the last.  A callback must not lower the mask.  Callbacks must
+ * therefore be short and may only use the interrupt safe ("FromISR") API.
+ * While a callback runs no other interrupt that uses the kernel can run, so
+ * the length of the longest callback adds directly to the worst case latency
+ * of every such interrupt, as well as delaying fast timers that expire after
+ * it.  Only interrupts above configMAX_SYSCALL_INTERRUPT_PRIORITY are
+ * unaffected.  Holding the mask means a callback can start or stop any fast
+ * timer, including its own, without another interrupt changing the timers
+ * between the callbacks.
+ *
+ * Set configUSE_FAST_TIMERS to 1 in FreeRTOSConfig.h to include fast timers.
+ * configUSE_MICROSECOND_TIMEBASE must also be 1.
+ *
+ *****************************************************************************/
+
+#ifndef configUSE_FAST_TIMERS
+	#define configUSE_FAST_TIMERS 0
+#endif
+
+/* The number of fast timers that can be active at the same time.  The heap of
+active timers holds one pointer for each. */
+#ifndef configFAST_TIMER_MAX_ACTIVE
+	#define configFAST_TIMER_MAX_ACTIVE 8
+#endif
+
+#if ( ( configUSE_FAST_TIMERS == 1 ) && ( configFAST_TIMER_MAX_ACTIVE < 1 ) )
+	#error configFAST_TIMER_MAX_ACTIVE must be at least 1.
+#endif
+
+#if ( ( configUSE_FAST_TIMERS == 1 ) && ( configUSE_MICROSECOND_TIMEBASE != 1 ) )
+	#error configUSE_MICROSECOND_TIMEBASE must be set to 1 in FreeRTOSConfig.h to use fast timers.
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct xFAST_TIMER;
+
+/**
+ * The prototype of a fast timer callback.  pxHigherPriorityTaskWoken is
+ * passed to any interrupt safe API function the callback uses, and a context
+ * switch is performed when the interrupt exits if it is set to pdTRUE.
+ */
+typedef void ( *FastTimerCallback_t )( struct xFAST_TIMER *pxTimer, BaseType_t *pxHigherPriorityTaskWoken );
+
+/**
+ * A fast timer.  Fast timers are allocated by the application, normally
+ * statically, and set up with vFastTimerInitialise().  The members are only
+ * accessed through the functions below:
+ * <pre>
+ static FastTimer_t xLedTimer;
+
+ static void prvLedCallback( FastTimer_t *pxTimer, BaseType_t *pxHigherPriorityTaskWoken )
+ {
+	 GPIO_PORTF_DATA_R ^= GPIO_PIN_1;
+ }
+
+ void vStartLed( void )
+ {
+	 vFastTimerInitialise( &xLedTimer, prvLedCallback, NULL );
+	 ( void ) xFastTimerStart( &xLedTimer, ullTaskGetMicroseconds() + 500ULL, 500UL );
+ }
+ </pre>
+ */
+typedef struct xFAST_TIMER
+{
+	UBaseType_t uxHeapIndex;			/*< The position of the timer in the heap of active fast timers plus one, or 0 if the timer is not active. */
+	uint64_t ullExpiryTime;				/*< The microsecond time at which the timer next expires. */
+	uint32_t ulPeriod;					/*< The reload period in microseconds, or 0 for a one-shot timer. */
+	FastTimerCallback_t pxCallback;		/*< The function called when the timer expires. */
+	void *pvParameter;					/*< An application defined value, available to the callback. */
+} FastTimer_t;
+
+/**
+ * fasttimer. h
+ * <pre>
+ void vFastTimerInitialise( FastTimer_t *pxTimer, FastTimerCallback_t pxCallback, void *pvParameter );
+ * </pre>
+ *
+ * Set up a fast timer.  The timer is created inactive.
+ *
+ * @param pxTimer The timer.  It must not be active.
+ *
+ * @param pxCallback The function called from the compare interrupt each time
+ * the timer expires.
+ *
+ * @param pvParameter A value stored in the pvParameter member of the timer,
+ * for use by the callback.
+ */
+void vFastTimerInitialise( FastTimer_t * const pxTimer, FastTimerCallback_t pxCallback, void * const pvParameter ) PRIVILEGED_FUNCTION;
+
+/**
+ * fasttimer. h
+ * <pre>
+ BaseType_t xFastTimerStart( FastTimer_t *pxTimer, uint64_t ullExpiryTime, uint32_t ulPeriod );
+ * </pre>
+ *
+ * Start a fast timer, or restart it if it is already active.  The timer
+ * expires when the microsecond timebase (see ullTaskGetMicroseconds())
+ * reaches ullExpiryTime, straight away if it already has.  An auto reload
+ * timer then expires every ulPeriod microseconds after ullExpiryTime, without
+ * accumulating the latency of the interrupt.  Can be called from tasks,
+ * interrupts and fast timer callbacks.  Timers started before the scheduler
+ * is started expire once the timebase has started.
+ *
+ * @param pxTimer The timer to start.
+ *
+ * @param ullExpiryTime The absolute time, in microseconds, at which the timer
+ * expires.
+ *
+ * @param ulPeriod The reload period in microseconds, or 0 for a timer that
+ * expires once.
+ *
+ * @return pdPASS if the timer was started, or pdFAIL if it was not already
+ * active and configFAST_TIMER_MAX_ACTIVE timers are already active.
+ */
+BaseType_t xFastTimerStart( FastTimer_t * const pxTimer, const uint64_t ullExpiryTime, const uint32_t ulPeriod ) PRIVILEGED_FUNCTION;
+
+/**
+ * fasttimer. h
+ * <pre>
+ void vFastTimerStop( FastTimer_t *pxTimer );
+ * </pre>
+ *
+ * Stop a fast timer.  Stopping a timer that is not active has no effect.
+ * Can be called from tasks, interrupts and fast timer callbacks.
+ *
+ * @param pxTimer The timer to stop.
+ */
+void vFastTimerStop( FastTimer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * fasttimer. h
+ * <pre>
+ BaseType_t xFastTimerIsActive( FastTimer_t *pxTimer );
+ * </pre>
+ *
+ * @return pdTRUE if the timer has been started and has not yet expired (or is
+ * an auto reload timer) and has not been stopped, otherwise pdFALSE.
+ */
+BaseType_t xFastTimerIsActive( FastTimer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * Called from the compare interrupt of the microsecond timebase to run the
+ * callbacks of the fast timers that have expired, and to set the compare for
+ * the next.  Returns pdTRUE if a callback woke a task that has a priority
+ * above the running task.
+ */
+BaseType_t xFastTimerAlarm( void ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAST_TIMER_H */
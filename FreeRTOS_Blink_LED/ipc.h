@@ -0,0 +1,233 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef IPC_H
+#define IPC_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include ipc.h"
+#endif
+
+#include "task_ext.h"
+
+#if ( configUSE_IPC == 1 )
+	#if ( configUSE_MUTEXES != 1 )
+		#error configUSE_MUTEXES must be set to 1 in FreeRTOSConfig.h to use IPC endpoints, as priority donation uses the priority inheritance mechanism.
+	#endif
+
+	#if ( INCLUDE_uxTaskPriorityGet != 1 )
+		#error INCLUDE_uxTaskPriorityGet must be set to 1 in FreeRTOSConfig.h to use IPC endpoints.
+	#endif
+#endif
+
+/******************************************************************************
+ *
+ * Synchronous call/reply IPC with directed handoff.
+ *
+ * A client task calls an endpoint and blocks until a server task replies.  If
+ * a server is already waiting on the endpoint the call is handed straight to
+ * it: the client's priority is donated to the server, and the next context
+ * switch goes directly to the server without searching the ready lists, so
+ * the server runs in what would otherwise have been the remainder of the
+ * client's time slice.  The reply works the same way in the other direction -
+ * the server's donated priority is returned and the switch goes directly back
+ * to the client.
+ *
+ * A directed switch is only ever made to a task that would also have been
+ * chosen by the normal task selection (the target is ready and no task of a
+ * higher priority is ready), so it never changes which priority level runs,
+ * only which task within that level.
+ *
+ * The request and reply are passed by reference, not copied.  The client's
+ * request remains valid until the call returns, as the client is blocked
+ * throughout.  Calls that arrive while no server is waiting are held in
+ * client priority order, and the server receiving a held call inherits the
+ * client's priority at that point.  A server should reply to each call before
+ * receiving the next one.  A client must not be deleted while it is in
+ * xIpcCall().
+ *
+ * Set configUSE_IPC to 1 in FreeRTOSConfig.h to use IPC endpoints.
+ *
+ *****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which IPC endpoints are referenced.  For example, a call to
+ * xIpcEndpointCreate() returns an IpcEndpointHandle_t variable that can then
+ * be used as a parameter to xIpcCall(), xIpcReceive(), etc.
+ */
+typedef void * IpcEndpointHandle_t;
+
+/**
+ * Type by which a call that has been received, but not yet replied to, is
+ * referenced.  Returned by xIpcReceive() and passed to vIpcReply().
+ */
+typedef void * IpcCallHandle_t;
+
+/**
+ * ipc. h
+ * <pre>
+ IpcEndpointHandle_t xIpcEndpointCreate( void );
+ * </pre>
+ *
+ * Creates a new IPC endpoint.
+ *
+ * @return If the endpoint is successfully created then a handle to the newly
+ * created endpoint is returned.  If the endpoint cannot be created then NULL
+ * is returned.
+ */
+IpcEndpointHandle_t xIpcEndpointCreate( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * ipc. h
+ * <pre>
+ BaseType_t xIpcCall( IpcEndpointHandle_t xEndpoint, void *pvRequest, void **ppvReply, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Send a request to a server and wait for its reply.
+ *
+ * @param xEndpoint The handle of the endpoint to call.
+ *
+ * @param pvRequest A pointer to the request.  It is passed to the server
+ * unchanged, and must remain valid until the call returns.
+ *
+ * @param ppvReply Set to the pointer passed to vIpcReply() by the server.  Can
+ * be NULL if the reply is not required.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a server to accept the call.  Once a server has accepted the
+ * call the task waits for the reply without a timeout.
+ *
+ * @return pdPASS if the server replied, or pdFAIL if no server accepted the
+ * call within xTicksToWait ticks.
+ */
+BaseType_t xIpcCall( IpcEndpointHandle_t xEndpoint, void *pvRequest, void **ppvReply, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * ipc. h
+ * <pre>
+ BaseType_t xIpcReceive( IpcEndpointHandle_t xEndpoint, void **ppvRequest, IpcCallHandle_t *pxCall, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Wait for a call on an endpoint.  On return the calling task runs at the
+ * priority of the client (if that is higher than its own) until it replies.
+ *
+ * @param xEndpoint The handle of the endpoint to receive a call on.
+ *
+ * @param ppvRequest Set to the request pointer passed to xIpcCall().
+ *
+ * @param pxCall Set to the handle that must be passed to vIpcReply() to
+ * complete the call.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a call.  The call will return immediately if this is set to 0
+ * and no call is waiting.
+ *
+ * @return pdPASS if a call was received, otherwise pdFAIL.
+ */
+BaseType_t xIpcReceive( IpcEndpointHandle_t xEndpoint, void **ppvRequest, IpcCallHandle_t *pxCall, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * ipc. h
+ * <pre>
+ void vIpcReply( IpcCallHandle_t xCall, void *pvReply );
+ * </pre>
+ *
+ * Complete a call received by xIpcReceive().  The client is unblocked, the
+ * priority donated by the client is returned, and the next context switch
+ * goes directly to the client if it is eligible to run.
+ *
+ * @param xCall The handle obtained from xIpcReceive().
+ *
+ * @param pvReply The pointer returned to the client through ppvReply.  Must
+ * remain valid for as long as the client uses it.
+ */
+void vIpcReply( IpcCallHandle_t xCall, void *pvReply ) PRIVILEGED_FUNCTION;
+
+/**
+ * ipc. h
+ * <pre>
+ void vIpcEndpointDelete( IpcEndpointHandle_t xEndpoint );
+ * </pre>
+ *
+ * Delete an endpoint, freeing the memory allocated to it.  No task may be
+ * blocked on the endpoint when it is deleted.
+ *
+ * @param xEndpoint The handle of the endpoint to delete.
+ */
+void vIpcEndpointDelete( IpcEndpointHandle_t xEndpoint ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IPC_H */
@@ -0,0 +1,244 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef LIGHTMUTEX_H
+#define LIGHTMUTEX_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include lightmutex.h"
+#endif
+
+#include "task_ext.h"
+
+#if ( ( configUSE_LIGHT_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 in FreeRTOSConfig.h to use lightweight mutexes.
+#endif
+
+/******************************************************************************
+ *
+ * Lightweight mutexes.
+ *
+ * The mutexes in semphr.h are implemented as queues, so even an uncontended
+ * take or give enters a critical section and runs through the generic queue
+ * send and receive paths.  A lightweight mutex records its holder in a single
+ * owner word that is claimed and released with an LDREX/STREX compare and swap
+ * (see port_ext.h).  A take that no other task is contending for neither
+ * masks interrupts nor suspends the scheduler.  An uncontended give only
+ * masks interrupts for the few instructions that update the count of held
+ * mutexes.
+ *
+ * The kernel is only entered when a task has to block because the mutex is
+ * held.  At that point the blocking task sets a bit in the owner word that
+ * forces the holder's give onto the slow path, and the holder inherits the
+ * priority of the blocking task in the same way as for a semphr.h mutex.
+ * Lightweight mutexes are counted in the same per task count of held mutexes
+ * as semphr.h mutexes, so the two types can be held together and an inherited
+ * priority is kept until the last mutex of either type is given back.  With
+ * configUSE_TRANSITIVE_PRIORITY_INHERITANCE set to 1 an inherited priority is
+ * also passed along chains of holders that include either type, and is given
+ * back along the chain when a waiting task times out, is suspended, or is
+ * deleted.
+ *
+ * As with semphr.h mutexes, lightweight mutexes cannot be used from
+ * interrupts.  If configUSE_RECURSIVE_MUTEXES is set to 1 in FreeRTOSConfig.h
+ * then a lightweight mutex can also be taken recursively using
+ * xLightMutexTakeRecursive() and xLightMutexGiveRecursive().
+ *
+ * Set configUSE_LIGHT_MUTEXES to 1 in FreeRTOSConfig.h to use lightweight
+ * mutexes.
+ *
+ *****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which lightweight mutexes are referenced.
+ */
+typedef void * LightMutexHandle_t;
+
+/**
+ * lightmutex. h
+ * <pre>
+ LightMutexHandle_t xLightMutexCreate( void );
+ * </pre>
+ *
+ * Creates a new lightweight mutex.  The mutex is created available.
+ *
+ * @return A handle to the created mutex, or NULL if the mutex could not be
+ * created.
+ */
+LightMutexHandle_t xLightMutexCreate( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightmutex. h
+ * <pre>
+ BaseType_t xLightMutexTake( LightMutexHandle_t xMutex, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Take a lightweight mutex.  If the mutex is available it is claimed without
+ * entering the kernel.  Otherwise the holder inherits the priority of the
+ * calling task, if that is higher, and the calling task blocks for up to
+ * xTicksToWait ticks for the mutex to be given.
+ *
+ * The task that holds the mutex must not take it again using this function -
+ * use xLightMutexTakeRecursive() instead.
+ *
+ * @param xMutex The handle of the mutex to take.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for the mutex.  The call will return immediately if this is set to
+ * 0 and the mutex is not available.
+ *
+ * @return pdTRUE if the mutex was taken, otherwise pdFALSE.
+ */
+BaseType_t xLightMutexTake( LightMutexHandle_t xMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightmutex. h
+ * <pre>
+ BaseType_t xLightMutexGive( LightMutexHandle_t xMutex );
+ * </pre>
+ *
+ * Give a lightweight mutex that was taken using xLightMutexTake().  If no task
+ * is blocked on the mutex it is released without entering the kernel.
+ * Otherwise the highest priority blocked task is unblocked, and any priority
+ * the calling task inherited is returned once it holds no other mutexes.
+ *
+ * @param xMutex The handle of the mutex to give.
+ *
+ * @return pdTRUE if the mutex was given, or pdFALSE if the calling task is
+ * not the holder of the mutex.
+ */
+BaseType_t xLightMutexGive( LightMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightmutex. h
+ * <pre>
+ BaseType_t xLightMutexTakeRecursive( LightMutexHandle_t xMutex, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Take a lightweight mutex that the calling task may already hold.  If the
+ * calling task is the holder the nesting count is incremented, otherwise the
+ * function behaves as xLightMutexTake().  The mutex is only made available
+ * again once xLightMutexGiveRecursive() has been called as many times as
+ * xLightMutexTakeRecursive() succeeded.
+ *
+ * configUSE_RECURSIVE_MUTEXES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @return pdTRUE if the mutex was taken, otherwise pdFALSE.
+ */
+BaseType_t xLightMutexTakeRecursive( LightMutexHandle_t xMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightmutex. h
+ * <pre>
+ BaseType_t xLightMutexGiveRecursive( LightMutexHandle_t xMutex );
+ * </pre>
+ *
+ * Give a lightweight mutex that was taken using xLightMutexTakeRecursive().
+ *
+ * configUSE_RECURSIVE_MUTEXES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @return pdTRUE if the mutex was given, or pdFALSE if the calling task is
+ * not the holder of the mutex.
+ */
+BaseType_t xLightMutexGiveRecursive( LightMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightmutex. h
+ * <pre>
+ TaskHandle_t xLightMutexGetHolder( LightMutexHandle_t xMutex );
+ * </pre>
+ *
+ * @return The handle of the task that holds the mutex, or NULL if the mutex
+ * is available.  The holder may change as soon as the function returns, so
+ * the value is only reliable when it is the calling task.
+ */
+TaskHandle_t xLightMutexGetHolder( LightMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightmutex. h
+ * <pre>
+ void vLightMutexDelete( LightMutexHandle_t xMutex );
+ * </pre>
+ *
+ * Delete a lightweight mutex.  The mutex must not be held, and no task may be
+ * blocked on it, when it is deleted.
+ */
+void vLightMutexDelete( LightMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIGHTMUTEX_H */
@@ -0,0 +1,244 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef LIGHTSEM_H
+#define LIGHTSEM_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include lightsem.h"
+#endif
+
+/******************************************************************************
+ *
+ * Lightweight semaphores.
+ *
+ * The semaphores in semphr.h are implemented as queues, so even an
+ * uncontended take or give enters a critical section and runs through the
+ * generic queue send and receive paths.  A lightweight semaphore keeps its
+ * count in a single word that is updated with an LDREX/STREX compare and swap
+ * (see port_ext.h), so an uncontended take or give neither masks interrupts
+ * nor suspends the scheduler.  The kernel is only entered when a task has to
+ * block because the count is zero, or when a give has to unblock a task.
+ *
+ * Tasks blocked on a lightweight semaphore are held in priority order, and an
+ * unblocked task re-attempts the take in the same way as a task unblocked from
+ * a queue, so a higher priority task may take the semaphore first.
+ *
+ * Lightweight semaphores cannot be used with queue sets or with the queue
+ * registry, and do not provide priority inheritance - use a mutex for mutual
+ * exclusion.
+ *
+ * Set configUSE_LIGHT_SEMAPHORES to 1 in FreeRTOSConfig.h to use lightweight
+ * semaphores.
+ *
+ *****************************************************************************/
+
+#ifndef configUSE_LIGHT_SEMAPHORES
+	#define configUSE_LIGHT_SEMAPHORES 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Type by which lightweight semaphores are referenced.
+ */
+typedef void * LightSemaphoreHandle_t;
+
+/**
+ * lightsem. h
+ * <pre>
+ LightSemaphoreHandle_t xLightSemaphoreCreateCounting( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount );
+ * </pre>
+ *
+ * Creates a new lightweight counting semaphore.
+ *
+ * @param uxMaxCount The maximum count value that can be reached.  Must not be
+ * more than 0x7fffffff, as the top bit of the count word is used to record
+ * that tasks are blocked on the semaphore.
+ *
+ * @param uxInitialCount The count value assigned to the semaphore when it is
+ * created.
+ *
+ * @return A handle to the created semaphore, or NULL if the semaphore could
+ * not be created.
+ */
+LightSemaphoreHandle_t xLightSemaphoreCreateCounting( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightsem. h
+ * <pre>
+ LightSemaphoreHandle_t xLightSemaphoreCreateBinary( void );
+ * </pre>
+ *
+ * Creates a new lightweight binary semaphore.  As with
+ * xSemaphoreCreateBinary(), the semaphore is created empty and must first be
+ * given before it can be taken.
+ */
+#define xLightSemaphoreCreateBinary() xLightSemaphoreCreateCounting( ( UBaseType_t ) 1, ( UBaseType_t ) 0 )
+
+/**
+ * lightsem. h
+ * <pre>
+ BaseType_t xLightSemaphoreTake( LightSemaphoreHandle_t xSemaphore, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Take a lightweight semaphore.  If the count is not zero it is decremented
+ * without entering the kernel.  Otherwise the calling task blocks for up to
+ * xTicksToWait ticks for the semaphore to be given.
+ *
+ * @param xSemaphore The handle of the semaphore to take.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for the semaphore.  The call will return immediately if this is set
+ * to 0 and the semaphore is not available.
+ *
+ * @return pdTRUE if the semaphore was taken, otherwise pdFALSE.
+ */
+BaseType_t xLightSemaphoreTake( LightSemaphoreHandle_t xSemaphore, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightsem. h
+ * <pre>
+ BaseType_t xLightSemaphoreTakeFromISR( LightSemaphoreHandle_t xSemaphore );
+ * </pre>
+ *
+ * A version of xLightSemaphoreTake() that can be called from an interrupt
+ * service routine.  The function never blocks.  As taking a semaphore never
+ * unblocks a task, there is no pxHigherPriorityTaskWoken parameter.
+ *
+ * @return pdTRUE if the semaphore was taken, otherwise pdFALSE.
+ */
+BaseType_t xLightSemaphoreTakeFromISR( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightsem. h
+ * <pre>
+ BaseType_t xLightSemaphoreGive( LightSemaphoreHandle_t xSemaphore );
+ * </pre>
+ *
+ * Give a lightweight semaphore.  If no task is blocked on the semaphore the
+ * count is incremented without entering the kernel.  Otherwise the count is
+ * incremented and the highest priority blocked task is unblocked.
+ *
+ * @param xSemaphore The handle of the semaphore to give.
+ *
+ * @return pdTRUE if the semaphore was given, or pdFALSE if the count was
+ * already at its maximum value.
+ */
+BaseType_t xLightSemaphoreGive( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightsem. h
+ * <pre>
+ BaseType_t xLightSemaphoreGiveFromISR( LightSemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * A version of xLightSemaphoreGive() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xSemaphore The handle of the semaphore to give.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if giving the semaphore
+ * unblocked a task with a priority higher than the currently running task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return pdTRUE if the semaphore was given, or pdFALSE if the count was
+ * already at its maximum value.
+ */
+BaseType_t xLightSemaphoreGiveFromISR( LightSemaphoreHandle_t xSemaphore, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightsem. h
+ * <pre>
+ UBaseType_t uxLightSemaphoreGetCount( LightSemaphoreHandle_t xSemaphore );
+ * </pre>
+ *
+ * @return The current count of the semaphore.
+ */
+UBaseType_t uxLightSemaphoreGetCount( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * lightsem. h
+ * <pre>
+ void vLightSemaphoreDelete( LightSemaphoreHandle_t xSemaphore );
+ * </pre>
+ *
+ * Delete a lightweight semaphore.  No task may be blocked on the semaphore
+ * when it is deleted.
+ */
+void vLightSemaphoreDelete( LightSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIGHTSEM_H */
@@ -74,6 +74,54 @@ static void prvSetupHardware( void );
 
 /* API to trigger the blinky task. */
 extern void vBlinkyTask( void );
+
+/* API to trigger the semaphore benchmark task. */
+extern void vSemBenchmarkTask( void );
+
+/* API to trigger the preemption threshold check tasks. */
+extern void vThresholdTask( void );
+
+/* API to trigger the earliest deadline first check tasks. */
+extern void vEdfTask( void );
+
+/* API to trigger the cyclic executive check tasks. */
+extern void vCyclicTask( void );
+
+/* API to trigger the execution budget check tasks. */
+extern void vBudgetTask( void );
+
+/* API to trigger the dynamic tick check task. */
+extern void vDynamicTickTask( void );
+
+/* API to trigger the microsecond delay check tasks. */
+extern void vMicrosecondTask( void );
+
+/* API to trigger the 64-bit tick count check task. */
+extern void vTickCount64Task( void );
+
+/* API to trigger the timing wheel check task. */
+extern void vTimerWheelTask( void );
+
+/* API to trigger the timer command coalescing check task. */
+extern void vTimerCoalescingTask( void );
+
+/* API to trigger the fast timer check task. */
+extern void vFastTimerTask( void );
+
+/* API to trigger the timer slack check task. */
+extern void vTimerSlackTask( void );
+
+/* API to trigger the timer service task check. */
+extern void vTimerServiceTask( void );
+
+/* API to trigger the co-routine check task. */
+extern void vCoRoutineTask( void );
+
+/* API to trigger the active object check task. */
+extern void vActiveObjectTask( void );
+
+/* API to trigger the basic task check. */
+extern void vBasicTask( void );
 /*-----------------------------------------------------------*/
 
 int main( void )
@@ -84,6 +132,86 @@ int main( void )
     /* Configure blinky task. */
     vBlinkyTask();
 
+#if ( configUSE_LIGHT_SEMAPHORES == 1 )
+    /* Compare the lightweight and queue based semaphores. */
+    vSemBenchmarkTask();
+#endif
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+    /* Check that a preemption threshold holds off the tasks below it. */
+    vThresholdTask();
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    /* Check that deadline scheduled tasks meet their deadlines. */
+    vEdfTask();
+#endif
+
+#if ( configUSE_CYCLIC_EXECUTIVE == 1 )
+    /* Check that the slots of the cyclic executive hold off other tasks. */
+    vCyclicTask();
+#endif
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+    /* Check that tasks are held to their execution budgets. */
+    vBudgetTask();
+#endif
+
+#if ( configUSE_DYNAMIC_TICK == 1 )
+    /* Check that the tick count keeps time while SysTick is suppressed. */
+    vDynamicTickTask();
+#endif
+
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+    /* Check that tasks delayed in microseconds wake on time. */
+    vMicrosecondTask();
+#endif
+
+#if ( ( configUSE_64_BIT_TICK_COUNT == 1 ) && ( configUSE_TIMERS == 1 ) )
+    /* Check the 64-bit tick count, delays and timers. */
+    vTickCount64Task();
+#endif
+
+#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 ) )
+    /* Check that timers in every level of the timing wheel expire on time. */
+    vTimerWheelTask();
+#endif
+
+#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_COMMAND_COALESCING == 1 ) )
+    /* Check that only the last of a burst of timer commands takes effect. */
+    vTimerCoalescingTask();
+#endif
+
+#if ( configUSE_FAST_TIMERS == 1 )
+    /* Check that fast timers expire on time from the compare interrupt. */
+    vFastTimerTask();
+#endif
+
+#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_SLACK == 1 ) )
+    /* Check that timers due together share a wake up without drifting. */
+    vTimerSlackTask();
+#endif
+
+#if ( ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) )
+    /* Check that a slow timer callback does not hold up other services. */
+    vTimerServiceTask();
+#endif
+
+#if ( ( configUSE_CO_ROUTINES != 0 ) && ( configUSE_EVENT_DRIVEN_CO_ROUTINES == 1 ) )
+    /* Check that co-routines are woken by timeouts, notifications and tasks. */
+    vCoRoutineTask();
+#endif
+
+#if ( configUSE_ACTIVE_OBJECTS == 1 )
+    /* Check that published events reach each active object in order. */
+    vActiveObjectTask();
+#endif
+
+#if ( configUSE_BASIC_TASKS == 1 )
+    /* Check that basic tasks nest on the shared stack in priority order. */
+    vBasicTask();
+#endif
+
     /* Start the tasks running. */
     vTaskStartScheduler();
 
@@ -0,0 +1,260 @@
+/*
+ * microsecond_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the microsecond timebase and xTaskDelayUntilMicroseconds().
+ *
+ * vMicrosecondTask() creates mainMICROSECOND_TASKS tasks that each run with
+ * a different period shorter than a tick, so their wake times interleave in
+ * the list of blocked tasks.  Each time one wakes it checks that it was not
+ * woken before its wake time, and records how late it was.  A release that is
+ * already due when the task delays is counted in g_ui32MicrosecondOverruns,
+ * and the task starts again from the current time.
+ *
+ * A check task makes sure every periodic task keeps running, that the
+ * timebase advances with the tick count, and that a wake time that has
+ * already passed does not block.
+ *
+ * A check that fails sets a bit in g_ui32MicrosecondErrors, and
+ * g_ui32MicrosecondChecks counts the completed checks.  The latest any task
+ * has woken, in microseconds, is kept in g_ui32MicrosecondWorstLateness.  All
+ * can be read with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when the microsecond timebase is included. */
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+/*
+ * The priorities of the tasks.  The check task runs above the periodic
+ * tasks.
+ */
+#define mainMICROSECOND_PRIORITY            ( tskIDLE_PRIORITY + 5 )
+#define mainMICROSECOND_CHECK_PRIORITY      ( tskIDLE_PRIORITY + 6 )
+
+/*
+ * The rate at which the check task runs.
+ */
+#define mainMICROSECOND_CHECK_PERIOD        ( pdMS_TO_TICKS( 100UL ) )
+
+/*
+ * The number of periodic tasks.
+ */
+#define mainMICROSECOND_TASKS               ( 3 )
+
+/*
+ * The difference allowed between the microseconds and the ticks that pass
+ * between two checks, as a tick count read can be up to a tick behind.
+ */
+#define mainMICROSECOND_PER_TICK            ( 1000000ULL / ( uint64_t ) configTICK_RATE_HZ )
+#define mainMICROSECOND_TOLERANCE           ( 2ULL * mainMICROSECOND_PER_TICK )
+
+/*
+ * Bits set in g_ui32MicrosecondErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_WOKEN_EARLY               ( 1UL << 1UL )
+#define mainERROR_STALLED                   ( 1UL << 2UL )
+#define mainERROR_DRIFT                     ( 1UL << 3UL )
+#define mainERROR_PAST_WAKE_TIME            ( 1UL << 4UL )
+
+/*
+ * Results of the checks, written by the tasks.
+ */
+volatile uint32_t g_ui32MicrosecondErrors = 0;
+volatile uint32_t g_ui32MicrosecondChecks = 0;
+volatile uint32_t g_ui32MicrosecondOverruns = 0;
+volatile uint32_t g_ui32MicrosecondWorstLateness = 0;
+volatile uint32_t g_ui32MicrosecondReleases[ mainMICROSECOND_TASKS ] = { 0 };
+
+/*
+ * The period of each periodic task, in microseconds.
+ */
+static const uint64_t ullMicrosecondPeriods[ mainMICROSECOND_TASKS ] =
+{
+    250ULL, 400ULL, 700ULL
+};
+
+/*
+ * The tasks as described in the comments at the top of this file.  The
+ * periodic tasks share an implementation, and are passed their index into
+ * the array above.
+ */
+static void prvMicrosecondCheckTask( void *pvParameters );
+static void prvMicrosecondTask( void *pvParameters );
+
+/*
+ * Called by main() to create the tasks.
+ */
+void vMicrosecondTask( void );
+/*-----------------------------------------------------------*/
+
+void vMicrosecondTask( void )
+{
+uint32_t ui32Task;
+
+    for( ui32Task = 0; ui32Task < mainMICROSECOND_TASKS; ui32Task++ )
+    {
+        if( xTaskCreate( prvMicrosecondTask,
+                         "Micro",
+                         configMINIMAL_STACK_SIZE,
+                         ( void * ) ui32Task,
+                         mainMICROSECOND_PRIORITY,
+                         NULL ) != pdPASS )
+        {
+            g_ui32MicrosecondErrors |= mainERROR_CREATE;
+        }
+    }
+
+    if( xTaskCreate( prvMicrosecondCheckTask,
+                     "MicroChk",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainMICROSECOND_CHECK_PRIORITY,
+                     NULL ) != pdPASS )
+    {
+        g_ui32MicrosecondErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvMicrosecondTask( void *pvParameters )
+{
+const uint32_t ui32Task = ( uint32_t ) pvParameters;
+uint64_t ullWakeTime, ullNow;
+
+    ullWakeTime = ullTaskGetMicroseconds();
+
+    for( ;; )
+    {
+        ullWakeTime += ullMicrosecondPeriods[ ui32Task ];
+
+        if( xTaskDelayUntilMicroseconds( ullWakeTime ) == pdFALSE )
+        {
+            /* Higher priority tasks held this one off for a whole period.
+            Start again from now rather than trying to catch up. */
+            g_ui32MicrosecondOverruns++;
+            ullWakeTime = ullTaskGetMicroseconds();
+        }
+        else
+        {
+            ullNow = ullTaskGetMicroseconds();
+
+            if( ullNow < ullWakeTime )
+            {
+                g_ui32MicrosecondErrors |= mainERROR_WOKEN_EARLY;
+            }
+            else if( ( ullNow - ullWakeTime ) > ( uint64_t ) g_ui32MicrosecondWorstLateness )
+            {
+                g_ui32MicrosecondWorstLateness = ( uint32_t ) ( ullNow - ullWakeTime );
+            }
+        }
+
+        g_ui32MicrosecondReleases[ ui32Task ]++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvMicrosecondCheckTask( void *pvParameters )
+{
+uint32_t ui32LastReleases[ mainMICROSECOND_TASKS ] = { 0 };
+TickType_t xLastWakeTime, xLastTicks, xTicks;
+uint64_t ullLastMicroseconds, ullMicroseconds, ullTickMicroseconds;
+uint32_t ui32Task;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+    xLastTicks = xLastWakeTime;
+    ullLastMicroseconds = ullTaskGetMicroseconds();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainMICROSECOND_CHECK_PERIOD );
+
+        /* Each periodic task must have run since the last check. */
+        for( ui32Task = 0; ui32Task < mainMICROSECOND_TASKS; ui32Task++ )
+        {
+            if( g_ui32MicrosecondReleases[ ui32Task ] == ui32LastReleases[ ui32Task ] )
+            {
+                g_ui32MicrosecondErrors |= mainERROR_STALLED;
+            }
+
+            ui32LastReleases[ ui32Task ] = g_ui32MicrosecondReleases[ ui32Task ];
+        }
+
+        /* The timebase must keep time with the tick count.  The two are read
+        together so neither can move on between them. */
+        taskENTER_CRITICAL();
+        {
+            xTicks = xTaskGetTickCount();
+            ullMicroseconds = ullTaskGetMicroseconds();
+        }
+        taskEXIT_CRITICAL();
+
+        ullTickMicroseconds = ( uint64_t ) ( xTicks - xLastTicks ) * mainMICROSECOND_PER_TICK;
+
+        if( ( ( ullMicroseconds - ullLastMicroseconds ) + mainMICROSECOND_TOLERANCE < ullTickMicroseconds ) ||
+            ( ( ullMicroseconds - ullLastMicroseconds ) > ullTickMicroseconds + mainMICROSECOND_TOLERANCE ) )
+        {
+            g_ui32MicrosecondErrors |= mainERROR_DRIFT;
+        }
+
+        xLastTicks = xTicks;
+        ullLastMicroseconds = ullMicroseconds;
+
+        /* A wake time that has passed returns straight away. */
+        if( xTaskDelayUntilMicroseconds( ullMicroseconds ) != pdFALSE )
+        {
+            g_ui32MicrosecondErrors |= mainERROR_PAST_WAKE_TIME;
+        }
+
+        g_ui32MicrosecondChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_MICROSECOND_TIMEBASE == 1 */
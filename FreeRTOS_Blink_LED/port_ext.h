@@ -0,0 +1,160 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef PORT_EXT_H
+#define PORT_EXT_H
+
+/******************************************************************************
+ *
+ * Extensions to the port layer that are built into the copy of portasm.asm
+ * held in this project.  The portmacro.h header used by the build comes from
+ * the TivaWare installation, so the prototypes for the additional functions
+ * are kept here rather than in portmacro.h.
+ *
+ *****************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Atomically replace the word at pulDestination with ulNewValue, but only if
+ * it currently holds ulExpectedValue.  Implemented with LDREX/STREX, so it
+ * neither masks interrupts nor disables the scheduler, and can be used from
+ * tasks and from interrupts of any priority.
+ *
+ * Returns the value that the word held.  The swap was performed if, and only
+ * if, the returned value equals ulExpectedValue.
+ */
+uint32_t ulPortAtomicCompareAndSwap( volatile uint32_t *pulDestination, uint32_t ulExpectedValue, uint32_t ulNewValue );
+
+/*
+ * Access to the DWT cycle counter, which counts processor clock cycles and
+ * wraps every 2^32 cycles (about 53 seconds at 80MHz).  Differences between
+ * two readings are correct across a wrap provided they are calculated using
+ * unsigned 32-bit arithmetic.  portENABLE_CYCLE_COUNTER() can be called more
+ * than once, and does not reset the count.
+ */
+#define portDEMCR_REG					( * ( ( volatile uint32_t * ) 0xE000EDFC ) )
+#define portDWT_CTRL_REG				( * ( ( volatile uint32_t * ) 0xE0001000 ) )
+#define portDWT_CYCCNT_REG				( * ( ( volatile uint32_t * ) 0xE0001004 ) )
+#define portDEMCR_TRCENA_BIT			( 1UL << 24UL )
+#define portDWT_CYCCNTENA_BIT			( 1UL << 0UL )
+
+#define portENABLE_CYCLE_COUNTER()						\
+{														\
+	portDEMCR_REG |= portDEMCR_TRCENA_BIT;				\
+	portDWT_CTRL_REG |= portDWT_CYCCNTENA_BIT;			\
+}
+
+#define portGET_CYCLE_COUNT()			( portDWT_CYCCNT_REG )
+
+/*
+ * Used by the kernel when configUSE_DYNAMIC_TICK is 1.  The SysTick is then
+ * set to interrupt after as many ticks as the kernel can go without doing
+ * anything, rather than after a single tick.  Time is measured with the cycle
+ * counter, which the port enables, so the tick count keeps to the processor
+ * clock however often the SysTick is reprogrammed.
+ *
+ * vPortDynamicTickSync() tells the kernel about the whole tick periods that
+ * have passed since the start of the current SysTick period, so the tick
+ * count can be read part way through it.  vPortDynamicTickUpdate() asks the
+ * kernel when the next event is due, and ends the current SysTick period
+ * then if that is not already the case.  Both can be called from any context.
+ */
+void vPortDynamicTickSync( void );
+void vPortDynamicTickUpdate( void );
+
+/*
+ * Used by the kernel when configUSE_MICROSECOND_TIMEBASE is 1.  Wide Timer 5
+ * is concatenated into a 64-bit timer that counts up at the processor clock
+ * from when the scheduler is started.
+ *
+ * ullPortGetMicroseconds() returns the count converted to microseconds, or 0
+ * before the timer is started.  vPortSetMicrosecondAlarm() arranges for
+ * xPortMicrosecondTimerHandler() to run when the count reaches ullMicroseconds,
+ * or straight away if it already has.  Passing portMICROSECOND_NO_ALARM
+ * cancels the alarm.  Both can be called from any context.
+ *
+ * vPortSetFastTimerAlarm() sets a second alarm, used by the fast timers when
+ * configUSE_FAST_TIMERS is 1.  The match register is set to the earlier of the
+ * two alarms, and the handler only calls the owner of an alarm that is due.
+ */
+#define portMICROSECOND_NO_ALARM		( ( uint64_t ) 0xffffffffffffffffULL )
+
+uint64_t ullPortGetMicroseconds( void );
+void vPortSetMicrosecondAlarm( uint64_t ullMicroseconds );
+void vPortSetFastTimerAlarm( uint64_t ullMicroseconds );
+void xPortMicrosecondTimerHandler( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORT_EXT_H */
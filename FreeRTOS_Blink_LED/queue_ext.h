@@ -0,0 +1,253 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef QUEUE_EXT_H
+#define QUEUE_EXT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include queue_ext.h"
+#endif
+
+#include "queue.h"
+
+/******************************************************************************
+ *
+ * Extensions to the queue API that are built into the copy of queue.c held
+ * in this project.  The queue.h header used by the build comes from the
+ * TivaWare installation, so the prototypes for the additional functions are
+ * kept here rather than in queue.h.
+ *
+ *****************************************************************************/
+
+/* Set configUSE_QUEUE_MULTIPLE to 1 in FreeRTOSConfig.h to include the batched
+send and receive functions. */
+#ifndef configUSE_QUEUE_MULTIPLE
+	#define configUSE_QUEUE_MULTIPLE 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * queue_ext. h
+ * <pre>
+ BaseType_t xQueueSendMultiple(
+								QueueHandle_t xQueue,
+								const void *pvItemsToQueue,
+								UBaseType_t uxItemCount,
+								TickType_t xTicksToWait
+							);
+ * </pre>
+ *
+ * Post up to uxItemCount items to the back of a queue.  The items are stored
+ * contiguously in pvItemsToQueue, each being the item size the queue was
+ * created with.
+ *
+ * All the items that fit in the queue are copied within a single critical
+ * section using at most two memcpy() calls (one either side of the point at
+ * which the queue storage area wraps), and the decision on whether a context
+ * switch is required is made once for the whole batch rather than once per
+ * item.  If the queue is full on entry the calling task will block for up to
+ * xTicksToWait ticks for space to become available, after which as many items
+ * as will then fit are posted.
+ *
+ * This function must not be called from an interrupt service routine, and
+ * must not be used on a semaphore or mutex.  See xQueueSendMultipleFromISR()
+ * for an alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to the first of the items that are to be
+ * placed on the queue.
+ *
+ * @param uxItemCount The number of items available in pvItemsToQueue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it already be
+ * full.  The call will return immediately if this is set to 0.
+ *
+ * @return The number of items that were posted, starting from the first
+ * item in pvItemsToQueue.  0 is returned if the queue remained full for the
+ * entire block time.
+ */
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue_ext. h
+ * <pre>
+ BaseType_t xQueueReceiveMultiple(
+								QueueHandle_t xQueue,
+								void *pvBuffer,
+								UBaseType_t uxMaxItems,
+								TickType_t xTicksToWait
+							);
+ * </pre>
+ *
+ * Receive up to uxMaxItems items from a queue.  The items are removed from
+ * the queue in the order they were posted and written contiguously into
+ * pvBuffer.
+ *
+ * As with xQueueSendMultiple(), the copy is performed within a single
+ * critical section using at most two memcpy() calls, and any tasks that were
+ * blocked waiting for space on the queue are unblocked with a single context
+ * switch decision.  If the queue is empty on entry the calling task will block
+ * for up to xTicksToWait ticks for data to become available, after which as
+ * many items as are then available (up to uxMaxItems) are received.
+ *
+ * This function must not be called from an interrupt service routine, and
+ * must not be used on a semaphore or mutex.  See xQueueReceiveMultipleFromISR()
+ * for an alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will
+ * be copied.  The buffer must be large enough to hold uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty at the time of the
+ * call.  The call will return immediately if this is set to 0.
+ *
+ * @return The number of items that were received.  0 is returned if the
+ * queue remained empty for the entire block time.
+ */
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue_ext. h
+ * <pre>
+ BaseType_t xQueueSendMultipleFromISR(
+										QueueHandle_t xQueue,
+										const void *pvItemsToQueue,
+										UBaseType_t uxItemCount,
+										BaseType_t *pxHigherPriorityTaskWoken
+									);
+ * </pre>
+ *
+ * A version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine.  The function never blocks, so only the items for which
+ * there is space at the time of the call are posted.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to the first of the items that are to be
+ * placed on the queue.
+ *
+ * @param uxItemCount The number of items available in pvItemsToQueue.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if posting the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.  If xQueueSendMultipleFromISR() sets this value to pdTRUE
+ * then a context switch should be requested before the interrupt is exited.
+ *
+ * @return The number of items that were posted.
+ */
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue_ext. h
+ * <pre>
+ BaseType_t xQueueReceiveMultipleFromISR(
+											QueueHandle_t xQueue,
+											void *pvBuffer,
+											UBaseType_t uxMaxItems,
+											BaseType_t *pxHigherPriorityTaskWoken
+										);
+ * </pre>
+ *
+ * A version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine.  The function never blocks, so only the items that are in
+ * the queue at the time of the call are received.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will
+ * be copied.  The buffer must be large enough to hold uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken A task may be blocked waiting for space to
+ * become available on the queue.  If xQueueReceiveMultipleFromISR() causes
+ * such a task to unblock *pxHigherPriorityTaskWoken will get set to pdTRUE,
+ * otherwise *pxHigherPriorityTaskWoken will remain unchanged.
+ *
+ * @return The number of items that were received.
+ */
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_EXT_H */
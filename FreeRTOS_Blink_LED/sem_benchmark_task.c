@@ -0,0 +1,164 @@
+/*
+ * sem_benchmark_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/******************************************************************************
+ *
+ * This file measures the cost of the lightweight semaphores in lightsem.c
+ * against the queue based semaphores in semphr.h.
+ *
+ * vSemBenchmarkTask() creates one task, which runs once at start up before
+ * the blinky tasks and then deletes itself.  The task takes and gives a binary
+ * semaphore of each type mainBENCHMARK_ITERATIONS times without contention,
+ * and counts the processor cycles used with the DWT cycle counter.  The
+ * average number of cycles for one take/give pair of each semaphore type is
+ * left in g_ui32QueueSemaphoreCycles and g_ui32LightSemaphoreCycles, where it
+ * can be read with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "lightsem.h"
+/*-----------------------------------------------------------*/
+
+/* The benchmark is only built when lightweight semaphores are included. */
+#if ( configUSE_LIGHT_SEMAPHORES == 1 )
+
+/*
+ * The benchmark task runs above the blinky tasks so it is not interrupted by
+ * them.
+ */
+#define mainBENCHMARK_TASK_PRIORITY         ( tskIDLE_PRIORITY + 3 )
+
+/*
+ * The number of take/give pairs timed for each semaphore type.
+ */
+#define mainBENCHMARK_ITERATIONS            ( 1000UL )
+
+/*
+ * DWT registers used to count processor cycles.
+ */
+#define mainDEMCR_REG                       ( * ( ( volatile uint32_t * ) 0xE000EDFC ) )
+#define mainDWT_CTRL_REG                    ( * ( ( volatile uint32_t * ) 0xE0001000 ) )
+#define mainDWT_CYCCNT_REG                  ( * ( ( volatile uint32_t * ) 0xE0001004 ) )
+#define mainDEMCR_TRCENA_BIT                ( 1UL << 24UL )
+#define mainDWT_CYCCNTENA_BIT               ( 1UL << 0UL )
+
+/*
+ * Average cycles per take/give pair, written by the benchmark task.
+ */
+volatile uint32_t g_ui32QueueSemaphoreCycles = 0;
+volatile uint32_t g_ui32LightSemaphoreCycles = 0;
+
+/*
+ * The task as described in the comments at the top of this file.
+ */
+static void prvSemBenchmarkTask( void *pvParameters );
+
+/*
+ * Called by main() to create the benchmark task.
+ */
+void vSemBenchmarkTask( void );
+/*-----------------------------------------------------------*/
+
+void vSemBenchmarkTask( void )
+{
+    xTaskCreate( prvSemBenchmarkTask,
+                 "Bench",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainBENCHMARK_TASK_PRIORITY,
+                 NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSemBenchmarkTask( void *pvParameters )
+{
+SemaphoreHandle_t xQueueSemaphore;
+LightSemaphoreHandle_t xLightSemaphore;
+uint32_t ui32Start, ui32Iteration;
+
+    ( void ) pvParameters;
+
+    /* Start the cycle counter.  It is left running and is not cleared, as
+    the counts are only ever subtracted. */
+    mainDEMCR_REG |= mainDEMCR_TRCENA_BIT;
+    mainDWT_CTRL_REG |= mainDWT_CYCCNTENA_BIT;
+
+    xQueueSemaphore = xSemaphoreCreateBinary();
+    xLightSemaphore = xLightSemaphoreCreateBinary();
+
+    if( ( xQueueSemaphore != NULL ) && ( xLightSemaphore != NULL ) )
+    {
+        /* Time the queue based semaphore.  Nothing else is waiting on the
+        semaphore, so neither call blocks. */
+        ui32Start = mainDWT_CYCCNT_REG;
+
+        for( ui32Iteration = 0; ui32Iteration < mainBENCHMARK_ITERATIONS; ui32Iteration++ )
+        {
+            xSemaphoreGive( xQueueSemaphore );
+            xSemaphoreTake( xQueueSemaphore, 0 );
+        }
+
+        g_ui32QueueSemaphoreCycles = ( mainDWT_CYCCNT_REG - ui32Start ) / mainBENCHMARK_ITERATIONS;
+
+        /* Time the lightweight semaphore in the same way. */
+        ui32Start = mainDWT_CYCCNT_REG;
+
+        for( ui32Iteration = 0; ui32Iteration < mainBENCHMARK_ITERATIONS; ui32Iteration++ )
+        {
+            xLightSemaphoreGive( xLightSemaphore );
+            xLightSemaphoreTake( xLightSemaphore, 0 );
+        }
+
+        g_ui32LightSemaphoreCycles = ( mainDWT_CYCCNT_REG - ui32Start ) / mainBENCHMARK_ITERATIONS;
+
+        vSemaphoreDelete( xQueueSemaphore );
+        vLightSemaphoreDelete( xLightSemaphore );
+    }
+
+    /* The benchmark only runs once. */
+    vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_LIGHT_SEMAPHORES == 1 */
@@ -0,0 +1,912 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef TASK_EXT_H
+#define TASK_EXT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include task_ext.h"
+#endif
+
+#include "task.h"
+
+/******************************************************************************
+ *
+ * Extensions to the task API that are built into the copy of tasks.c held
+ * in this project.  The task.h header used by the build comes from the
+ * TivaWare installation, so the prototypes for the additional functions are
+ * kept here rather than in task.h.
+ *
+ * The configuration options that change the layout of the task control block
+ * are given default values here, so every file that includes this header sees
+ * the same TCB configuration.
+ *
+ *****************************************************************************/
+
+/* Set configUSE_CHANNELS to 1 in FreeRTOSConfig.h to include the unbuffered
+channel implementation in channel.c. */
+#ifndef configUSE_CHANNELS
+	#define configUSE_CHANNELS 0
+#endif
+
+/* Set configUSE_IPC to 1 in FreeRTOSConfig.h to include the synchronous
+call/reply IPC implementation in ipc.c. */
+#ifndef configUSE_IPC
+	#define configUSE_IPC 0
+#endif
+
+/* Set configUSE_LIGHT_MUTEXES to 1 in FreeRTOSConfig.h to include the
+lightweight mutex implementation in lightmutex.c. */
+#ifndef configUSE_LIGHT_MUTEXES
+	#define configUSE_LIGHT_MUTEXES 0
+#endif
+
+/* Set configUSE_TRANSITIVE_PRIORITY_INHERITANCE to 1 in FreeRTOSConfig.h to
+pass an inherited priority along a chain of semphr.h mutex holders, where the
+holder of one mutex is blocked waiting for another, and to lower an inherited
+priority again when a waiting task times out or is deleted.
+configMAX_PRIORITY_INHERITANCE_DEPTH limits the number of holders visited, and
+so the length of the critical section. */
+#ifndef configUSE_TRANSITIVE_PRIORITY_INHERITANCE
+	#define configUSE_TRANSITIVE_PRIORITY_INHERITANCE 0
+#endif
+
+#ifndef configMAX_PRIORITY_INHERITANCE_DEPTH
+	#define configMAX_PRIORITY_INHERITANCE_DEPTH 4
+#endif
+
+/* Set configUSE_CEILING_MUTEXES to 1 in FreeRTOSConfig.h to include the
+priority ceiling mutex implementation in ceilmutex.c. */
+#ifndef configUSE_CEILING_MUTEXES
+	#define configUSE_CEILING_MUTEXES 0
+#endif
+
+/* Set configUSE_PREEMPTION_THRESHOLD to 1 in FreeRTOSConfig.h to give each
+task a preemption threshold.  See vTaskPreemptionThresholdSet(). */
+#ifndef configUSE_PREEMPTION_THRESHOLD
+	#define configUSE_PREEMPTION_THRESHOLD 0
+#endif
+
+/* Set configUSE_EDF_SCHEDULING to 1 in FreeRTOSConfig.h to schedule the tasks
+of priority configEDF_TASK_PRIORITY earliest deadline first.  Tasks of a higher
+priority still preempt them, and tasks of a lower priority only run when none
+of them is ready.  See xTaskDelayUntilWithDeadline(). */
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING 0
+#endif
+
+#ifndef configEDF_TASK_PRIORITY
+	#define configEDF_TASK_PRIORITY ( tskIDLE_PRIORITY + 1 )
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULING == 1 ) && ( configUSE_16_BIT_TICKS == 1 ) )
+	#error configUSE_EDF_SCHEDULING requires configUSE_16_BIT_TICKS to be 0.
+#endif
+
+/* Set configUSE_TASK_BUDGETS to 1 in FreeRTOSConfig.h to give tasks an
+execution budget, measured in CPU cycles, that is replenished after a fixed
+period.  A task that exhausts its budget is demoted to
+configBUDGET_DEMOTED_PRIORITY or suspended until the budget is replenished.
+See vTaskBudgetSet(). */
+#ifndef configUSE_TASK_BUDGETS
+	#define configUSE_TASK_BUDGETS 0
+#endif
+
+#ifndef configBUDGET_DEMOTED_PRIORITY
+	#define configBUDGET_DEMOTED_PRIORITY tskIDLE_PRIORITY
+#endif
+
+#if ( ( configUSE_TASK_BUDGETS == 1 ) && ( INCLUDE_vTaskSuspend != 1 ) )
+	#error configUSE_TASK_BUDGETS requires INCLUDE_vTaskSuspend to be 1.
+#endif
+
+#if ( ( configUSE_TASK_BUDGETS == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_TASK_BUDGETS requires configUSE_MUTEXES to be 1.
+#endif
+
+/* Set configUSE_TIMING_MONITOR to 1 in FreeRTOSConfig.h to record the release
+jitter and response time of each period completed by a task that uses
+vTaskDelayUntil().  See vTaskGetTimingStatus(). */
+#ifndef configUSE_TIMING_MONITOR
+	#define configUSE_TIMING_MONITOR 0
+#endif
+
+#ifndef configTIMING_HISTOGRAM_BUCKETS
+	#define configTIMING_HISTOGRAM_BUCKETS 8
+#endif
+
+#if ( ( configUSE_TIMING_MONITOR == 1 ) && ( configTIMING_HISTOGRAM_BUCKETS < 2 ) )
+	#error configTIMING_HISTOGRAM_BUCKETS must be at least 2.
+#endif
+
+/* Set configUSE_DYNAMIC_TICK to 1 in FreeRTOSConfig.h to only generate a tick
+interrupt when the kernel has something to do - a task to unblock, tasks to
+time slice, a budget to enforce or replenish, or a cyclic executive slot to
+start - whichever task is running.  The tick count is brought up to date
+whenever it is read.  The dynamic tick replaces configUSE_TICKLESS_IDLE, and
+the tick hook is called once per tick interrupt rather than once per tick. */
+#ifndef configUSE_DYNAMIC_TICK
+	#define configUSE_DYNAMIC_TICK 0
+#endif
+
+#if ( ( configUSE_DYNAMIC_TICK == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) )
+	#error configUSE_DYNAMIC_TICK and configUSE_TICKLESS_IDLE cannot both be used.
+#endif
+
+/* Set configUSE_MICROSECOND_TIMEBASE to 1 in FreeRTOSConfig.h to run a 64-bit
+microsecond timebase on Wide Timer 5, and to include
+xTaskDelayUntilMicroseconds().  xPortMicrosecondTimerHandler() is then
+installed as the Wide Timer 5 subtimer A interrupt handler. */
+#ifndef configUSE_MICROSECOND_TIMEBASE
+	#define configUSE_MICROSECOND_TIMEBASE 0
+#endif
+
+/* Set configUSE_64_BIT_TICK_COUNT to 1 in FreeRTOSConfig.h to extend the tick
+count to 64 bits inside the kernel.  Wake times and timer expiry times then
+never overflow, so the delayed task list and the active timer list are not
+doubled up and switched when the 32-bit tick count wraps.  TickType_t, and so
+the API, remain 32-bit.  Tickless idle works on the 32-bit count, so use
+configUSE_DYNAMIC_TICK with this option instead. */
+#ifndef configUSE_64_BIT_TICK_COUNT
+	#define configUSE_64_BIT_TICK_COUNT 0
+#endif
+
+#if ( ( configUSE_64_BIT_TICK_COUNT == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) )
+	#error configUSE_64_BIT_TICK_COUNT cannot be used with configUSE_TICKLESS_IDLE.
+#endif
+
+/* Set configUSE_BATCHED_PENDED_TICKS to 1 in FreeRTOSConfig.h to have
+xTaskResumeAll() step the tick count over the ticks that were pended while the
+scheduler was suspended and check the delayed list once, instead of processing
+each pended tick in turn. */
+#ifndef configUSE_BATCHED_PENDED_TICKS
+	#define configUSE_BATCHED_PENDED_TICKS 0
+#endif
+
+/* Set configUSE_BASIC_TASKS to 1 in FreeRTOSConfig.h to include basic tasks,
+which run to completion on a single stack of configBASIC_TASK_STACK_SIZE words
+that they all share.  See xTaskCreateBasic(). */
+#ifndef configUSE_BASIC_TASKS
+	#define configUSE_BASIC_TASKS 0
+#endif
+
+#ifndef configBASIC_TASK_STACK_SIZE
+	#define configBASIC_TASK_STACK_SIZE ( configMINIMAL_STACK_SIZE * 2 )
+#endif
+
+#if ( ( configUSE_BASIC_TASKS == 1 ) && ( ( portSTACK_GROWTH > 0 ) || ( portUSING_MPU_WRAPPERS == 1 ) ) )
+	#error configUSE_BASIC_TASKS requires a port with a descending stack and no MPU.
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* What is done to a task when it exhausts its execution budget. */
+typedef enum
+{
+	eBudgetDemote = 0,	/* The task runs at configBUDGET_DEMOTED_PRIORITY until its budget is replenished. */
+	eBudgetSuspend		/* The task is suspended until its budget is replenished. */
+} eBudgetAction;
+
+/* Used with vTaskBudgetGetStatus() to obtain the budget state of a task. */
+typedef struct xTASK_BUDGET_STATUS
+{
+	uint32_t ulBudgetCycles;	/* The budget of the task, or 0 if it has no budget. */
+	uint32_t ulRemainingCycles;	/* The part of the budget that has not yet been used. */
+	uint32_t ulExhaustions;		/* The number of times the task has exhausted its budget. */
+	BaseType_t xEnforced;		/* pdTRUE if the task is currently demoted or suspended. */
+} TaskBudgetStatus_t;
+
+/* Used with vTaskGetTimingStatus() to obtain the timing statistics of a task.
+All times are in CPU cycles, and are measured from the tick at which each
+period of the task was released. */
+typedef struct xTASK_TIMING_STATUS
+{
+	uint32_t ulCompletions;			/* The number of periods completed by calling vTaskDelayUntil(). */
+	uint32_t ulOverruns;			/* The number of periods that completed after the next period was due to be released. */
+	uint32_t ulPeriodCycles;		/* The period passed to the most recent call to vTaskDelayUntil(). */
+	uint32_t ulLastJitterCycles;	/* The delay between the release of the most recent period and the task starting to run. */
+	uint32_t ulMaxJitterCycles;		/* The largest release jitter recorded. */
+	uint32_t ulLastResponseCycles;	/* The time taken to complete the most recent period. */
+	uint32_t ulMaxResponseCycles;	/* The largest response time recorded. */
+	uint32_t ulLastExecutionCycles;	/* The time the task spent running during the most recent period. */
+	uint32_t ulMaxExecutionCycles;	/* The largest execution time recorded, which is a measured estimate of the worst case execution time of the task. */
+	uint32_t ulResponseHistogram[ configTIMING_HISTOGRAM_BUCKETS ];	/* Response times, with the period divided evenly between all but the last bucket.  The last bucket counts overruns. */
+} TaskTimingStatus_t;
+
+/*-----------------------------------------------------------
+ * TASK CONTROL API
+ *----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	/**
+	 * task_ext. h
+	 * <pre>void vTaskPreemptionThresholdSet( TaskHandle_t xTask, UBaseType_t uxNewThreshold );</pre>
+	 *
+	 * Set the preemption threshold of a task.  Once the task has started
+	 * running it can only be preempted by a task with a priority above both
+	 * its own priority and its preemption threshold.  Tasks with a priority up
+	 * to the threshold that become ready to run wait until the task blocks, is
+	 * suspended, or lowers its threshold again - including while the task is
+	 * itself preempted by a task above its threshold.  This saves the context
+	 * switches that would otherwise occur between a group of closely
+	 * cooperating tasks, without delaying tasks of a priority above the group.
+	 * While the threshold is above the priority of the task, tasks of the same
+	 * priority do not share the processor with it.
+	 *
+	 * The threshold of a newly created task is equal to its priority, which
+	 * gives the normal fully preemptive behaviour.  A threshold below the
+	 * priority of the task has the same effect.
+	 *
+	 * @param xTask Handle to the task for which the threshold is being set.
+	 * Passing a NULL handle results in the threshold of the calling task being
+	 * set.
+	 *
+	 * @param uxNewThreshold The threshold to which the task will be set.
+	 */
+	void vTaskPreemptionThresholdSet( TaskHandle_t xTask, UBaseType_t uxNewThreshold ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task_ext. h
+	 * <pre>UBaseType_t uxTaskPreemptionThresholdGet( TaskHandle_t xTask );</pre>
+	 *
+	 * Obtain the preemption threshold of any task.  The TaskStatus_t structure
+	 * filled in by uxTaskGetSystemState() is defined by the task.h header from
+	 * TivaWare, so it has no member for the threshold.  Pass the xHandle member
+	 * of each structure to this function to report the thresholds alongside
+	 * the rest of the system state.
+	 *
+	 * @param xTask Handle of the task to be queried.  Passing a NULL handle
+	 * results in the threshold of the calling task being returned.
+	 *
+	 * @return The preemption threshold of xTask.
+	 */
+	UBaseType_t uxTaskPreemptionThresholdGet( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_uxTaskPriorityGet == 1 ) )
+
+	/**
+	 * task_ext. h
+	 * <pre>UBaseType_t uxTaskBasePriorityGet( TaskHandle_t xTask );</pre>
+	 *
+	 * INCLUDE_uxTaskPriorityGet and configUSE_MUTEXES must be defined as 1 for
+	 * this function to be available.
+	 *
+	 * Obtain the priority assigned to any task.  Unlike uxTaskPriorityGet(),
+	 * the result does not include a priority the task has inherited, or been
+	 * raised to by the ceiling mutexes it holds.
+	 *
+	 * @param xTask Handle of the task to be queried.  Passing a NULL handle
+	 * results in the base priority of the calling task being returned.
+	 *
+	 * @return The base priority of xTask.
+	 */
+	UBaseType_t uxTaskBasePriorityGet( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( INCLUDE_uxTaskPriorityGet == 1 ) */
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	/**
+	 * task_ext. h
+	 * <pre>BaseType_t xTaskDelayUntilWithDeadline( TickType_t *pxPreviousWakeTime, const TickType_t xTimeIncrement, const TickType_t xRelativeDeadline );</pre>
+	 *
+	 * INCLUDE_vTaskDelayUntil must be defined as 1 for this function to be
+	 * available.
+	 *
+	 * A version of vTaskDelayUntil() for periodic tasks of priority
+	 * configEDF_TASK_PRIORITY, which are scheduled earliest deadline first.  As
+	 * well as delaying the task until the start of its next period, the task is
+	 * given the absolute deadline xRelativeDeadline ticks after the start of
+	 * that period.  The relative deadline is remembered, so later calls to
+	 * vTaskDelayUntil() set the deadline of each release in the same way.
+	 *
+	 * Of the ready tasks of priority configEDF_TASK_PRIORITY, the one with the
+	 * earliest deadline runs, and a task that becomes ready with an earlier
+	 * deadline than the running task preempts it.  Tasks at that priority that
+	 * have no deadline run only when no task with a deadline is ready.  The
+	 * ready tasks with a deadline are kept in a binary heap, so selecting,
+	 * readying and blocking them takes time proportional to the logarithm of
+	 * their number.  Tasks with equal deadlines are run in no particular
+	 * order.
+	 *
+	 * @param pxPreviousWakeTime Pointer to a variable that holds the time at
+	 * which the task was last unblocked, as for vTaskDelayUntil().
+	 *
+	 * @param xTimeIncrement The period of the task.
+	 *
+	 * @param xRelativeDeadline The deadline of each release of the task,
+	 * relative to the start of its period.  Normally equal to xTimeIncrement.
+	 * Passing 0 removes the deadline from the task.
+	 *
+	 * @return pdPASS if the task was delayed.  pdFAIL if the relative deadline
+	 * could not be set because the deadline heap could not be grown, in which
+	 * case the task is not delayed.
+	 */
+	BaseType_t xTaskDelayUntilWithDeadline( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement, const TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task_ext. h
+	 * <pre>BaseType_t xTaskDeadlineSet( TaskHandle_t xTask, const TickType_t xRelativeDeadline );</pre>
+	 *
+	 * Set the relative deadline of a task, and give the task the absolute
+	 * deadline xRelativeDeadline ticks from now.  Used to release the first
+	 * period of a periodic task, or for tasks that are not periodic.
+	 *
+	 * The deadline heap is allocated from the FreeRTOS heap, and is grown the
+	 * first time a task declares a relative deadline, so there is no limit on
+	 * the number of tasks with a deadline other than the memory available.
+	 *
+	 * @param xTask Handle to the task for which the deadline is being set.
+	 * Passing a NULL handle results in the deadline of the calling task being
+	 * set.
+	 *
+	 * @param xRelativeDeadline The relative deadline of the task.  Passing 0
+	 * removes the deadline from the task.
+	 *
+	 * @return pdPASS if the deadline was set, or pdFAIL if there was not enough
+	 * FreeRTOS heap to grow the deadline heap.
+	 */
+	BaseType_t xTaskDeadlineSet( TaskHandle_t xTask, const TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task_ext. h
+	 * <pre>TickType_t xTaskDeadlineGet( TaskHandle_t xTask );</pre>
+	 *
+	 * @param xTask Handle of the task to be queried.  Passing a NULL handle
+	 * results in the deadline of the calling task being returned.
+	 *
+	 * @return The absolute deadline of the current release of xTask, as a tick
+	 * count, or portMAX_DELAY if the task has no deadline.
+	 */
+	TickType_t xTaskDeadlineGet( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	/**
+	 * task_ext. h
+	 * <pre>void vTaskBudgetSet( TaskHandle_t xTask, uint32_t ulBudgetCycles, TickType_t xReplenishPeriod, eBudgetAction eAction );</pre>
+	 *
+	 * Give a task an execution budget, so it behaves as a sporadic server.
+	 * The running task is charged for the CPU cycles it uses, measured with the
+	 * cycle counter, on each tick and context switch.  An activation of the
+	 * task starts when it starts running and ends when it next blocks or is
+	 * suspended, and the cycles used by an activation are returned to the
+	 * budget xReplenishPeriod ticks after the activation started.  The task
+	 * can therefore use no more than ulBudgetCycles in any window of
+	 * xReplenishPeriod ticks, however often it is released.
+	 *
+	 * Exhaustion is detected by the tick interrupt, so a task can overrun its
+	 * budget by up to one tick.  When it does eAction is applied.
+	 * eBudgetDemote caps the base priority of the task at
+	 * configBUDGET_DEMOTED_PRIORITY, and eBudgetSuspend suspends it.  Either is
+	 * undone when the budget is replenished.  A demoted task keeps any priority
+	 * it inherits through a mutex until it gives the mutex back, and a priority
+	 * set with vTaskPrioritySet() while it is demoted takes effect when the
+	 * budget is replenished.  A task suspended by its budget must not also be
+	 * suspended using vTaskSuspend().
+	 *
+	 * @param xTask Handle to the task for which the budget is being set.
+	 * Passing a NULL handle results in the budget of the calling task being
+	 * set.
+	 *
+	 * @param ulBudgetCycles The budget in CPU cycles.  Passing 0 removes the
+	 * budget from the task.
+	 *
+	 * @param xReplenishPeriod The replenishment period in ticks.
+	 *
+	 * @param eAction What is done to the task when its budget is exhausted.
+	 */
+	void vTaskBudgetSet( TaskHandle_t xTask, const uint32_t ulBudgetCycles, const TickType_t xReplenishPeriod, const eBudgetAction eAction ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task_ext. h
+	 * <pre>void vTaskBudgetGetStatus( TaskHandle_t xTask, TaskBudgetStatus_t *pxBudgetStatus );</pre>
+	 *
+	 * Obtain the budget state of a task.
+	 *
+	 * @param xTask Handle of the task to be queried.  Passing a NULL handle
+	 * results in the state of the calling task being returned.
+	 *
+	 * @param pxBudgetStatus Pointer to the structure that will be filled in.
+	 */
+	void vTaskBudgetGetStatus( TaskHandle_t xTask, TaskBudgetStatus_t * const pxBudgetStatus ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_BUDGETS */
+
+#if ( configUSE_TIMING_MONITOR == 1 )
+
+	/**
+	 * task_ext. h
+	 * <pre>void vTaskGetTimingStatus( TaskHandle_t xTask, TaskTimingStatus_t *pxTimingStatus );</pre>
+	 *
+	 * Obtain a consistent snapshot of the timing statistics of a periodic
+	 * task.  Each call to vTaskDelayUntil() completes one period of the task,
+	 * and releases the next at the tick the task is delayed until.
+	 *
+	 * The release jitter of a period is the time from its release until the
+	 * task starts to run, and its response time is the time from its release
+	 * until the task calls vTaskDelayUntil() again.  A period overruns if its
+	 * response time reaches the period.  The execution time of a period is the
+	 * part of its response time for which the task was actually running.
+	 * Events are timestamped with the cycle counter, and the time of a
+	 * release is worked back from the timestamp of the most recent tick
+	 * interrupt, so the cost is a few instructions per period and per context
+	 * switch.
+	 *
+	 * @param xTask Handle of the task to be queried.  Passing a NULL handle
+	 * results in the statistics of the calling task being returned.
+	 *
+	 * @param pxTimingStatus Pointer to the structure that will be filled in.
+	 */
+	void vTaskGetTimingStatus( TaskHandle_t xTask, TaskTimingStatus_t * const pxTimingStatus ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task_ext. h
+	 * <pre>void vTaskClearTimingStatus( TaskHandle_t xTask );</pre>
+	 *
+	 * Reset the timing statistics of a task to zero.
+	 *
+	 * @param xTask Handle of the task whose statistics are to be cleared.
+	 * Passing a NULL handle results in the statistics of the calling task
+	 * being cleared.
+	 */
+	void vTaskClearTimingStatus( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMING_MONITOR */
+
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+
+	/**
+	 * task_ext. h
+	 * <pre>uint64_t ullTaskGetTickCount64( void );</pre>
+	 *
+	 * Returns the full 64-bit count of ticks since vTaskStartScheduler was
+	 * called.  The lower half is the value returned by xTaskGetTickCount().
+	 * Interrupts are masked briefly while the two halves are read, so this
+	 * function can be called from tasks and from interrupt service routines.
+	 */
+	uint64_t ullTaskGetTickCount64( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_64_BIT_TICK_COUNT */
+
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+	/**
+	 * task_ext. h
+	 * <pre>uint64_t ullTaskGetMicroseconds( void );</pre>
+	 *
+	 * Returns the number of microseconds since the scheduler was started.  The
+	 * count is kept by a free-running 64-bit hardware timer, so it does not
+	 * wrap, and is independent of the tick count.
+	 *
+	 * This function can be called from an interrupt service routine.
+	 */
+	uint64_t ullTaskGetMicroseconds( void ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task_ext. h
+	 * <pre>BaseType_t xTaskDelayUntilMicroseconds( const uint64_t ullWakeTime );</pre>
+	 *
+	 * Block the calling task until ullTaskGetMicroseconds() reaches
+	 * ullWakeTime.  The task is woken by a compare match on the timebase
+	 * timer, not by the tick interrupt, so the wake time has microsecond
+	 * resolution whatever configTICK_RATE_HZ is set to.  A task that is to
+	 * run periodically can add its period to the wake time each time it
+	 * calls this function, as with vTaskDelayUntil().
+	 *
+	 * The blocked tasks are held in a list in wake time order, so the compare
+	 * match only looks at the tasks due to wake.  Placing a task in the list
+	 * searches back from the latest wake time, so the function is intended
+	 * for the few tasks that need sub-tick timing.  Tick based delays and
+	 * timeouts are unaffected.
+	 *
+	 * @param ullWakeTime The time, in microseconds, at which the task is to
+	 * be unblocked.
+	 *
+	 * @return pdTRUE if the task blocked, or pdFALSE if ullWakeTime had
+	 * already passed, in which case the function returns immediately.
+	 */
+	BaseType_t xTaskDelayUntilMicroseconds( const uint64_t ullWakeTime ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+
+/*-----------------------------------------------------------
+ * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
+ *----------------------------------------------------------*/
+
+#if ( ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Records a pointer to a structure that describes the operation the calling
+	 * task is about to block on.  Kernel objects that pass data directly to or
+	 * from a blocked task (rather than through a storage area of their own) set
+	 * this before calling vTaskPlaceOnEventList(), and clear it again once the
+	 * task has unblocked.
+	 */
+	void vTaskSetEventData( void *pvEventData ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Returns the pointer most recently set by xTask using vTaskSetEventData().
+	 * Normally called with the task found at the head of an event list, which
+	 * is obtained using listGET_OWNER_OF_HEAD_ENTRY().  Must be called with the
+	 * scheduler suspended or from within a critical section so the task cannot
+	 * time out while its event data is being accessed.
+	 */
+	void *pvTaskGetEventData( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* ( configUSE_CHANNELS == 1 ) || ( configUSE_IPC == 1 ) */
+
+#if ( configUSE_IPC == 1 )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Requests that the next context switch selects xTask directly rather than
+	 * searching the ready lists.  The request is only honoured if xTask is in
+	 * the Ready state at that time and no task of a higher priority is ready to
+	 * run, so it can never cause a priority inversion - if it is not honoured
+	 * the normal selection is used instead.  Either way the request is cleared
+	 * by the context switch.  Must be called with the scheduler suspended.
+	 */
+	void vTaskHandoffTo( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+	#if ( configUSE_MUTEXES == 1 )
+
+		/*
+		 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+		 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+		 *
+		 * Raises the priority of xRecipient (or the calling task if xRecipient
+		 * is NULL) to uxPriority, if it is not already at or above it.  The
+		 * donation is recorded by placing pxDonationListItem in a list held by
+		 * the recipient, where it stays until it is passed to
+		 * xTaskPriorityRestore().  The donated priority is held using the same
+		 * mechanism as an inherited mutex priority.  If
+		 * configUSE_TRANSITIVE_PRIORITY_INHERITANCE is 1 and the recipient is
+		 * blocked on a mutex, the priority is also passed along the chain of
+		 * mutex holders, as for vTaskPriorityInherit(), up to
+		 * configMAX_PRIORITY_INHERITANCE_DEPTH holders.  Otherwise only the
+		 * recipient itself is raised, and a mutex holder it is blocked on
+		 * keeps its own priority until the recipient next blocks on the mutex.
+		 * Must be called from within a critical section.
+		 */
+		void vTaskPriorityDonate( TaskHandle_t xRecipient, ListItem_t * const pxDonationListItem, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+		/*
+		 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+		 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+		 *
+		 * Returns the donation recorded by pxDonationListItem.  The calling
+		 * task drops to the highest priority still donated to it, or to its
+		 * base priority if that is higher, unless it holds a mutex, in which
+		 * case the priority is returned when the last mutex is given.  Returns
+		 * pdTRUE if the priority was lowered, in which case a yield may be
+		 * required.  Must be called from within a critical section.
+		 */
+		BaseType_t xTaskPriorityRestore( ListItem_t * const pxDonationListItem ) PRIVILEGED_FUNCTION;
+
+	#endif /* configUSE_MUTEXES */
+
+#endif /* configUSE_IPC */
+
+#if ( ( configUSE_LIGHT_MUTEXES == 1 ) && ( configUSE_MUTEXES == 1 ) )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Called by a task after it has released a mutex that was counted using
+	 * pvTaskIncrementMutexHeldCount().  Decrements the count of mutexes held
+	 * by the task, and disinherits any inherited priority if the count reaches
+	 * zero.  Returns pdTRUE if a yield is required.
+	 */
+	BaseType_t xTaskDecrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
+
+#endif /* ( configUSE_LIGHT_MUTEXES == 1 ) && ( configUSE_MUTEXES == 1 ) */
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Records the address of the holder field of the mutex the calling task is
+	 * about to block on, so a priority the task inherits can be passed on to
+	 * the holder of that mutex.  Called before vTaskPriorityInherit() when
+	 * blocking on a mutex, and with NULL once the task has unblocked.  The
+	 * bottom bit of the holder field is ignored, so the mutex can use it as a
+	 * flag.
+	 */
+	void vTaskSetBlockingMutex( void * volatile * const ppvMutexHolder ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Records that tasks are waiting for a mutex held by pxMutexHolder by
+	 * placing pxMutexListItem in a list held by the holder.  The owner of
+	 * pxMutexListItem must be the mutex's list of waiting tasks.  Called when
+	 * a task blocks on the mutex, and when a task takes the mutex while other
+	 * tasks are still waiting for it.  Does nothing if pxMutexHolder is NULL
+	 * or the item is already in the holder's list.  Must be called from a
+	 * critical section.
+	 */
+	void vTaskAddContendedMutex( TaskHandle_t const pxMutexHolder, ListItem_t * const pxMutexListItem ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Removes pxMutexListItem from the list held by the holder of the mutex,
+	 * if it is in it.  Called when the mutex is given back, before
+	 * xTaskPriorityDisinherit().  Must be called from a critical section.
+	 */
+	void vTaskRemoveContendedMutex( ListItem_t * const pxMutexListItem ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Called by a task that timed out waiting for a mutex.  The priority
+	 * pxMutexHolder inherited is lowered to that of the highest priority task
+	 * still waiting for any of the mutexes it holds (or to its base priority),
+	 * and the change is passed along the chain of holders.  Must be called
+	 * from a critical section.
+	 */
+	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) */
+
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Records that the calling task holds a ceiling mutex of priority
+	 * uxCeilingPriority by placing pxCeilingListItem in a list held by the
+	 * task, and raises the base priority of the task to the ceiling if it is
+	 * not already at or above it.  The running priority is raised too unless
+	 * the task has already inherited a higher one.  The priority the task had
+	 * before it took any ceiling mutex must not be above uxCeilingPriority.
+	 * Must be called from within a critical section.
+	 */
+	void vTaskPriorityRaiseToCeiling( ListItem_t * const pxCeilingListItem, UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Removes pxCeilingListItem, as placed by vTaskPriorityRaiseToCeiling(),
+	 * and returns the base priority of the calling task to the highest
+	 * ceiling of the mutexes it still holds, or to the priority it had before
+	 * it took any.  Returns pdTRUE if the running priority was lowered, in
+	 * which case a yield may be required.  Must be called from within a
+	 * critical section.
+	 */
+	BaseType_t xTaskPriorityRestoreFromCeiling( ListItem_t * const pxCeilingListItem ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_CEILING_MUTEXES */
+
+#if ( configUSE_BASIC_TASKS == 1 )
+
+	/**
+	 * task_ext. h
+	 * <pre>BaseType_t xTaskCreateBasic( TaskFunction_t pxTaskCode, const char * const pcName, void *pvParameters, UBaseType_t uxPriority, TaskHandle_t *pxCreatedTask );</pre>
+	 *
+	 * Create a basic task.  A basic task has a task control block and a
+	 * priority like any other task, but no stack of its own.  Instead it runs
+	 * on a stack of configBASIC_TASK_STACK_SIZE words that is shared by all
+	 * the basic tasks, so the RAM used for stacks depends on how deeply basic
+	 * tasks can preempt each other rather than on how many there are.
+	 *
+	 * A basic task is created in the dormant state.  Each call to
+	 * vTaskActivate() or vTaskActivateFromISR() makes it ready to run, and it
+	 * then runs pxTaskCode from the start.  When pxTaskCode returns the task
+	 * is dormant again.  Basic tasks are scheduled by priority alongside the
+	 * other tasks, and can be preempted by any task of a higher priority.
+	 *
+	 * The shared stack is used in the manner of the Stack Resource Policy.
+	 * A basic task starts just below the context of the basic task it
+	 * preempts, so it can only start if its priority is above that of every
+	 * basic task that has started and not yet completed.  A basic task of the
+	 * same priority as one that has started waits for it to complete rather
+	 * than sharing the processor with it.  Tasks that are not basic tasks
+	 * still share the processor with a basic task of the same priority.
+	 *
+	 * A basic task activated by the running basic task, when it is certain to
+	 * be the next task to run, is started by a function call on the shared
+	 * stack, so the context of neither task is saved or restored.  When it
+	 * completes it returns to the task that activated it, or runs the next
+	 * basic task in its place if that task would start at the same place on
+	 * the stack, again without a context switch.  A basic task activated from
+	 * an interrupt or by a task with its own stack is started by a normal
+	 * context switch, as the processor has to move onto the shared stack, and
+	 * a task started that way also ends with a context switch.
+	 *
+	 * Basic tasks must therefore never block, be suspended or have their
+	 * priority changed while they are active, and cannot be deleted.  They
+	 * can give to queues and semaphores, take from them with a block time of
+	 * 0, and activate other basic tasks.  For the same reason basic tasks
+	 * must not be given an execution budget, as enforcing a budget suspends or
+	 * demotes the task.  configASSERT() is used to catch a basic task that
+	 * blocks, is suspended, is deleted or is given a budget.
+	 *
+	 * @param pxTaskCode The function run each time the task is activated.
+	 * Unlike other task functions it returns when it has finished.
+	 *
+	 * @param pcName A descriptive name for the task.
+	 *
+	 * @param pvParameters The value passed to pxTaskCode.
+	 *
+	 * @param uxPriority The priority of the task.
+	 *
+	 * @param pxCreatedTask Used to pass back a handle by which the task can be
+	 * activated.
+	 *
+	 * @return pdPASS if the task was created, or
+	 * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY if the task control block, or the
+	 * shared stack when the first basic task is created, could not be
+	 * allocated.
+	 */
+	BaseType_t xTaskCreateBasic( TaskFunction_t pxTaskCode, const char * const pcName, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+	/**
+	 * task_ext. h
+	 * <pre>void vTaskActivate( TaskHandle_t xTask );</pre>
+	 *
+	 * Make a dormant basic task ready to run.  If the task is already active
+	 * the activation is counted, and the task runs again from the start each
+	 * time it completes until the count is used up.
+	 *
+	 * When called by a basic task the activated task may be run to completion
+	 * before vTaskActivate() returns, so vTaskActivate() must not be called
+	 * from a critical section.
+	 *
+	 * @param xTask Handle of the basic task to activate.
+	 */
+	void vTaskActivate( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * task_ext. h
+	 * <pre>void vTaskActivateFromISR( TaskHandle_t xTask, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+	 *
+	 * A version of vTaskActivate() that can be called from an interrupt
+	 * service routine.
+	 *
+	 * @param xTask Handle of the basic task to activate.
+	 *
+	 * @param pxHigherPriorityTaskWoken Set to pdTRUE if the activated task has
+	 * a priority above the interrupted task, in which case a context switch
+	 * should be requested before the interrupt is exited.
+	 */
+	void vTaskActivateFromISR( TaskHandle_t xTask, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_BASIC_TASKS */
+
+#if ( configUSE_DYNAMIC_TICK == 1 )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Returns the number of ticks from the current tick count to the next tick
+	 * on which the kernel has something to do.  Always at least 1.  Must be
+	 * called with interrupts masked.
+	 */
+	TickType_t xTaskGetTicksToNextEvent( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Called by the port in place of xTaskIncrementTick() to tell the kernel
+	 * that xTicks tick periods have passed, the last of which started
+	 * ulCyclesSinceTick CPU cycles ago.  The ticks can be announced well after
+	 * they started, so this is what the timing monitor timestamps them with.
+	 * Returns pdTRUE if a context switch is required.  Must be called with
+	 * interrupts masked.
+	 */
+	BaseType_t xTaskAnnounceTicks( const TickType_t xTicks, const uint32_t ulCyclesSinceTick ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DYNAMIC_TICK */
+
+#if ( configUSE_MICROSECOND_TIMEBASE == 1 )
+
+	/*
+	 * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+	 * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+	 *
+	 * Called by the port from the timebase compare interrupt.  Unblocks the
+	 * tasks whose wake time has passed, then sets the compare to the earliest
+	 * wake time that remains.  Returns pdTRUE if a context switch is required.
+	 */
+	BaseType_t xTaskMicrosecondAlarm( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MICROSECOND_TIMEBASE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TASK_EXT_H */
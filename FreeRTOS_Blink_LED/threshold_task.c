@@ -0,0 +1,205 @@
+/*
+ * threshold_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/******************************************************************************
+ *
+ * This file checks the preemption thresholds set with
+ * vTaskPreemptionThresholdSet().
+ *
+ * vThresholdTask() creates three tasks.  The low task runs with a preemption
+ * threshold equal to the priority of the middle task, and the high task runs
+ * above both.  Every mainTHRESHOLD_PERIOD the low task notifies the middle
+ * task, which must not run until the low task blocks, then notifies the high
+ * task, which must run straight away.  The middle and high tasks each count
+ * the times they have run.
+ *
+ * A check that fails sets a bit in g_ui32ThresholdErrors, and
+ * g_ui32ThresholdChecks counts the completed checks.  Both can be read with
+ * the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when preemption thresholds are included. */
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+/*
+ * Priorities at which the tasks are created.  The low task raises its
+ * threshold to the priority of the middle task.
+ */
+#define mainTHRESHOLD_LOW_PRIORITY          ( tskIDLE_PRIORITY + 5 )
+#define mainTHRESHOLD_MIDDLE_PRIORITY       ( tskIDLE_PRIORITY + 6 )
+#define mainTHRESHOLD_HIGH_PRIORITY         ( tskIDLE_PRIORITY + 7 )
+
+/*
+ * The rate at which the check is repeated.
+ */
+#define mainTHRESHOLD_PERIOD                ( pdMS_TO_TICKS( 100UL ) )
+
+/*
+ * Bits set in g_ui32ThresholdErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_MIDDLE_PREEMPTED          ( 1UL << 1UL )
+#define mainERROR_MIDDLE_NOT_RUN            ( 1UL << 2UL )
+#define mainERROR_HIGH_NOT_RUN              ( 1UL << 3UL )
+
+/*
+ * Results of the checks, written by the tasks.
+ */
+volatile uint32_t g_ui32ThresholdErrors = 0;
+volatile uint32_t g_ui32ThresholdChecks = 0;
+volatile uint32_t g_ui32ThresholdMiddleRuns = 0;
+volatile uint32_t g_ui32ThresholdHighRuns = 0;
+
+/*
+ * The tasks notified by the low task.
+ */
+static TaskHandle_t xMiddleTask = NULL;
+static TaskHandle_t xHighTask = NULL;
+
+/*
+ * The tasks as described in the comments at the top of this file.  The middle
+ * and high tasks share an implementation, and are passed the counter they
+ * increment.
+ */
+static void prvLowTask( void *pvParameters );
+static void prvNotifiedTask( void *pvParameters );
+
+/*
+ * Called by main() to create the tasks.
+ */
+void vThresholdTask( void );
+/*-----------------------------------------------------------*/
+
+void vThresholdTask( void )
+{
+    if( ( xTaskCreate( prvNotifiedTask,
+                       "ThrMid",
+                       configMINIMAL_STACK_SIZE,
+                       ( void * ) &g_ui32ThresholdMiddleRuns,
+                       mainTHRESHOLD_MIDDLE_PRIORITY,
+                       &xMiddleTask ) != pdPASS ) ||
+        ( xTaskCreate( prvNotifiedTask,
+                       "ThrHigh",
+                       configMINIMAL_STACK_SIZE,
+                       ( void * ) &g_ui32ThresholdHighRuns,
+                       mainTHRESHOLD_HIGH_PRIORITY,
+                       &xHighTask ) != pdPASS ) ||
+        ( xTaskCreate( prvLowTask,
+                       "ThrLow",
+                       configMINIMAL_STACK_SIZE,
+                       NULL,
+                       mainTHRESHOLD_LOW_PRIORITY,
+                       NULL ) != pdPASS ) )
+    {
+        g_ui32ThresholdErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvLowTask( void *pvParameters )
+{
+uint32_t ui32MiddleRuns, ui32HighRuns;
+
+    ( void ) pvParameters;
+
+    /* Only tasks above the middle task can now preempt this task. */
+    vTaskPreemptionThresholdSet( NULL, mainTHRESHOLD_MIDDLE_PRIORITY );
+
+    for( ;; )
+    {
+        ui32MiddleRuns = g_ui32ThresholdMiddleRuns;
+        ui32HighRuns = g_ui32ThresholdHighRuns;
+
+        /* The middle task is above this task but not above its threshold, so
+        it must wait. */
+        xTaskNotifyGive( xMiddleTask );
+
+        if( g_ui32ThresholdMiddleRuns != ui32MiddleRuns )
+        {
+            g_ui32ThresholdErrors |= mainERROR_MIDDLE_PREEMPTED;
+        }
+
+        /* The high task is above the threshold, so it runs at once.  The
+        middle task must still be waiting after it. */
+        xTaskNotifyGive( xHighTask );
+
+        if( g_ui32ThresholdHighRuns != ( ui32HighRuns + 1UL ) )
+        {
+            g_ui32ThresholdErrors |= mainERROR_HIGH_NOT_RUN;
+        }
+
+        if( g_ui32ThresholdMiddleRuns != ui32MiddleRuns )
+        {
+            g_ui32ThresholdErrors |= mainERROR_MIDDLE_PREEMPTED;
+        }
+
+        /* Blocking lets the middle task run. */
+        vTaskDelay( mainTHRESHOLD_PERIOD );
+
+        if( g_ui32ThresholdMiddleRuns != ( ui32MiddleRuns + 1UL ) )
+        {
+            g_ui32ThresholdErrors |= mainERROR_MIDDLE_NOT_RUN;
+        }
+
+        g_ui32ThresholdChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifiedTask( void *pvParameters )
+{
+volatile uint32_t * const pui32Runs = ( volatile uint32_t * ) pvParameters;
+
+    for( ;; )
+    {
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        ( *pui32Runs )++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_PREEMPTION_THRESHOLD == 1 */
@@ -0,0 +1,215 @@
+/*
+ * tick_count64_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the 64-bit tick count, and the single delayed task and
+ * timer lists that it allows.
+ *
+ * vTickCount64Task() creates a check task and an auto-reload software timer.
+ * Each time the check task runs it checks that:
+ *
+ * - the lower half of ullTaskGetTickCount64() is the tick count returned by
+ *   xTaskGetTickCount(), and the 64-bit count never goes backwards.
+ * - a delay blocks the task for the number of ticks asked for, as measured
+ *   by the 64-bit count.
+ * - the timer has expired once for each of its periods that has passed.
+ *
+ * A check that fails sets a bit in g_ui32TickCount64Errors, and
+ * g_ui32TickCount64Checks counts the completed checks.  Both can be read
+ * with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "task_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when the 64-bit tick count and the software timers
+are included. */
+#if ( ( configUSE_64_BIT_TICK_COUNT == 1 ) && ( configUSE_TIMERS == 1 ) )
+
+/*
+ * The priority of the check task.
+ */
+#define mainTICK64_PRIORITY                 ( tskIDLE_PRIORITY + 5 )
+
+/*
+ * The rate at which the check task runs, the delay it measures, and the
+ * period of the timer.
+ */
+#define mainTICK64_CHECK_PERIOD             ( pdMS_TO_TICKS( 100UL ) )
+#define mainTICK64_DELAY                    ( pdMS_TO_TICKS( 7UL ) )
+#define mainTICK64_TIMER_PERIOD             ( pdMS_TO_TICKS( 10UL ) )
+
+/*
+ * Bits set in g_ui32TickCount64Errors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_LOWER_HALF                ( 1UL << 1UL )
+#define mainERROR_BACKWARDS                 ( 1UL << 2UL )
+#define mainERROR_DELAY                     ( 1UL << 3UL )
+#define mainERROR_TIMER                     ( 1UL << 4UL )
+
+/*
+ * Results of the checks, written by the task and the timer.
+ */
+volatile uint32_t g_ui32TickCount64Errors = 0;
+volatile uint32_t g_ui32TickCount64Checks = 0;
+volatile uint32_t g_ui32TickCount64TimerExpiries = 0;
+
+/*
+ * The check task and the timer callback as described in the comments at the
+ * top of this file.
+ */
+static void prvTickCount64Task( void *pvParameters );
+static void prvTickCount64TimerCallback( TimerHandle_t xTimer );
+
+/*
+ * Called by main() to create the task and the timer.
+ */
+void vTickCount64Task( void );
+/*-----------------------------------------------------------*/
+
+void vTickCount64Task( void )
+{
+TimerHandle_t xTimer;
+
+    xTimer = xTimerCreate( "Tick64",
+                           mainTICK64_TIMER_PERIOD,
+                           pdTRUE,
+                           NULL,
+                           prvTickCount64TimerCallback );
+
+    if( ( xTimer == NULL ) ||
+        ( xTaskCreate( prvTickCount64Task,
+                       "Tick64",
+                       configMINIMAL_STACK_SIZE,
+                       ( void * ) xTimer,
+                       mainTICK64_PRIORITY,
+                       NULL ) != pdPASS ) )
+    {
+        g_ui32TickCount64Errors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickCount64Task( void *pvParameters )
+{
+const TimerHandle_t xTimer = ( TimerHandle_t ) pvParameters;
+TickType_t xLastWakeTime, xTicksBefore, xTicksAfter;
+uint64_t ullTicks64, ullLastTicks64, ullTimerStart;
+uint32_t ui32Expected;
+
+    xLastWakeTime = xTaskGetTickCount();
+    ullLastTicks64 = ullTaskGetTickCount64();
+
+    /* The timer is started from this task so its start time is known. */
+    ullTimerStart = ullTaskGetTickCount64();
+
+    if( xTimerStart( xTimer, 0 ) != pdPASS )
+    {
+        g_ui32TickCount64Errors |= mainERROR_CREATE;
+    }
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainTICK64_CHECK_PERIOD );
+
+        /* The lower half of the 64-bit count is the 32-bit count.  A tick can
+        occur between the reads, so the lower half is checked against the
+        counts read either side. */
+        xTicksBefore = xTaskGetTickCount();
+        ullTicks64 = ullTaskGetTickCount64();
+        xTicksAfter = xTaskGetTickCount();
+
+        if( ( TickType_t ) ( ( TickType_t ) ullTicks64 - xTicksBefore ) > ( TickType_t ) ( xTicksAfter - xTicksBefore ) )
+        {
+            g_ui32TickCount64Errors |= mainERROR_LOWER_HALF;
+        }
+
+        if( ullTicks64 < ullLastTicks64 )
+        {
+            g_ui32TickCount64Errors |= mainERROR_BACKWARDS;
+        }
+
+        /* The timer expires once per period since it was started.  Its last
+        expiry may be due but not yet processed by the timer service task. */
+        ui32Expected = ( uint32_t ) ( ( ullTicks64 - ullTimerStart ) / ( uint64_t ) mainTICK64_TIMER_PERIOD );
+
+        if( ( g_ui32TickCount64TimerExpiries + 1UL ) < ui32Expected )
+        {
+            g_ui32TickCount64Errors |= mainERROR_TIMER;
+        }
+
+        if( g_ui32TickCount64TimerExpiries > ui32Expected )
+        {
+            g_ui32TickCount64Errors |= mainERROR_TIMER;
+        }
+
+        /* A delay is measured from the tick at which it is requested, so at
+        least the number of ticks asked for must pass. */
+        ullLastTicks64 = ullTaskGetTickCount64();
+        vTaskDelay( mainTICK64_DELAY );
+        ullTicks64 = ullTaskGetTickCount64();
+
+        if( ( ullTicks64 - ullLastTicks64 ) < ( uint64_t ) mainTICK64_DELAY )
+        {
+            g_ui32TickCount64Errors |= mainERROR_DELAY;
+        }
+
+        ullLastTicks64 = ullTicks64;
+
+        g_ui32TickCount64Checks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickCount64TimerCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+
+    g_ui32TickCount64TimerExpiries++;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_64_BIT_TICK_COUNT == 1 ) && ( configUSE_TIMERS == 1 ) */
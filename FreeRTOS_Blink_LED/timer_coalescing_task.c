@@ -0,0 +1,252 @@
+/*
+ * timer_coalescing_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks that timer commands are coalesced on the timer they are
+ * sent to.
+ *
+ * vTimerCoalescingTask() creates a check task and a one-shot timer.  Each
+ * time the check task runs it sends two bursts of commands to the timer with
+ * the scheduler suspended, so the timer service task cannot process any of
+ * them until the burst is complete.  Each burst holds more commands than the
+ * timer queue has room for, and every command must still be accepted.
+ *
+ * - The first burst resets the timer many times, changes its period to
+ *   mainCOALESCE_LONG_PERIOD, then resets it again.  The timer must expire
+ *   once, after the new period rather than the old one.
+ * - The second burst changes the period back, resets the timer many times,
+ *   then stops it.  Only the stop takes effect, so the timer must not expire.
+ *
+ * A check that fails sets a bit in g_ui32TimerCoalescingErrors, and
+ * g_ui32TimerCoalescingChecks counts the completed checks.  Both can be read
+ * with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "timers_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when timer commands are coalesced. */
+#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_COMMAND_COALESCING == 1 ) )
+
+/*
+ * The priority of the check task.  The timer service task runs above it.
+ */
+#define mainCOALESCE_PRIORITY               ( tskIDLE_PRIORITY + 5 )
+
+/*
+ * The rate at which the check task runs.
+ */
+#define mainCOALESCE_CHECK_PERIOD           ( pdMS_TO_TICKS( 100UL ) )
+
+/*
+ * The period the timer is created with, and the period the first burst of
+ * commands changes it to.
+ */
+#define mainCOALESCE_SHORT_PERIOD           ( pdMS_TO_TICKS( 10UL ) )
+#define mainCOALESCE_LONG_PERIOD            ( pdMS_TO_TICKS( 30UL ) )
+
+/*
+ * The number of resets sent in each part of a burst.  This is more than the
+ * timer queue could hold.
+ */
+#define mainCOALESCE_RESETS                 ( configTIMER_QUEUE_LENGTH * 4 )
+
+/*
+ * Bits set in g_ui32TimerCoalescingErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_COMMAND_FAILED            ( 1UL << 1UL )
+#define mainERROR_OLD_PERIOD                ( 1UL << 2UL )
+#define mainERROR_NOT_EXPIRED               ( 1UL << 3UL )
+#define mainERROR_STOP_IGNORED              ( 1UL << 4UL )
+
+/*
+ * Results of the checks, written by the task and the timer callback.
+ */
+volatile uint32_t g_ui32TimerCoalescingErrors = 0;
+volatile uint32_t g_ui32TimerCoalescingChecks = 0;
+volatile uint32_t g_ui32TimerCoalescingExpiries = 0;
+
+/*
+ * The check task and the timer callback as described in the comments at the
+ * top of this file.
+ */
+static void prvTimerCoalescingTask( void *pvParameters );
+static void prvTimerCoalescingCallback( TimerHandle_t xTimer );
+
+/*
+ * Sends mainCOALESCE_RESETS reset commands to xTimer, recording an error if
+ * any is not accepted.
+ */
+static void prvSendResets( TimerHandle_t xTimer );
+
+/*
+ * Called by main() to create the task and the timer.
+ */
+void vTimerCoalescingTask( void );
+/*-----------------------------------------------------------*/
+
+void vTimerCoalescingTask( void )
+{
+TimerHandle_t xTimer;
+
+    xTimer = xTimerCreate( "Coalesce",
+                           mainCOALESCE_SHORT_PERIOD,
+                           pdFALSE,
+                           NULL,
+                           prvTimerCoalescingCallback );
+
+    if( ( xTimer == NULL ) ||
+        ( xTaskCreate( prvTimerCoalescingTask,
+                       "Coalesce",
+                       configMINIMAL_STACK_SIZE,
+                       ( void * ) xTimer,
+                       mainCOALESCE_PRIORITY,
+                       NULL ) != pdPASS ) )
+    {
+        g_ui32TimerCoalescingErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCoalescingTask( void *pvParameters )
+{
+const TimerHandle_t xTimer = ( TimerHandle_t ) pvParameters;
+TickType_t xLastWakeTime;
+uint32_t ui32Expiries;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainCOALESCE_CHECK_PERIOD );
+
+        /* Reset, change the period, and reset again.  The new period is
+        applied by the final reset. */
+        ui32Expiries = g_ui32TimerCoalescingExpiries;
+
+        vTaskSuspendAll();
+        {
+            prvSendResets( xTimer );
+
+            if( xTimerChangePeriod( xTimer, mainCOALESCE_LONG_PERIOD, 0 ) != pdPASS )
+            {
+                g_ui32TimerCoalescingErrors |= mainERROR_COMMAND_FAILED;
+            }
+
+            prvSendResets( xTimer );
+        }
+        ( void ) xTaskResumeAll();
+
+        /* The timer would have expired by now with its old period. */
+        vTaskDelay( ( mainCOALESCE_SHORT_PERIOD + mainCOALESCE_LONG_PERIOD ) / 2 );
+
+        if( g_ui32TimerCoalescingExpiries != ui32Expiries )
+        {
+            g_ui32TimerCoalescingErrors |= mainERROR_OLD_PERIOD;
+        }
+
+        vTaskDelay( mainCOALESCE_LONG_PERIOD );
+
+        if( g_ui32TimerCoalescingExpiries != ( ui32Expiries + 1UL ) )
+        {
+            g_ui32TimerCoalescingErrors |= mainERROR_NOT_EXPIRED;
+        }
+
+        /* Change the period back, reset, and stop.  Changing the period starts
+        the timer, but the stop overrides that. */
+        ui32Expiries = g_ui32TimerCoalescingExpiries;
+
+        vTaskSuspendAll();
+        {
+            if( xTimerChangePeriod( xTimer, mainCOALESCE_SHORT_PERIOD, 0 ) != pdPASS )
+            {
+                g_ui32TimerCoalescingErrors |= mainERROR_COMMAND_FAILED;
+            }
+
+            prvSendResets( xTimer );
+
+            if( xTimerStop( xTimer, 0 ) != pdPASS )
+            {
+                g_ui32TimerCoalescingErrors |= mainERROR_COMMAND_FAILED;
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        vTaskDelay( mainCOALESCE_SHORT_PERIOD * 2 );
+
+        if( ( g_ui32TimerCoalescingExpiries != ui32Expiries ) || ( xTimerIsTimerActive( xTimer ) != pdFALSE ) )
+        {
+            g_ui32TimerCoalescingErrors |= mainERROR_STOP_IGNORED;
+        }
+
+        g_ui32TimerCoalescingChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSendResets( TimerHandle_t xTimer )
+{
+uint32_t ui32Reset;
+
+    for( ui32Reset = 0; ui32Reset < mainCOALESCE_RESETS; ui32Reset++ )
+    {
+        if( xTimerReset( xTimer, 0 ) != pdPASS )
+        {
+            g_ui32TimerCoalescingErrors |= mainERROR_COMMAND_FAILED;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCoalescingCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+
+    g_ui32TimerCoalescingExpiries++;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_COMMAND_COALESCING == 1 ) */
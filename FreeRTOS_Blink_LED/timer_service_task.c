@@ -0,0 +1,218 @@
+/*
+ * timer_service_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks that timers created for different timer service tasks
+ * are processed independently.
+ *
+ * vTimerServiceTask() creates a slow auto reload timer handled by timer
+ * service task 1 and a quick one-shot timer handled by timer service task 0,
+ * which runs at a higher priority.  Each time the slow timer's callback runs
+ * it starts the quick timer to expire on the next tick, then keeps the
+ * processor until mainSERVICE_SLOW_TICKS ticks have passed.  The quick
+ * timer's callback must have run in the meantime.  Each callback also checks
+ * it is running in the timer service task it was created for.
+ *
+ * A check task makes sure the slow timer keeps expiring.
+ *
+ * A check that fails sets a bit in g_ui32TimerServiceErrors, and
+ * g_ui32TimerServiceChecks counts the completed checks.  Both can be read
+ * with the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "timers_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when there is more than one timer service task. */
+#if ( ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) )
+
+/*
+ * The priority of the check task, and the rate at which it runs.
+ */
+#define mainSERVICE_PRIORITY                ( tskIDLE_PRIORITY + 5 )
+#define mainSERVICE_CHECK_PERIOD            ( pdMS_TO_TICKS( 500UL ) )
+
+/*
+ * The timer service tasks used, the period of the slow timer, and the number
+ * of ticks its callback keeps the processor for.
+ */
+#define mainSERVICE_QUICK                   ( ( UBaseType_t ) 0U )
+#define mainSERVICE_SLOW                    ( ( UBaseType_t ) 1U )
+#define mainSERVICE_SLOW_PERIOD             ( pdMS_TO_TICKS( 100UL ) )
+#define mainSERVICE_SLOW_TICKS              ( ( TickType_t ) 2 )
+
+/*
+ * Bits set in g_ui32TimerServiceErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_WRONG_SERVICE             ( 1UL << 1UL )
+#define mainERROR_HELD_UP                   ( 1UL << 2UL )
+#define mainERROR_STALLED                   ( 1UL << 3UL )
+
+/*
+ * Results of the checks, written by the task and the timer callbacks.
+ */
+volatile uint32_t g_ui32TimerServiceErrors = 0;
+volatile uint32_t g_ui32TimerServiceChecks = 0;
+volatile uint32_t g_ui32TimerServiceSlowExpiries = 0;
+
+/*
+ * The quick timer, and whether its callback has run since the slow timer's
+ * callback last started it.
+ */
+static TimerHandle_t xQuickTimer = NULL;
+static volatile BaseType_t xQuickTimerRan = pdFALSE;
+
+/*
+ * The check task and the timer callbacks as described in the comments at the
+ * top of this file.
+ */
+static void prvTimerServiceTask( void *pvParameters );
+static void prvSlowCallback( TimerHandle_t xTimer );
+static void prvQuickCallback( TimerHandle_t xTimer );
+
+/*
+ * Called by main() to create the task and the timers.
+ */
+void vTimerServiceTask( void );
+/*-----------------------------------------------------------*/
+
+void vTimerServiceTask( void )
+{
+TimerHandle_t xSlowTimer;
+
+    xQuickTimer = xTimerCreateForService( "Quick", ( TickType_t ) 1, pdFALSE, NULL, prvQuickCallback, mainSERVICE_QUICK );
+    xSlowTimer = xTimerCreateForService( "Slow", mainSERVICE_SLOW_PERIOD, pdTRUE, NULL, prvSlowCallback, mainSERVICE_SLOW );
+
+    if( ( xQuickTimer == NULL ) || ( xSlowTimer == NULL ) || ( xTimerStart( xSlowTimer, 0 ) != pdPASS ) )
+    {
+        g_ui32TimerServiceErrors |= mainERROR_CREATE;
+    }
+
+    if( xTaskCreate( prvTimerServiceTask,
+                     "Service",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainSERVICE_PRIORITY,
+                     NULL ) != pdPASS )
+    {
+        g_ui32TimerServiceErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerServiceTask( void *pvParameters )
+{
+TickType_t xLastWakeTime;
+uint32_t ui32LastExpiries = 0;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainSERVICE_CHECK_PERIOD );
+
+        if( g_ui32TimerServiceSlowExpiries == ui32LastExpiries )
+        {
+            g_ui32TimerServiceErrors |= mainERROR_STALLED;
+        }
+
+        ui32LastExpiries = g_ui32TimerServiceSlowExpiries;
+
+        g_ui32TimerServiceChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSlowCallback( TimerHandle_t xTimer )
+{
+TickType_t xStart;
+
+    ( void ) xTimer;
+
+    if( uxTaskPriorityGet( NULL ) != configTIMER_SERVICE_PRIORITY( mainSERVICE_SLOW ) )
+    {
+        g_ui32TimerServiceErrors |= mainERROR_WRONG_SERVICE;
+    }
+
+    /* The quick timer expires on the next tick, while this callback still
+    has the processor. */
+    xQuickTimerRan = pdFALSE;
+    xStart = xTaskGetTickCount();
+
+    if( xTimerStart( xQuickTimer, 0 ) != pdPASS )
+    {
+        g_ui32TimerServiceErrors |= mainERROR_CREATE;
+    }
+
+    while( ( xTaskGetTickCount() - xStart ) < mainSERVICE_SLOW_TICKS )
+    {
+    }
+
+    if( xQuickTimerRan == pdFALSE )
+    {
+        g_ui32TimerServiceErrors |= mainERROR_HELD_UP;
+    }
+
+    g_ui32TimerServiceSlowExpiries++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvQuickCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+
+    if( uxTaskPriorityGet( NULL ) != configTIMER_SERVICE_PRIORITY( mainSERVICE_QUICK ) )
+    {
+        g_ui32TimerServiceErrors |= mainERROR_WRONG_SERVICE;
+    }
+
+    xQuickTimerRan = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_TIMERS == 1 ) && ( configTIMER_SERVICE_COUNT > 1 ) */
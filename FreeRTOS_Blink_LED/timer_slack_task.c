@@ -0,0 +1,270 @@
+/*
+ * timer_slack_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the slack that lets timers that are due close together
+ * share a wake up of the timer service task.
+ *
+ * vTimerSlackTask() creates mainSLACK_TIMERS auto reload timers with
+ * different periods and the same slack, and starts them before the scheduler
+ * is started so they are all started at tick 0.  Each time one expires its
+ * callback checks that it ran no earlier than it was due and no later than
+ * its slack allows, counting from tick 0, so slack must not make the timer
+ * drift.  The timers are all due on the same tick once every
+ * mainSLACK_COMMON_PERIOD ticks, and must then expire on the same tick as
+ * each other.
+ *
+ * A check task makes sure the timers keep expiring, and that some of their
+ * expiries have been shared.
+ *
+ * A check that fails sets a bit in g_ui32TimerSlackErrors, and
+ * g_ui32TimerSlackChecks counts the completed checks.  Both can be read with
+ * the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "timers_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when timers can be given slack. */
+#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_SLACK == 1 ) )
+
+/*
+ * The priority of the check task, and the rate at which it runs.
+ */
+#define mainSLACK_PRIORITY                  ( tskIDLE_PRIORITY + 5 )
+#define mainSLACK_CHECK_PERIOD              ( pdMS_TO_TICKS( 1000UL ) )
+
+/*
+ * The number of timers, their slack, and the period after which they are all
+ * due on the same tick again.
+ */
+#define mainSLACK_TIMERS                    ( 2 )
+#define mainSLACK_SLACK                     ( pdMS_TO_TICKS( 20UL ) )
+#define mainSLACK_COMMON_PERIOD             ( pdMS_TO_TICKS( 150UL ) )
+
+/*
+ * Bits set in g_ui32TimerSlackErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_EARLY                     ( 1UL << 1UL )
+#define mainERROR_LATE                      ( 1UL << 2UL )
+#define mainERROR_STALLED                   ( 1UL << 3UL )
+#define mainERROR_NOT_SHARED                ( 1UL << 4UL )
+
+/*
+ * Results of the checks, written by the task and the timer callback.
+ */
+volatile uint32_t g_ui32TimerSlackErrors = 0;
+volatile uint32_t g_ui32TimerSlackChecks = 0;
+volatile uint32_t g_ui32TimerSlackExpiries[ mainSLACK_TIMERS ] = { 0 };
+volatile uint32_t g_ui32TimerSlackSharedExpiries = 0;
+
+/*
+ * The periods of the timers.  mainSLACK_COMMON_PERIOD is a multiple of each.
+ */
+static const TickType_t xSlackPeriods[ mainSLACK_TIMERS ] =
+{
+    pdMS_TO_TICKS( 50UL ), pdMS_TO_TICKS( 30UL )
+};
+
+/*
+ * The number of times each timer has expired when all the timers were due
+ * together, and the tick at which it last did so.  Only accessed by the timer
+ * service task.
+ */
+static uint32_t ui32CommonExpiries[ mainSLACK_TIMERS ];
+static TickType_t xCommonExpiryTick[ mainSLACK_TIMERS ];
+
+/*
+ * The check task and the timer callback as described in the comments at the
+ * top of this file.  The timers share a callback, and their IDs are their
+ * index into the arrays above.
+ */
+static void prvTimerSlackTask( void *pvParameters );
+static void prvTimerSlackCallback( TimerHandle_t xTimer );
+
+/*
+ * Called by main() to create the task and the timers.
+ */
+void vTimerSlackTask( void );
+/*-----------------------------------------------------------*/
+
+void vTimerSlackTask( void )
+{
+TimerHandle_t xTimer;
+uint32_t ui32Timer;
+
+    /* The tick count is 0 until the scheduler is started, so the timers all
+    count their periods from tick 0. */
+    for( ui32Timer = 0; ui32Timer < mainSLACK_TIMERS; ui32Timer++ )
+    {
+        xTimer = xTimerCreate( "Slack",
+                               xSlackPeriods[ ui32Timer ],
+                               pdTRUE,
+                               ( void * ) ui32Timer,
+                               prvTimerSlackCallback );
+
+        if( xTimer == NULL )
+        {
+            g_ui32TimerSlackErrors |= mainERROR_CREATE;
+        }
+        else
+        {
+            vTimerSetSlack( xTimer, mainSLACK_SLACK );
+
+            if( xTimerStart( xTimer, 0 ) != pdPASS )
+            {
+                g_ui32TimerSlackErrors |= mainERROR_CREATE;
+            }
+        }
+    }
+
+    if( xTaskCreate( prvTimerSlackTask,
+                     "Slack",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainSLACK_PRIORITY,
+                     NULL ) != pdPASS )
+    {
+        g_ui32TimerSlackErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerSlackTask( void *pvParameters )
+{
+uint32_t ui32LastExpiries[ mainSLACK_TIMERS ] = { 0 }, ui32LastShared = 0, ui32Timer;
+TickType_t xLastWakeTime;
+
+    ( void ) pvParameters;
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainSLACK_CHECK_PERIOD );
+
+        for( ui32Timer = 0; ui32Timer < mainSLACK_TIMERS; ui32Timer++ )
+        {
+            if( g_ui32TimerSlackExpiries[ ui32Timer ] == ui32LastExpiries[ ui32Timer ] )
+            {
+                g_ui32TimerSlackErrors |= mainERROR_STALLED;
+            }
+
+            ui32LastExpiries[ ui32Timer ] = g_ui32TimerSlackExpiries[ ui32Timer ];
+        }
+
+        /* The timers are due together several times between checks. */
+        if( g_ui32TimerSlackSharedExpiries == ui32LastShared )
+        {
+            g_ui32TimerSlackErrors |= mainERROR_NOT_SHARED;
+        }
+
+        ui32LastShared = g_ui32TimerSlackSharedExpiries;
+
+        g_ui32TimerSlackChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerSlackCallback( TimerHandle_t xTimer )
+{
+const uint32_t ui32Timer = ( uint32_t ) pvTimerGetTimerID( xTimer );
+const TickType_t xNow = xTaskGetTickCount();
+TickType_t xDue;
+uint32_t ui32Other;
+BaseType_t xAllExpired;
+
+    /* Each expiry is due a whole number of periods after tick 0, however
+    late the previous expiries were placed within their slack. */
+    g_ui32TimerSlackExpiries[ ui32Timer ]++;
+    xDue = ( TickType_t ) g_ui32TimerSlackExpiries[ ui32Timer ] * xSlackPeriods[ ui32Timer ];
+
+    if( ( TickType_t ) ( xNow - xDue ) > ( TickType_t ) mainSLACK_SLACK )
+    {
+        if( ( int32_t ) ( xNow - xDue ) < 0 )
+        {
+            g_ui32TimerSlackErrors |= mainERROR_EARLY;
+        }
+        else
+        {
+            g_ui32TimerSlackErrors |= mainERROR_LATE;
+        }
+    }
+
+    /* When the timers are all due on the same tick they must expire on the
+    same tick.  The timers can expire in any order, so the last of them to
+    expire makes the comparison. */
+    if( ( xDue % mainSLACK_COMMON_PERIOD ) == ( TickType_t ) 0U )
+    {
+        ui32CommonExpiries[ ui32Timer ]++;
+        xCommonExpiryTick[ ui32Timer ] = xNow;
+        xAllExpired = pdTRUE;
+
+        for( ui32Other = 0; ui32Other < mainSLACK_TIMERS; ui32Other++ )
+        {
+            if( ui32CommonExpiries[ ui32Other ] != ui32CommonExpiries[ ui32Timer ] )
+            {
+                xAllExpired = pdFALSE;
+            }
+        }
+
+        if( xAllExpired != pdFALSE )
+        {
+            for( ui32Other = 0; ui32Other < mainSLACK_TIMERS; ui32Other++ )
+            {
+                if( xCommonExpiryTick[ ui32Other ] != xNow )
+                {
+                    g_ui32TimerSlackErrors |= mainERROR_NOT_SHARED;
+                }
+            }
+
+            g_ui32TimerSlackSharedExpiries++;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_SLACK == 1 ) */
@@ -0,0 +1,268 @@
+/*
+ * timer_wheel_task
+ *
+ * Copyright (C) 2022 Texas Instruments Incorporated
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+/******************************************************************************
+ *
+ * This file checks the timing wheel that holds the active software timers.
+ *
+ * vTimerWheelTask() creates mainWHEEL_TIMERS one-shot timers whose periods
+ * fall in different levels of the wheel, so they have to be cascaded down
+ * the levels before they expire, and a check task that starts them.  Each
+ * time a timer expires its callback records the tick at which it ran, and the
+ * check task makes sure that was no earlier than the timer's expiry time and
+ * at most mainWHEEL_LATENESS ticks after it, then starts the timer again.
+ *
+ * The check task also resets another one-shot timer each time it runs,
+ * always before the timer's period has passed, so that timer must never
+ * expire.
+ *
+ * A check that fails sets a bit in g_ui32TimerWheelErrors, and
+ * g_ui32TimerWheelChecks counts the completed checks.  Both can be read with
+ * the debugger.
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "timers_ext.h"
+/*-----------------------------------------------------------*/
+
+/* The check is only built when the software timers are held in the timing
+wheel. */
+#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 ) )
+
+/*
+ * The priority of the check task.  The timer service task runs above it.
+ */
+#define mainWHEEL_PRIORITY                  ( tskIDLE_PRIORITY + 5 )
+
+/*
+ * The rate at which the check task runs, and the period of the timer it
+ * keeps resetting.
+ */
+#define mainWHEEL_CHECK_PERIOD              ( pdMS_TO_TICKS( 10UL ) )
+#define mainWHEEL_RESET_PERIOD              ( pdMS_TO_TICKS( 50UL ) )
+
+/*
+ * The number of one-shot timers that are left to expire, and the number of
+ * ticks after its expiry time a timer may run.  The timer service task runs
+ * at the highest priority, but the check task reads the tick count before
+ * starting a timer, so the start can be recorded a tick early.
+ */
+#define mainWHEEL_TIMERS                    ( 4 )
+#define mainWHEEL_LATENESS                  ( ( TickType_t ) 2 )
+
+/*
+ * Bits set in g_ui32TimerWheelErrors by the checks that fail.
+ */
+#define mainERROR_CREATE                    ( 1UL << 0UL )
+#define mainERROR_EARLY                     ( 1UL << 1UL )
+#define mainERROR_LATE                      ( 1UL << 2UL )
+#define mainERROR_RESET                     ( 1UL << 3UL )
+
+/*
+ * Results of the checks, written by the task and the timer callbacks.
+ */
+volatile uint32_t g_ui32TimerWheelErrors = 0;
+volatile uint32_t g_ui32TimerWheelChecks = 0;
+volatile uint32_t g_ui32TimerWheelExpiries[ mainWHEEL_TIMERS ] = { 0 };
+volatile uint32_t g_ui32TimerWheelResetExpiries = 0;
+
+/*
+ * The periods of the one-shot timers.  With the default of 16 slots per level
+ * they land on the first four levels of the wheel.
+ */
+static const TickType_t xWheelPeriods[ mainWHEEL_TIMERS ] =
+{
+    pdMS_TO_TICKS( 5UL ), pdMS_TO_TICKS( 40UL ), pdMS_TO_TICKS( 700UL ), pdMS_TO_TICKS( 5000UL )
+};
+
+/*
+ * The tick at which each one-shot timer was last started, and at which its
+ * callback last ran.  xWheelExpired is only written by the callbacks while a
+ * timer is running, and only read by the check task once it has stopped.
+ */
+static TickType_t xWheelStarted[ mainWHEEL_TIMERS ];
+static volatile TickType_t xWheelExpired[ mainWHEEL_TIMERS ];
+static volatile BaseType_t xWheelHasExpired[ mainWHEEL_TIMERS ];
+
+/*
+ * The check task and the timer callbacks as described in the comments at the
+ * top of this file.  The one-shot timers share a callback, and their IDs are
+ * their index into the arrays above.
+ */
+static void prvTimerWheelTask( void *pvParameters );
+static void prvTimerWheelCallback( TimerHandle_t xTimer );
+static void prvTimerWheelResetCallback( TimerHandle_t xTimer );
+
+/*
+ * Called by main() to create the task and the timers.
+ */
+void vTimerWheelTask( void );
+/*-----------------------------------------------------------*/
+
+void vTimerWheelTask( void )
+{
+    if( xTaskCreate( prvTimerWheelTask,
+                     "Wheel",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     mainWHEEL_PRIORITY,
+                     NULL ) != pdPASS )
+    {
+        g_ui32TimerWheelErrors |= mainERROR_CREATE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerWheelTask( void *pvParameters )
+{
+TimerHandle_t xTimers[ mainWHEEL_TIMERS ], xResetTimer;
+TickType_t xLastWakeTime, xLateness;
+uint32_t ui32Timer;
+
+    ( void ) pvParameters;
+
+    /* The timers are created and started here, so the tick at which each is
+    started is known. */
+    for( ui32Timer = 0; ui32Timer < mainWHEEL_TIMERS; ui32Timer++ )
+    {
+        xTimers[ ui32Timer ] = xTimerCreate( "Wheel",
+                                             xWheelPeriods[ ui32Timer ],
+                                             pdFALSE,
+                                             ( void * ) ui32Timer,
+                                             prvTimerWheelCallback );
+
+        xWheelHasExpired[ ui32Timer ] = pdFALSE;
+        xWheelStarted[ ui32Timer ] = xTaskGetTickCount();
+
+        if( ( xTimers[ ui32Timer ] == NULL ) || ( xTimerStart( xTimers[ ui32Timer ], 0 ) != pdPASS ) )
+        {
+            g_ui32TimerWheelErrors |= mainERROR_CREATE;
+        }
+    }
+
+    xResetTimer = xTimerCreate( "WheelRst", mainWHEEL_RESET_PERIOD, pdFALSE, NULL, prvTimerWheelResetCallback );
+
+    if( ( xResetTimer == NULL ) || ( xTimerStart( xResetTimer, 0 ) != pdPASS ) )
+    {
+        g_ui32TimerWheelErrors |= mainERROR_CREATE;
+    }
+
+    xLastWakeTime = xTaskGetTickCount();
+
+    for( ;; )
+    {
+        vTaskDelayUntil( &xLastWakeTime, mainWHEEL_CHECK_PERIOD );
+
+        /* The reset timer is pushed back before it can expire, which removes
+        it from its slot in the wheel and places it in another. */
+        if( xTimerReset( xResetTimer, 0 ) != pdPASS )
+        {
+            g_ui32TimerWheelErrors |= mainERROR_RESET;
+        }
+
+        if( g_ui32TimerWheelResetExpiries != 0UL )
+        {
+            g_ui32TimerWheelErrors |= mainERROR_RESET;
+        }
+
+        /* Each one-shot timer that has expired must have done so on time, and
+        is then started again. */
+        for( ui32Timer = 0; ui32Timer < mainWHEEL_TIMERS; ui32Timer++ )
+        {
+            if( xWheelHasExpired[ ui32Timer ] != pdFALSE )
+            {
+                xLateness = ( xWheelExpired[ ui32Timer ] - xWheelStarted[ ui32Timer ] ) - xWheelPeriods[ ui32Timer ];
+
+                if( ( xWheelExpired[ ui32Timer ] - xWheelStarted[ ui32Timer ] ) < xWheelPeriods[ ui32Timer ] )
+                {
+                    g_ui32TimerWheelErrors |= mainERROR_EARLY;
+                }
+                else if( xLateness > mainWHEEL_LATENESS )
+                {
+                    g_ui32TimerWheelErrors |= mainERROR_LATE;
+                }
+
+                xWheelHasExpired[ ui32Timer ] = pdFALSE;
+                xWheelStarted[ ui32Timer ] = xTaskGetTickCount();
+
+                if( xTimerStart( xTimers[ ui32Timer ], 0 ) != pdPASS )
+                {
+                    g_ui32TimerWheelErrors |= mainERROR_CREATE;
+                }
+            }
+            else if( ( xTaskGetTickCount() - xWheelStarted[ ui32Timer ] ) > ( xWheelPeriods[ ui32Timer ] + mainWHEEL_LATENESS ) )
+            {
+                /* The timer should have expired by now.  The tick count is
+                read after xWheelHasExpired, so a timer that has just expired
+                is not mistaken for a late one. */
+                if( xWheelHasExpired[ ui32Timer ] == pdFALSE )
+                {
+                    g_ui32TimerWheelErrors |= mainERROR_LATE;
+                }
+            }
+        }
+
+        g_ui32TimerWheelChecks++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerWheelCallback( TimerHandle_t xTimer )
+{
+const uint32_t ui32Timer = ( uint32_t ) pvTimerGetTimerID( xTimer );
+
+    xWheelExpired[ ui32Timer ] = xTaskGetTickCount();
+    xWheelHasExpired[ ui32Timer ] = pdTRUE;
+    g_ui32TimerWheelExpiries[ ui32Timer ]++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerWheelResetCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+
+    g_ui32TimerWheelResetExpiries++;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 ) */
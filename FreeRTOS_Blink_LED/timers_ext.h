@@ -0,0 +1,240 @@
+/*
+    FreeRTOS V8.2.3 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>>> AND MODIFIED BY <<<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef TIMERS_EXT_H
+#define TIMERS_EXT_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include timers_ext.h"
+#endif
+
+#include "timers.h"
+
+/******************************************************************************
+ *
+ * Extensions to the software timer API that are built into the copy of
+ * timers.c held in this project.  The timers.h header used by the build comes
+ * from the TivaWare installation, so the configuration of the additional
+ * features is kept here rather than in timers.h.
+ *
+ *****************************************************************************/
+
+/* Set configUSE_TIMER_WHEEL to 1 in FreeRTOSConfig.h to hold active timers in
+a hierarchical timing wheel rather than in lists sorted by expiry time.  A
+timer is then started, reset or stopped in constant time whatever the number
+of active timers, which suits large numbers of timeouts that are mostly reset
+before they expire. */
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+/* Each level of the timing wheel has ( 1 << configTIMER_WHEEL_SLOT_BITS )
+slots, and there are enough levels to cover the full range of TickType_t.  The
+wheel uses one List_t per slot, so larger values trade RAM for fewer cascades
+of timers from one level to the next.  The occupied slots of each level are
+recorded in one UBaseType_t bitmap, so a level can have at most 32 slots. */
+#ifndef configTIMER_WHEEL_SLOT_BITS
+	#define configTIMER_WHEEL_SLOT_BITS 4
+#endif
+
+#if ( ( configUSE_TIMER_WHEEL == 1 ) && ( ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_SLOT_BITS > 5 ) ) )
+	#error configTIMER_WHEEL_SLOT_BITS must be between 1 and 5.
+#endif
+
+/* Set configUSE_TIMER_COMMAND_COALESCING to 1 in FreeRTOSConfig.h to leave
+start, reset, stop, change period and delete commands on the timer they are
+sent to instead of queueing them for the timer service task.  A command then
+replaces any earlier command the timer service task has not yet processed, so
+only the last takes effect, and a message is only queued to wake the timer
+service task when the first command is left pending.  Commands sent by the
+timer service task itself, or before the scheduler is started, never queue a
+message.  Sending a command can no longer fail or block. */
+#ifndef configUSE_TIMER_COMMAND_COALESCING
+	#define configUSE_TIMER_COMMAND_COALESCING 0
+#endif
+
+#if ( ( configUSE_TIMER_COMMAND_COALESCING == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle == 0 ) && ( configUSE_MUTEXES == 0 ) )
+	#error configUSE_TIMER_COMMAND_COALESCING requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1.
+#endif
+
+/* Set configUSE_TIMER_SLACK to 1 in FreeRTOSConfig.h to allow each timer to
+be given a slack - a number of ticks by which its expiry may be delayed.  The
+timer service task then moves expiry times within their slack onto common
+ticks, so timers that are due close together are processed after a single
+wake up rather than one each. */
+#ifndef configUSE_TIMER_SLACK
+	#define configUSE_TIMER_SLACK 0
+#endif
+
+/* The number of timer service tasks.  Each has its own command queue and
+active timers, and calls the callbacks of the timers created for it, so the
+callbacks of timers created for a higher priority timer service task are not
+delayed by those of a lower priority one.  Timers created by xTimerCreate(),
+and functions pended by xTimerPendFunctionCall(), use timer service task 0. */
+#ifndef configTIMER_SERVICE_COUNT
+	#define configTIMER_SERVICE_COUNT 1
+#endif
+
+#if ( configTIMER_SERVICE_COUNT < 1 )
+	#error configTIMER_SERVICE_COUNT must be at least 1.
+#endif
+
+/* The priority of timer service task uxService.  By default timer service
+task 0 runs at configTIMER_TASK_PRIORITY and each further task one priority
+below the one before.  configTIMER_TASK_PRIORITY is only defined when timers
+are used. */
+#if ( configUSE_TIMERS == 1 )
+	#ifndef configTIMER_SERVICE_PRIORITY
+		#if ( configTIMER_SERVICE_COUNT > ( configTIMER_TASK_PRIORITY + 1 ) )
+			#error configTIMER_SERVICE_COUNT is too large for the default service priorities.  Reduce it, raise configTIMER_TASK_PRIORITY, or define configTIMER_SERVICE_PRIORITY.
+		#endif
+
+		#define configTIMER_SERVICE_PRIORITY( uxService ) ( ( UBaseType_t ) configTIMER_TASK_PRIORITY - ( UBaseType_t ) ( uxService ) )
+	#endif
+#endif /* configUSE_TIMERS */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * timers_ext. h
+ * <pre>
+ TimerHandle_t xTimerCreateForService(	const char * const pcTimerName,
+										TickType_t xTimerPeriodInTicks,
+										UBaseType_t uxAutoReload,
+										void * pvTimerID,
+										TimerCallbackFunction_t pxCallbackFunction,
+										UBaseType_t uxService );
+ * </pre>
+ *
+ * Creates a timer in the same way as xTimerCreate(), but has its commands
+ * processed, and its callback called, by timer service task uxService rather
+ * than by timer service task 0.  Use a higher priority timer service task for
+ * timers whose callbacks must not wait behind the callbacks of less urgent
+ * timers.
+ *
+ * @param uxService The timer service task used by the timer, which must be
+ * less than configTIMER_SERVICE_COUNT.
+ *
+ * See xTimerCreate() for the other parameters and the return value.
+ */
+TimerHandle_t xTimerCreateForService( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, const UBaseType_t uxService ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+#if ( configUSE_TIMER_SLACK == 1 )
+
+	/**
+	 * timers_ext. h
+	 * <pre>
+	 void vTimerSetSlack( TimerHandle_t xTimer, TickType_t xSlack );
+	 * </pre>
+	 *
+	 * Set the number of ticks by which the expiry of a timer may be delayed so
+	 * it can be processed together with other timers.  Timers are created with
+	 * no slack, so expire on the exact tick they are due.
+	 *
+	 * Each time the timer is started, reset or reloaded it is placed at the
+	 * tick within its slack that has the most low order bits clear, so timers
+	 * whose slack overlaps tend to be placed on the same tick.  The slack is
+	 * limited to one tick less than the period of the timer, so an auto
+	 * reload timer still expires once per period and does not drift, as each
+	 * reload is calculated from the time the timer was due rather than the
+	 * time it expired.
+	 *
+	 * A change of slack takes effect the next time the timer is started,
+	 * reset or reloaded.
+	 *
+	 * @param xTimer The timer being updated.
+	 *
+	 * @param xSlack The maximum number of ticks by which the timer may expire
+	 * later than it is due.
+	 */
+	void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlack ) PRIVILEGED_FUNCTION;
+
+	/**
+	 * timers_ext. h
+	 * <pre>
+	 TickType_t xTimerGetSlack( TimerHandle_t xTimer );
+	 * </pre>
+	 *
+	 * Returns the slack last set by vTimerSetSlack().
+	 *
+	 * @param xTimer The timer being queried.
+	 *
+	 * @return The slack of the timer, in ticks.
+	 */
+	TickType_t xTimerGetSlack( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_SLACK */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMERS_EXT_H */
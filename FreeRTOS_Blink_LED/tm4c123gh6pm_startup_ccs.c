@@ -37,6 +37,7 @@
 #include <stdint.h>
 #include "inc/hw_nvic.h"
 #include "inc/hw_types.h"
+#include "FreeRTOSConfig.h"
 
 //*****************************************************************************
 //
@@ -73,6 +74,18 @@ extern void vPortSVCHandler(void);
 extern void xPortSysTickHandler(void);
 extern void xButtonsHandler(void);
 
+//*****************************************************************************
+//
+// The kernel's microsecond timebase uses Wide Timer 5 when it is enabled.
+//
+//*****************************************************************************
+#if defined(configUSE_MICROSECOND_TIMEBASE) && (configUSE_MICROSECOND_TIMEBASE == 1)
+extern void xPortMicrosecondTimerHandler(void);
+#define MicrosecondTimerHandler xPortMicrosecondTimerHandler
+#else
+#define MicrosecondTimerHandler IntDefaultHandler
+#endif
+
 //*****************************************************************************
 //
 // The vector table.  Note that the proper constructs must be placed on this to
@@ -204,7 +217,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // Wide Timer 3 subtimer B
     IntDefaultHandler,                      // Wide Timer 4 subtimer A
     IntDefaultHandler,                      // Wide Timer 4 subtimer B
-    IntDefaultHandler,                      // Wide Timer 5 subtimer A
+    MicrosecondTimerHandler,                // Wide Timer 5 subtimer A
     IntDefaultHandler,                      // Wide Timer 5 subtimer B
     IntDefaultHandler,                      // FPU
     0,                                      // Reserved